@@ -0,0 +1,706 @@
+#ifndef ADMIN_PAGE_H
+#define ADMIN_PAGE_H
+
+//Generated by extras/admin-page/build.py from admin.html - edit that and rerun, rather than editing this.
+//39747 bytes of html, gzipped to 11080
+
+#define ADMIN_PAGE_ETAG "\"3ff9f221\""
+#define ADMIN_PAGE_LEN 11080
+
+const byte adminPage[ADMIN_PAGE_LEN] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x7d,0xdb,0x76,0xdb,0x46,
+  0x96,0xe8,0xbb,0xbf,0xa2,0xcc,0x74,0x0c,0x20,0x24,0xc1,0x9b,0x24,0xdb,0x92,0x48,
+  0x8f,0xaf,0x89,0xcf,0x24,0xb6,0x4f,0xa4,0x3e,0xe9,0x6e,0x59,0xe9,0x05,0x12,0x45,
+  0x12,0x11,0x6e,0x0d,0x80,0xa2,0x94,0xc4,0x6b,0xf5,0x3f,0xcc,0xd3,0xf9,0x8b,0xf9,
+  0x86,0xf9,0x94,0xfe,0x92,0xb3,0xf7,0xae,0x2a,0xa0,0x40,0x02,0x20,0x95,0x28,0xdd,
+  0x39,0x6b,0x75,0xcf,0x38,0x02,0xeb,0x86,0xaa,0x7d,0xdf,0xbb,0x76,0x15,0x4e,0x1f,
+  0xbe,0x7a,0xff,0xf2,0xfc,0xcf,0x1f,0x5e,0xb3,0x65,0x16,0xf8,0x93,0x07,0xa7,0xf4,
+  0xe7,0x74,0xc9,0x1d,0x77,0x72,0x9a,0x79,0x99,0xcf,0x27,0x2f,0xfd,0x68,0x76,0xc5,
+  0xce,0x78,0x96,0x79,0xe1,0x22,0x3d,0xed,0x89,0xd2,0x07,0xa7,0x69,0x76,0x0b,0x7f,
+  0xa7,0x91,0x7b,0xcb,0x7e,0x62,0x53,0x67,0x76,0xb5,0x48,0xa2,0x55,0xe8,0x76,0x67,
+  0x91,0x1f,0x25,0xc7,0xec,0x33,0xce,0xf9,0x09,0x53,0x3f,0x86,0xc3,0xe1,0x09,0x9b,
+  0x47,0x61,0xd6,0x9d,0x3b,0x81,0xe7,0xdf,0x1e,0xb3,0xf4,0x36,0xcd,0x78,0xd0,0x5d,
+  0x79,0x1d,0xd6,0x75,0xe2,0xd8,0xe7,0x5d,0x51,0xd2,0x61,0xa9,0x13,0xa6,0xdd,0x94,
+  0x27,0xde,0x5c,0x76,0x49,0xbd,0x1f,0xf9,0x31,0x1b,0x3c,0x89,0x6f,0x4e,0x98,0xef,
+  0x85,0xbc,0xbb,0xe4,0xde,0x62,0x99,0x41,0x91,0x3d,0xe2,0xc1,0x09,0x0b,0x9c,0x64,
+  0xe1,0x85,0xf8,0xf3,0x10,0x7f,0xc6,0x51,0xea,0x65,0x5e,0x04,0x05,0xce,0x34,0x8d,
+  0xfc,0x55,0x06,0xf3,0xf8,0xc4,0x1c,0x98,0xa5,0x9a,0xcd,0x68,0xe4,0x60,0xd1,0xca,
+  0x87,0xb2,0xd8,0x71,0x5d,0x58,0x58,0xd7,0xe7,0x73,0x18,0xf1,0x29,0x0e,0x90,0xf1,
+  0x9b,0xac,0xeb,0x85,0x2e,0x0f,0xa1,0xa4,0x4b,0x45,0xbe,0x97,0xc2,0x3c,0x70,0xc5,
+  0xc7,0x2c,0x8c,0x42,0xae,0x5e,0xda,0x9d,0x46,0x59,0x16,0x05,0xc7,0xec,0x00,0x5b,
+  0xd1,0x90,0xbe,0x07,0xa3,0x6e,0xd4,0xf6,0xed,0x27,0x7a,0xfd,0x17,0xd0,0xa2,0xf4,
+  0x92,0xfe,0x89,0x9a,0x07,0x3d,0xab,0x76,0xbe,0x33,0xe5,0xfe,0xf1,0xdc,0x4b,0xe0,
+  0xe5,0xb3,0xa5,0xe7,0xbb,0xd0,0xcf,0xf5,0xd2,0xd8,0x77,0x00,0x80,0x5e,0x48,0xb0,
+  0x98,0x22,0x7a,0x4e,0xd8,0xda,0x73,0xb3,0xe5,0x31,0x7b,0x92,0xcf,0xdf,0xf1,0xbd,
+  0x05,0x80,0x20,0x41,0x48,0xe5,0xa3,0x77,0x13,0x09,0x38,0x6c,0x46,0xb0,0x5d,0x4b,
+  0x50,0x4e,0x23,0xdf,0xcd,0x5f,0x6c,0x87,0x11,0xbd,0xba,0x58,0x88,0x06,0x1d,0x35,
+  0xb9,0xe5,0xa8,0x7e,0x36,0x39,0x46,0x78,0xc0,0xfa,0x62,0x45,0x5e,0x18,0xaf,0xb2,
+  0x8b,0xec,0x36,0xe6,0x63,0x03,0x27,0x68,0x5c,0x76,0xf4,0xa2,0x70,0x15,0x4c,0x79,
+  0xb2,0x51,0x98,0xae,0xa6,0x81,0x87,0x2d,0x53,0xee,0xf3,0x59,0xd6,0xc1,0x7e,0x4e,
+  0xc2,0x11,0x95,0xd3,0x28,0x71,0x39,0xe0,0x72,0x10,0xdf,0x30,0x40,0xb2,0xe7,0xb2,
+  0xcf,0x9e,0x3e,0x7d,0x5a,0xbc,0xb9,0x6f,0x0f,0xf1,0xdd,0x3a,0x5c,0x6d,0x9a,0x8d,
+  0x20,0x19,0x9d,0xae,0xf2,0xdf,0x77,0x23,0xcd,0x4f,0xec,0x3f,0x02,0xee,0x7a,0x0e,
+  0x8b,0x42,0xff,0x96,0xa5,0xb3,0x84,0xf3,0x90,0x39,0xa1,0xcb,0xcc,0xc0,0xb9,0xe9,
+  0x4a,0x7c,0x1c,0x1e,0xf6,0xe3,0x1b,0x0b,0xe6,0x5b,0x41,0x6b,0xfd,0x93,0x2d,0x22,
+  0xd8,0x0b,0xf1,0x65,0x8c,0x3b,0xab,0x2c,0x2a,0xa3,0x1c,0x47,0xaf,0xa4,0xa7,0x3a,
+  0xb4,0x62,0x8b,0x4f,0xcc,0x4e,0x9d,0x6b,0xe8,0xa0,0xb1,0xc9,0xd1,0x11,0x91,0x84,
+  0x1d,0x5d,0xe9,0xbc,0xe3,0x8c,0xa8,0x90,0x27,0x49,0x94,0x68,0xe5,0xb3,0x43,0x59,
+  0x7e,0x03,0xb3,0xf4,0x42,0xa8,0xd1,0x60,0x0c,0xf4,0x7f,0x28,0xd8,0x68,0x9b,0x7b,
+  0x8b,0xb7,0x1d,0xd1,0x00,0x73,0x67,0xc6,0x59,0x1a,0x3b,0xe1,0x4e,0x62,0x1f,0xd8,
+  0x03,0x9d,0xfd,0x15,0x82,0x07,0x87,0xe2,0x8f,0xc0,0xbf,0x20,0x94,0x6e,0xe2,0xb8,
+  0xde,0x2a,0x3d,0x56,0xf8,0xaf,0x90,0x57,0x83,0xc1,0xa0,0x98,0xcc,0xfc,0xe9,0x48,
+  0x02,0x35,0x5d,0x3a,0x6e,0xb4,0x3e,0x46,0x32,0x16,0x9d,0xa1,0xf2,0xa8,0x2f,0x28,
+  0xe6,0x98,0x01,0x91,0xf5,0x06,0x36,0x30,0x3f,0x0b,0xa2,0x30,0x82,0x59,0xcf,0x78,
+  0x19,0x19,0x33,0x40,0x2d,0x4f,0xf2,0x85,0xd9,0xae,0x17,0xa8,0xc5,0x45,0xd0,0xda,
+  0xcb,0x6e,0x71,0x4e,0x87,0x45,0x83,0x68,0x3e,0x57,0x0d,0xe4,0x64,0xb2,0x04,0xa8,
+  0x2e,0x06,0xba,0x0f,0xb3,0x8d,0x39,0x09,0x49,0xa4,0x7a,0xa6,0x3c,0x53,0x3d,0x9d,
+  0xd0,0x0b,0x1c,0x21,0x03,0xa7,0x00,0xb8,0x2b,0x36,0x48,0x19,0x50,0x70,0x9c,0x9a,
+  0x43,0x0b,0x60,0x39,0xf7,0x42,0x4f,0x48,0xc5,0xff,0xb8,0xe2,0xb7,0xf3,0xc4,0x09,
+  0x78,0x2a,0x1b,0xfe,0xc4,0x0e,0xfb,0x9f,0x97,0x27,0x37,0xc4,0x86,0x39,0xb5,0x9b,
+  0x71,0xc2,0xe7,0x3c,0x49,0x05,0xdc,0xba,0xe9,0x6c,0xc9,0x03,0xc0,0xb0,0xeb,0x24,
+  0x57,0x16,0xf1,0x65,0x9d,0x3e,0x20,0x15,0xa0,0x7e,0xb8,0xae,0xbb,0x21,0x94,0xd7,
+  0x4b,0x39,0xa5,0xcf,0x12,0x9e,0xae,0xfc,0xac,0x7a,0x90,0xd1,0xe3,0xd1,0xc9,0x56,
+  0x8f,0x7d,0x45,0x8b,0x90,0x22,0x95,0x03,0x4f,0x7d,0x07,0x09,0x6b,0x63,0x7a,0x1a,
+  0x31,0xab,0x1a,0x12,0x32,0x00,0x8e,0xd3,0x9e,0xd0,0x7f,0x0f,0x4e,0x03,0x9e,0x39,
+  0x6c,0xb6,0x74,0x12,0x80,0xff,0xd8,0x58,0x65,0xf3,0xee,0x13,0x63,0x22,0x4a,0x43,
+  0x00,0xec,0xd8,0xb8,0xf6,0xf8,0x3a,0x8e,0x92,0xcc,0x80,0x41,0x80,0x18,0x42,0x68,
+  0x45,0x04,0x3c,0x76,0xf9,0xb5,0x37,0xe3,0x42,0x54,0x74,0x18,0xe2,0xc4,0x73,0x7c,
+  0x80,0xa8,0xe3,0xf3,0xf1,0x00,0xc6,0xe8,0x91,0x1a,0x7e,0x70,0x8a,0x30,0x05,0x9d,
+  0x3c,0x64,0xf4,0xca,0xb1,0x21,0x99,0x37,0x8b,0x62,0xe4,0x5d,0x63,0x4b,0x43,0x2f,
+  0x87,0xd0,0x29,0x66,0x9e,0x3b,0x36,0xfc,0xc8,0x41,0x29,0x60,0x4c,0xbe,0x16,0x0f,
+  0x8f,0x96,0xdc,0xf7,0xbd,0xf8,0xe4,0x74,0x9a,0xf4,0x26,0xf4,0x9f,0xb7,0x73,0x10,
+  0x15,0x0b,0xce,0xdc,0x88,0xa7,0xa1,0x91,0x31,0x10,0x78,0xdc,0x49,0x60,0x36,0x80,
+  0x9c,0x39,0x5f,0xb3,0x94,0xc3,0xac,0xdd,0xb4,0xc3,0x4e,0x1d,0xb6,0x04,0xd4,0x8f,
+  0x5b,0x9f,0xb5,0x40,0xe4,0xcd,0x7c,0x6f,0x76,0x35,0x6e,0xc1,0x9b,0x89,0xce,0xec,
+  0x84,0xe3,0xab,0x4c,0xeb,0x84,0x25,0x3c,0x5b,0x25,0x21,0x9b,0x3b,0x7e,0xca,0x4f,
+  0x5a,0x13,0xe8,0x02,0x08,0x5d,0x9e,0xf6,0x9c,0x89,0x7d,0xda,0x8b,0x61,0x66,0xae,
+  0x77,0x4d,0x73,0x93,0xd0,0x30,0xd4,0xb2,0x72,0x66,0x27,0xb2,0x86,0xf5,0xaf,0xc0,
+  0x20,0x79,0x70,0xea,0x7b,0xb0,0xf6,0xd1,0xe4,0x4b,0x1e,0xf2,0xc4,0xf1,0x61,0x75,
+  0x23,0x80,0x0c,0x14,0xca,0x2a,0x92,0x68,0x93,0xff,0x03,0x14,0x09,0xd3,0x80,0x0a,
+  0xfa,0x79,0x4a,0x7c,0x80,0x2f,0xb9,0x16,0x15,0x08,0x4d,0x2c,0x93,0x35,0x33,0xdf,
+  0x49,0xd3,0xb1,0x31,0xef,0x46,0x99,0x63,0x08,0x38,0xc0,0xf2,0xb0,0x3d,0x14,0xa4,
+  0xcb,0x68,0x6d,0x88,0xb5,0x1a,0x9f,0x19,0xf9,0x5a,0x0d,0x6e,0xb6,0xa0,0x76,0x1e,
+  0x25,0x41,0xcb,0xb2,0x69,0xce,0xb6,0x9c,0xf2,0xb8,0x25,0xe4,0x53,0x0b,0xf8,0x73,
+  0xe9,0xa5,0x00,0x8c,0x20,0xba,0xe6,0x5b,0xc0,0x30,0x26,0x7f,0x8c,0x5d,0x27,0xe3,
+  0x39,0x12,0x00,0x26,0xa7,0x38,0x9e,0x7a,0x33,0x3e,0xd7,0x81,0x03,0xe6,0x21,0xd4,
+  0x21,0xd0,0x58,0x5c,0x09,0x6b,0x58,0x08,0x91,0x3d,0x13,0x64,0x3f,0xf7,0x7c,0x6e,
+  0xe4,0x23,0xd3,0x0f,0x67,0x36,0xe3,0x31,0x0c,0x60,0x4f,0xbd,0xd0,0x60,0x92,0x00,
+  0x4a,0x9d,0x88,0x7d,0x54,0x27,0x90,0x0d,0x06,0x83,0x39,0xcc,0xf8,0x12,0xac,0x03,
+  0x9e,0x8c,0x0d,0x31,0x7f,0x46,0x15,0xa8,0x78,0x66,0x51,0x00,0xea,0x31,0x83,0x8e,
+  0x20,0xb6,0x36,0x47,0x54,0xe0,0x14,0x4a,0x9c,0x95,0x54,0x3a,0xbb,0x76,0xfc,0x15,
+  0xc7,0x01,0x71,0x29,0xd4,0x33,0x47,0x19,0xf6,0xc9,0x9c,0x6c,0x95,0x16,0x48,0xa3,
+  0x51,0x75,0xcc,0x49,0xc6,0x34,0x26,0xcf,0x19,0xce,0x01,0x56,0xe7,0xb2,0xf4,0x8a,
+  0x67,0xb3,0x25,0x33,0x71,0x75,0x16,0xc8,0xe7,0x84,0x90,0x01,0x3d,0x80,0x3b,0x3a,
+  0xa4,0x99,0xb3,0x25,0x67,0xab,0x7c,0x09,0x6c,0x9e,0x44,0x00,0xfa,0x2c,0x45,0xbe,
+  0x9c,0x7b,0x0b,0x9b,0x9d,0x43,0x3d,0x35,0x07,0x0d,0xe3,0xfb,0xd0,0x86,0xc7,0x2c,
+  0x59,0x85,0x21,0xaa,0x45,0x90,0x36,0x3e,0x87,0xd6,0x4c,0x40,0x1f,0x18,0x02,0x46,
+  0x0b,0x01,0x03,0x30,0xd7,0x24,0xb3,0xd5,0x4c,0x7b,0x88,0xc3,0x7c,0xde,0x5b,0x74,
+  0xfa,0x0d,0x50,0x46,0x72,0xbb,0x4d,0xa6,0x01,0x95,0xef,0xb5,0xe0,0x94,0x45,0x92,
+  0x65,0x71,0x1e,0x2c,0xf3,0x02,0x2e,0x66,0x0e,0xd2,0x22,0x66,0xc0,0xbc,0x57,0x0c,
+  0x28,0x78,0x05,0x36,0x83,0xcf,0xaf,0x41,0xd9,0x93,0x42,0x89,0x22,0xe0,0xe7,0x39,
+  0x68,0x22,0x46,0xd3,0x5d,0xc5,0xec,0x51,0xe8,0x02,0xa5,0x9f,0x30,0x6f,0x8e,0x8b,
+  0xc2,0xa5,0x02,0x1c,0xc0,0x86,0x89,0x71,0xb1,0x50,0x0f,0x04,0x9c,0xb0,0x35,0xe7,
+  0x57,0xb0,0xd2,0x34,0x02,0x71,0xb6,0xc4,0x0a,0x80,0xa7,0x0f,0x6f,0x80,0x47,0xbb,
+  0x76,0x8d,0xaf,0x04,0xe1,0x6e,0x2f,0x12,0xb5,0x94,0x91,0xf3,0x1e,0xfe,0xd8,0xbd,
+  0xde,0xbc,0x23,0x92,0x04,0x74,0x78,0x19,0x85,0x21,0x08,0x71,0x5d,0x94,0xd5,0xcd,
+  0xe3,0x3b,0xaf,0xfb,0xc6,0xcb,0x67,0x91,0xf3,0xd9,0xba,0x9a,0xcb,0x04,0x07,0x97,
+  0xf8,0x0c,0x0c,0x22,0x6e,0x22,0x0d,0x55,0x70,0x9a,0xd4,0x25,0x34,0x20,0x52,0x36,
+  0xc9,0x89,0xa5,0x13,0x2e,0xb8,0x7c,0xc3,0x6c,0xb9,0x30,0x2d,0x68,0x18,0xc5,0x28,
+  0x1f,0x15,0xbd,0x1b,0x93,0x77,0xc0,0xcd,0xa7,0x3d,0x51,0xba,0x59,0xbb,0x8e,0x41,
+  0x1a,0x7d,0xf7,0xe1,0x79,0x6d,0x3d,0x8f,0xa1,0xfe,0xf5,0x87,0xa2,0xbe,0x27,0xe6,
+  0xa1,0x01,0x79,0x9d,0x0b,0xb4,0x6a,0xbe,0x5e,0xa7,0xa9,0x07,0x0c,0x27,0x54,0x93,
+  0xfc,0x51,0xe2,0xf1,0xb3,0xb3,0xb7,0xaf,0x98,0xf9,0x8e,0x67,0xeb,0x28,0xb9,0x62,
+  0xef,0xa0,0x9d,0x55,0xc9,0xec,0x95,0xeb,0x85,0x52,0xe0,0xac,0x55,0x5c,0x2e,0x54,
+  0x8b,0xdf,0x21,0x72,0x60,0xf9,0x69,0x9a,0x4f,0x4d,0xfc,0x28,0x4d,0xed,0x03,0x14,
+  0xc1,0xac,0xdc,0xde,0x7f,0xd6,0x08,0xa0,0x5f,0x38,0x27,0x5d,0x35,0xd0,0x44,0xa6,
+  0x0a,0x86,0xc2,0x5e,0x86,0x6e,0x50,0x78,0xe5,0x19,0x13,0x78,0x31,0x7b,0x0b,0xf6,
+  0xfa,0x8d,0xa2,0x2b,0x56,0xa2,0x04,0x68,0xb2,0x1f,0x1d,0xf4,0x8d,0xc9,0x19,0xf5,
+  0xab,0x43,0x35,0xe8,0xff,0x41,0x5d,0xdd,0xd0,0x98,0x0c,0xeb,0xea,0x46,0xc6,0x64,
+  0x54,0x57,0x77,0x60,0x4c,0x0e,0x2a,0x48,0x47,0x67,0xc1,0x42,0x72,0xd3,0xe4,0x1b,
+  0x65,0xf7,0x19,0xb0,0x47,0xad,0xb6,0xea,0x15,0xa2,0x70,0x93,0x2f,0xdf,0x9d,0x7f,
+  0x00,0x17,0x2b,0x9c,0x15,0x02,0xa2,0x80,0xe0,0xf4,0xa9,0x0e,0xc0,0x30,0x8b,0x09,
+  0x7c,0x27,0xac,0x60,0xc5,0x2a,0x50,0xbe,0x9f,0xcf,0x1b,0xe0,0xf8,0x3e,0x64,0x26,
+  0x48,0xc2,0xe4,0x96,0x81,0x58,0x4c,0x98,0x93,0xb1,0xc0,0x0b,0x57,0xa0,0x03,0x0e,
+  0x9f,0x5a,0x15,0xe0,0x28,0x44,0x11,0x4e,0x08,0xa6,0x80,0x73,0x75,0x39,0xcf,0x50,
+  0x1f,0xe5,0xe5,0x20,0xa5,0x32,0xac,0xd8,0x10,0x61,0xf2,0x59,0xd8,0x12,0x58,0x1f,
+  0xa2,0x2d,0x91,0xd3,0x5a,0xa5,0x51,0xa1,0x86,0x02,0xab,0xc2,0x03,0xe1,0x96,0x7c,
+  0x75,0xfe,0xcd,0xd7,0xe3,0x56,0x4b,0x5f,0xf4,0x96,0xfc,0x39,0x83,0xf6,0x8f,0xc2,
+  0x69,0x1a,0x9f,0xc0,0x0b,0xc8,0x8e,0xa8,0xd7,0x18,0xdf,0xf2,0xbf,0xad,0x3c,0xd0,
+  0x53,0x8c,0x04,0xa2,0xcd,0xc0,0xe2,0x5b,0xa5,0x28,0xcc,0x71,0xe8,0x0e,0x9b,0x82,
+  0xb7,0xb5,0x4a,0x38,0xcb,0x22,0x86,0x1e,0xc4,0x2d,0xc2,0x48,0xd9,0x7a,0xc6,0x67,
+  0xab,0x6c,0x06,0x9c,0x05,0x15,0x60,0xbc,0x9c,0xbf,0x64,0xe2,0x19,0x5f,0x48,0x0a,
+  0xb5,0x68,0x87,0xcc,0xe8,0xa6,0xd0,0x0a,0x1f,0xd8,0xab,0xb3,0x73,0x6a,0x03,0xe8,
+  0x8d,0xd6,0xdb,0x9a,0x22,0x87,0x2c,0x4f,0x00,0x2f,0x3e,0xf0,0x95,0x4e,0x1a,0x54,
+  0x98,0x13,0x47,0xb5,0xa8,0x80,0xce,0x5e,0xac,0x93,0x4a,0x0c,0xba,0x3c,0xce,0x08,
+  0x62,0x2d,0xaa,0x6c,0xe9,0x8c,0x5f,0x53,0x3b,0xf5,0x57,0xc0,0xd8,0xab,0xb0,0xa2,
+  0xba,0x44,0x72,0xba,0xb0,0x60,0x12,0xb9,0xd4,0x2e,0x25,0x16,0xd8,0xc6,0xaa,0x8e,
+  0xad,0x5a,0xfb,0x16,0x3b,0xef,0x40,0x5d,0x0e,0xdf,0x65,0x06,0xd0,0x3a,0xee,0xf5,
+  0x78,0x68,0xaf,0xbd,0x2b,0x2f,0x46,0x57,0xcc,0x8e,0x92,0x45,0x0f,0x7f,0xf5,0xde,
+  0x7e,0xb8,0x3e,0xf8,0xec,0xb9,0xeb,0x02,0x92,0x11,0xb1,0xc0,0xaf,0xe0,0x21,0xa0,
+  0x37,0xf2,0x57,0xf0,0x6b,0xc2,0x2b,0x63,0x82,0x0d,0x04,0xd2,0x44,0xa3,0x0e,0xe3,
+  0x36,0xd8,0x3b,0x30,0x0f,0x34,0x26,0xb6,0xde,0x92,0xcd,0xed,0xd0,0x4b,0x33,0x7b,
+  0x11,0x5d,0xc3,0x73,0x77,0xb6,0xf0,0x7a,0x02,0x2b,0xa9,0x0d,0xcf,0xdb,0xc3,0xbf,
+  0x7b,0x7b,0x76,0x6e,0xa4,0x64,0x8a,0x48,0xf4,0xa5,0xb4,0xb0,0x3a,0xcd,0xfc,0x72,
+  0x95,0xa0,0x37,0x4b,0x1d,0x2a,0x11,0x2d,0x5d,0x36,0xe1,0x26,0xac,0x12,0x20,0xad,
+  0x65,0x1d,0xb2,0x45,0x75,0x2d,0xb6,0xf5,0xea,0x2a,0x74,0xab,0x7a,0x81,0x6f,0x78,
+  0xd4,0xbb,0x80,0x9c,0x40,0xf9,0xc2,0x02,0xe7,0x06,0xa4,0xee,0xc8,0x20,0x1f,0x1a,
+  0x65,0x8a,0x4e,0x10,0x82,0x0d,0x8f,0xc5,0x9f,0x1d,0xab,0x08,0xfe,0xe5,0xab,0x38,
+  0x7c,0x5a,0xbd,0x8a,0xd2,0xc4,0x97,0x9e,0xeb,0xf2,0x50,0x9f,0xb8,0x4e,0xf9,0xa2,
+  0xe4,0xb7,0x26,0xfd,0xe1,0x41,0x97,0xc4,0x35,0x2a,0x11,0x27,0xb3,0xc1,0xbd,0x25,
+  0x3f,0x54,0x58,0xe6,0x40,0xc3,0x20,0xaa,0x40,0xd0,0xf4,0xc1,0x2e,0x07,0x2b,0x1c,
+  0xc7,0x73,0xeb,0x2d,0xd2,0x73,0x24,0x4c,0x31,0x50,0xa5,0xd2,0x19,0x1c,0xe9,0x78,
+  0x69,0xd0,0x35,0xa8,0x95,0x87,0x34,0xaf,0x26,0xdd,0x7c,0xb0,0xd1,0xa2,0x42,0xb5,
+  0x6c,0xae,0xf6,0x0d,0x78,0x2b,0x33,0x8d,0x2b,0x54,0xe4,0x8b,0x82,0x8b,0x36,0x7b,
+  0xee,0x3b,0x60,0xbd,0xa2,0xc4,0x4d,0x85,0x97,0x4f,0x8d,0x52,0xe6,0x80,0xdc,0x76,
+  0xfc,0xb5,0x73,0x9b,0xa2,0xcd,0xbf,0x0e,0xd1,0x6d,0x97,0xaf,0xaf,0x90,0xba,0xb9,
+  0xd7,0xeb,0x92,0x29,0xbd,0xc1,0x8c,0x58,0x98,0x43,0x47,0xb3,0x7b,0x60,0x5a,0x58,
+  0x05,0xce,0xc9,0x9f,0xb9,0x93,0x48,0x32,0xdf,0x83,0x69,0x45,0xa7,0x7a,0x7a,0xa7,
+  0xfa,0x26,0x8a,0xd7,0x1a,0xd4,0xd0,0xbc,0x6c,0x51,0x96,0xd5,0x44,0xee,0xc3,0x7e,
+  0x5f,0x51,0xfc,0x53,0xf8,0x5f,0x35,0xcd,0x6b,0x04,0x4d,0x23,0xdd,0x23,0x49,0x6f,
+  0xc3,0x2f,0x30,0x26,0xdf,0x44,0x61,0xb6,0xbc,0x1b,0x00,0x83,0x1d,0x00,0x0c,0x76,
+  0x01,0x30,0xd8,0x09,0xc0,0xa0,0x12,0x80,0x03,0x09,0xbd,0xc1,0x70,0x2f,0xd8,0x05,
+  0xbf,0x29,0xec,0x5c,0x63,0xf2,0x0a,0xe3,0x26,0x77,0x02,0x9d,0xbb,0x03,0x74,0xee,
+  0x2e,0xd0,0xb9,0x3b,0x41,0xe7,0x36,0x82,0x6e,0x34,0xd8,0x0b,0x74,0xf7,0x24,0x49,
+  0x77,0xb1,0x39,0x02,0xb0,0x51,0x06,0x3e,0xde,0x5f,0x06,0x06,0x48,0xc8,0x3d,0x1c,
+  0xbe,0x87,0x11,0x02,0x17,0x9d,0xfd,0x5a,0x71,0x48,0xcd,0x44,0x8f,0x1d,0x8d,0x47,
+  0xa5,0x91,0x6f,0x41,0xda,0x34,0x78,0x32,0xda,0xb0,0x4d,0x2d,0x0f,0x8d,0x09,0x56,
+  0xf7,0x8a,0x81,0xef,0x24,0x97,0x31,0xae,0x22,0x67,0x8d,0xb1,0x0f,0x09,0x7d,0xee,
+  0x32,0x07,0x84,0x2f,0x13,0x54,0x27,0xe2,0x48,0x7d,0x66,0x9e,0xad,0x42,0x68,0x67,
+  0xa1,0x5e,0x3a,0x82,0x5f,0x4e,0x86,0x08,0xbe,0xb5,0x6c,0xf6,0x06,0xe4,0x71,0xd7,
+  0xf5,0x16,0x5e,0xa6,0x46,0x90,0x7a,0x0c,0x85,0xb6,0xd8,0x3f,0xc2,0xd0,0x14,0xed,
+  0xf7,0x30,0xf0,0xbb,0xc5,0xe4,0x53,0x94,0xe6,0xdc,0x99,0x2d,0xd1,0x46,0x83,0xfa,
+  0x14,0x8c,0x35,0x9a,0x79,0xba,0x4b,0xb6,0x33,0xfc,0x73,0x3b,0x8b,0x56,0x61,0xa6,
+  0xe1,0xff,0x96,0x51,0x89,0x66,0x5b,0xeb,0xf8,0x3f,0xd0,0xd1,0xef,0xce,0xee,0xc1,
+  0xef,0x7a,0x89,0x6f,0x03,0xb5,0x02,0x8b,0x85,0x07,0xcf,0xb7,0x6d,0xbb,0x81,0x4c,
+  0xb4,0xd6,0x60,0xc3,0xce,0x78,0xa9,0x75,0x8d,0x73,0xa6,0x16,0xc9,0x13,0xdd,0x3f,
+  0xcb,0xed,0x4e,0x4d,0x90,0x4c,0x0f,0xef,0x26,0x7e,0xa1,0x7d,0x8d,0xf4,0x98,0x1e,
+  0xd6,0xca,0x0d,0x55,0x55,0x25,0x31,0xb0,0xee,0x57,0x88,0xd9,0xe9,0xe1,0x6f,0x23,
+  0x60,0xa7,0x47,0x77,0x12,0xad,0xd3,0xa3,0x5a,0xb0,0x1c,0xd5,0x83,0xe5,0xa8,0x01,
+  0x2c,0x47,0xbf,0x4a,0x84,0x4e,0x8f,0xee,0x11,0x2c,0x15,0x1b,0x04,0x45,0xd4,0x95,
+  0x76,0x45,0x52,0x19,0x43,0x45,0x1e,0xb3,0xd9,0xb7,0x1c,0xca,0x32,0x28,0x0b,0xc3,
+  0x95,0xe3,0x83,0x99,0xb6,0xaf,0xc5,0x25,0x03,0xa4,0x34,0x0c,0x73,0x57,0x89,0xb2,
+  0xe7,0x9e,0x55,0x0b,0xe6,0x27,0x7b,0x0a,0x66,0x60,0xc8,0x77,0x9c,0x5c,0xe7,0x5a,
+  0x96,0x24,0x25,0xe0,0x85,0x00,0x52,0xc7,0x45,0xa9,0x22,0x37,0x77,0x1a,0xd8,0xf2,
+  0xcd,0x0a,0xc4,0x14,0x4d,0xd4,0xc9,0xd8,0xf1,0xa8,0xaf,0xba,0x30,0x13,0x87,0x71,
+  0xc2,0xcc,0x6a,0x90,0xe6,0xf5,0x9d,0xd3,0x59,0x12,0xf9,0x3e,0x2c,0xbc,0x2a,0x02,
+  0xb3,0x65,0xbf,0x7f,0xcd,0x69,0xf3,0x8a,0xfd,0xc8,0x93,0x28,0xad,0x06,0xd2,0xd3,
+  0x3b,0x00,0x29,0x62,0xe6,0xe0,0x78,0x38,0xb2,0x1a,0x00,0xf5,0x67,0x90,0xbe,0x66,
+  0x7f,0xa3,0xd5,0xf6,0x04,0x0b,0x04,0x87,0xde,0x8d,0xa7,0x63,0x18,0x65,0xfd,0xdc,
+  0x71,0x77,0xbb,0xb7,0xd3,0x61,0xbf,0x96,0xa7,0x86,0xfd,0x7a,0xa6,0x52,0x75,0x95,
+  0x5c,0x85,0x95,0x15,0x6c,0x95,0xbb,0xb2,0xfd,0x1d,0x6c,0x35,0xec,0xff,0xd6,0xee,
+  0xdd,0x3b,0x84,0x17,0xcb,0x56,0x53,0x74,0x75,0x14,0xb0,0x18,0x9f,0xcf,0x31,0xcf,
+  0x03,0x15,0xdf,0x12,0x94,0x69,0xc2,0xdd,0x6c,0x49,0xfb,0x1d,0x8e,0x24,0x1d,0x66,
+  0xae,0x62,0xd4,0xaf,0xc3,0xbe,0x55,0xeb,0xed,0x3d,0xcf,0x23,0x50,0x12,0xf4,0x6a,
+  0x23,0x56,0xc5,0xa8,0xf2,0x65,0x4d,0x68,0x92,0x3a,0x1d,0x0d,0x87,0xfb,0xd3,0x51,
+  0xb3,0xf6,0xfb,0xc6,0x49,0x66,0xcb,0x7f,0xfc,0xfd,0xbf,0xde,0x45,0xd7,0x9c,0xac,
+  0x04,0xf3,0x8f,0x67,0xbd,0x97,0xcf,0xad,0x06,0x5e,0x53,0x5d,0xde,0xcf,0xb2,0x48,
+  0xf4,0xf8,0xcf,0xde,0xeb,0x3f,0x36,0x31,0xd8,0xf3,0x38,0xf1,0x7c,0xbd,0xc7,0x37,
+  0x7f,0xb2,0x1a,0x6c,0xa6,0x33,0x1e,0x67,0x34,0x19,0xe8,0x42,0x5d,0x99,0xf9,0xee,
+  0x2f,0x56,0x83,0xe9,0x24,0xc7,0x2d,0x9a,0x3f,0xaf,0x9f,0xce,0x91,0xde,0xfc,0x0d,
+  0x9f,0x26,0x2b,0x27,0xb9,0x65,0xe6,0x8b,0xbf,0x58,0x77,0xb2,0xb8,0x10,0x7b,0x98,
+  0xbb,0x30,0x43,0x91,0x8a,0xee,0xae,0xdc,0xc1,0x43,0x7d,0xb5,0x76,0x12,0xb7,0x87,
+  0x9b,0xf7,0xf8,0x80,0x32,0x65,0xe8,0x04,0x80,0x2e,0x32,0x9e,0x12,0x18,0xf9,0x1a,
+  0xe4,0x11,0x13,0x56,0x18,0x88,0x18,0xce,0xb7,0x23,0x5b,0x40,0x69,0xcb,0xd5,0xd4,
+  0x9e,0x45,0x41,0x8f,0x46,0x4d,0xe3,0x28,0xeb,0xc1,0x60,0x2b,0x2f,0x8c,0xba,0x54,
+  0xd2,0x9b,0xfa,0xd1,0xb4,0x17,0x38,0xc0,0x1f,0x49,0xef,0xed,0xbb,0xb3,0xf3,0x6f,
+  0xff,0xf8,0xf2,0xfc,0xed,0xfb,0x77,0x67,0x76,0xe0,0x6e,0x47,0xbe,0x50,0x08,0x26,
+  0xab,0x19,0x59,0x65,0x14,0x60,0xc3,0x6d,0x47,0x97,0x67,0x8e,0xe7,0xa7,0x16,0x85,
+  0x5a,0x6f,0xa3,0x15,0x8b,0xa6,0x14,0x15,0x63,0x60,0x83,0xf9,0x98,0xfb,0xc2,0xce,
+  0x44,0xaa,0x0d,0xc5,0x25,0xa6,0x2b,0x19,0x74,0xc5,0xbd,0x74,0x9f,0x1b,0x29,0x4b,
+  0x56,0xbe,0xf4,0xed,0xc3,0x28,0x83,0x85,0xc5,0x18,0xee,0x00,0x2b,0xc7,0x65,0x4b,
+  0x9e,0xf0,0x0e,0xee,0xc0,0xc1,0x60,0xb4,0xb9,0x29,0xc3,0x20,0x40,0x8a,0x2a,0x3a,
+  0x40,0xc0,0x28,0x41,0x0c,0x78,0x5e,0x28,0x28,0x66,0x62,0x1b,0xc7,0x85,0x7f,0xa1,
+  0x88,0x85,0x43,0x57,0x6c,0xbe,0x4f,0xb8,0xd7,0x53,0x51,0xe3,0x74,0x15,0x26,0x5e,
+  0xca,0x7b,0xf0,0x17,0xea,0xac,0x26,0xad,0x87,0xa8,0xa2,0x05,0xe7,0x82,0xf1,0x85,
+  0x2a,0x61,0x53,0xbe,0x04,0x20,0x44,0xc9,0x16,0x97,0x16,0x9d,0x9a,0xf8,0xf4,0x68,
+  0x7f,0x3e,0x7d,0x2e,0x02,0x24,0x51,0x23,0xbb,0xaa,0x46,0x61,0x03,0x7f,0xbe,0x0f,
+  0x85,0x21,0xcb,0x42,0x9c,0x5e,0xcf,0x81,0x1e,0x60,0xc1,0x03,0xbd,0xd6,0x8f,0x3c,
+  0xa2,0x5e,0x14,0xa3,0x72,0x30,0x86,0xd3,0x43,0x3d,0x9f,0x80,0x85,0xbb,0x08,0x41,
+  0x82,0xd6,0xb3,0x6a,0x01,0xc3,0x74,0xed,0x65,0xb3,0x65,0x8c,0xac,0x81,0x23,0x01,
+  0xfd,0x32,0x51,0x24,0x07,0xf9,0x25,0xea,0xe9,0x39,0xac,0xa2,0x3b,0x73,0xb2,0x65,
+  0x04,0x32,0x37,0x8e,0xbc,0x34,0xc2,0x2d,0xee,0x6d,0x79,0x09,0xcd,0x44,0x6d,0x13,
+  0x2a,0x0e,0xee,0x80,0x8a,0xf7,0x60,0xd8,0x83,0x2c,0x6f,0xf0,0x01,0x01,0x15,0xaf,
+  0xf3,0xbd,0x9a,0x06,0x5c,0x88,0x46,0x62,0x23,0xe7,0x4e,0xf2,0xe5,0x45,0xe2,0xf1,
+  0x39,0xf0,0xc2,0xec,0x76,0x46,0x5c,0x86,0x16,0x0a,0x2a,0xa0,0x14,0x99,0x01,0x38,
+  0xed,0x1a,0x63,0x61,0x25,0xb9,0x01,0x62,0x63,0xbd,0x5e,0xdb,0xa8,0xab,0xba,0x19,
+  0x47,0xb9,0x40,0xf2,0x23,0xf5,0xe0,0x47,0x8f,0x00,0xdb,0x73,0x3d,0x50,0x5c,0x18,
+  0x45,0xeb,0x49,0xa8,0x7e,0x3e,0xec,0xe7,0x70,0x55,0x65,0xdd,0xbc,0xc4,0x5e,0x66,
+  0xc1,0xb6,0x2c,0xa9,0x40,0x88,0x33,0xb1,0xd9,0x77,0xe8,0x28,0xa2,0x20,0xc8,0x12,
+  0x6f,0xb1,0x40,0xeb,0x53,0x58,0x8c,0xdb,0x44,0x68,0x83,0x80,0xf1,0x60,0x69,0x12,
+  0x58,0x4b,0x4c,0xe5,0x09,0x53,0xb1,0xe1,0xe5,0x52,0x73,0x16,0x25,0x1d,0xe4,0x64,
+  0x1e,0x3a,0x53,0x9f,0xbb,0x1d,0x41,0x99,0xa2,0x4a,0x0e,0x22,0x12,0x04,0x1a,0x5d,
+  0x4c,0xd0,0x21,0x71,0x4e,0x4b,0xe7,0xf0,0x83,0x27,0xe8,0xeb,0x72,0x46,0xa9,0x4b,
+  0xd5,0xde,0xe5,0xe1,0xfe,0x44,0xf2,0x3f,0xff,0xfd,0xb2,0x81,0x3a,0xfe,0xe7,0xbf,
+  0xdf,0xec,0x47,0xf2,0xc4,0x6f,0x06,0xe5,0x0e,0x51,0xf8,0x74,0x23,0x73,0x68,0xbb,
+  0xa1,0xe4,0x0d,0x0a,0xb5,0x7a,0x69,0x91,0x5e,0xb0,0xbd,0x1c,0xc7,0x0f,0xee,0x64,
+  0x26,0x80,0x29,0x69,0x35,0x6e,0x50,0x76,0x48,0x0b,0xa4,0x57,0x5e,0xcc,0x42,0x7e,
+  0x93,0xa1,0xe9,0x69,0x35,0x0b,0x22,0x73,0x60,0xdd,0x0d,0x0c,0xfa,0xea,0xf6,0xda,
+  0x77,0x81,0x45,0x62,0xbb,0xda,0x8d,0x17,0x59,0x5f,0x6b,0xa1,0x96,0xea,0xab,0xac,
+  0xd4,0xbc,0x81,0xb6,0x6b,0xa1,0x75,0xba,0xc7,0xcd,0x17,0x39,0x6a,0xf0,0xbb,0x58,
+  0xca,0x9d,0x77,0x60,0xe4,0x40,0xba,0x81,0x2e,0x8b,0xfe,0xc9,0x7b,0x30,0x0d,0x22,
+  0x81,0xa8,0x8c,0xc1,0x5f,0x90,0x21,0x48,0xc6,0x86,0x6e,0x8c,0x77,0xb1,0xa4,0x52,
+  0x2c,0x20,0x5a,0xb5,0xa8,0x13,0x68,0xe0,0xbd,0xe2,0x4e,0xe4,0xe6,0x82,0x35,0x43,
+  0x2f,0x15,0x5b,0xfb,0x18,0x68,0x6b,0x60,0xb1,0xef,0x38,0xbf,0xe2,0xcd,0x9e,0xee,
+  0x77,0x98,0xee,0x82,0xb1,0xbe,0x06,0x5d,0xfe,0x72,0x95,0x82,0x75,0xda,0x94,0x7e,
+  0x33,0x1d,0xe1,0x2a,0xf6,0x49,0xe4,0xca,0xb7,0xe1,0xd7,0x72,0x6e,0x20,0x9c,0xd9,
+  0x5a,0x4d,0x62,0x6b,0x5f,0xbe,0xb0,0xd1,0xb0,0x0d,0x36,0x31,0x26,0xeb,0x62,0xca,
+  0xf9,0x66,0x3b,0xe8,0x0b,0x30,0x11,0x66,0x34,0x51,0xca,0x51,0x13,0x86,0x07,0x5b,
+  0x44,0x9c,0x6c,0x20,0x65,0x2f,0x53,0xa4,0x6d,0xb6,0xe4,0xb3,0xab,0xaa,0x9d,0xb3,
+  0x6d,0xcc,0x82,0xb5,0x01,0x8b,0xcd,0xf1,0x7a,0x26,0x8d,0x8f,0x2a,0x59,0xbf,0xbf,
+  0x0f,0x55,0xbc,0x26,0xf6,0xf8,0x8f,0x11,0x59,0x39,0x2f,0x38,0x8f,0x9b,0x82,0x18,
+  0x95,0xa6,0xd1,0x19,0x3d,0xd6,0x63,0x57,0x7b,0xd1,0x0a,0x98,0x82,0xfa,0x7c,0xc0,
+  0xa7,0x3a,0x5c,0x56,0xbd,0x04,0x90,0x59,0x83,0xcb,0x33,0xdd,0x22,0x13,0xa1,0x5d,
+  0xa7,0xec,0xc7,0x88,0x06,0x08,0x7f,0x11,0x42,0x2a,0x8d,0x93,0xae,0x41,0xa7,0xe7,
+  0x34,0x23,0xad,0x1a,0x4d,0x05,0xef,0x44,0x0e,0x41,0x2f,0xc7,0xcd,0x07,0x01,0x8b,
+  0x0a,0xd4,0x8c,0x9e,0xe6,0x90,0x88,0xb1,0x51,0x2d,0xa2,0x76,0x6a,0x94,0xed,0x97,
+  0x3a,0x19,0xac,0x2b,0xac,0xa6,0x88,0xc7,0xfb,0xab,0xcb,0xaf,0x23,0x34,0x7c,0x6a,
+  0x19,0xf9,0x6c,0x19,0x25,0x59,0x03,0x17,0xbf,0x8a,0x56,0x53,0x9f,0x37,0xb0,0xf0,
+  0x79,0xe2,0xc5,0xf5,0x0d,0xc0,0x49,0xfe,0xdf,0x2b,0xc7,0x6d,0x70,0x89,0x5f,0xae,
+  0x66,0x57,0x51,0xd4,0xe0,0x04,0x9f,0xaf,0x42,0xce,0x6a,0x73,0xb7,0x1e,0xcb,0x06,
+  0xb5,0x09,0x5c,0x4f,0x64,0x83,0xda,0x2c,0xae,0xa7,0xb2,0xc1,0xc1,0x2f,0xd1,0xff,
+  0x67,0x61,0x14,0xfd,0xb8,0x4f,0x50,0xea,0xa0,0x3e,0x28,0x75,0xd0,0x10,0x94,0x3a,
+  0x68,0x0a,0x4a,0x1d,0x34,0x06,0xa5,0x8e,0x76,0x06,0xa5,0x0e,0x7e,0x6b,0x7d,0xf7,
+  0x36,0xcc,0x79,0x8f,0xfd,0x85,0x27,0x11,0xee,0xd6,0xa0,0xa1,0x0c,0x7e,0x36,0xc1,
+  0x6d,0x1f,0x39,0x39,0xf7,0xa6,0x39,0xb4,0xdf,0x78,0xd3,0x28,0x74,0x66,0x33,0x8f,
+  0x05,0x91,0x5b,0x6d,0x18,0x1f,0xf6,0xef,0x2b,0xe0,0xf4,0x3e,0xac,0xf4,0x83,0xea,
+  0x36,0xb6,0x22,0xb6,0x76,0xae,0x38,0x85,0x27,0x82,0x08,0xd4,0xcc,0x22,0x71,0x5c,
+  0x8a,0x12,0xe8,0x4a,0x43,0x6c,0x52,0xa1,0x43,0xc0,0x9c,0x69,0x04,0xa4,0x32,0x7c,
+  0xac,0x20,0xc4,0xb8,0x93,0x60,0xe3,0xe9,0x2d,0x28,0x1e,0x91,0x35,0x0c,0x8e,0x86,
+  0x17,0xce,0x12,0xee,0xa0,0x5a,0x43,0xa1,0x87,0xbc,0xca,0xf1,0x2c,0x01,0xfc,0x17,
+  0x26,0x9a,0x32,0x10,0xec,0x34,0x7a,0x01,0x98,0x94,0xff,0x6d,0xc5,0xd1,0x2b,0x34,
+  0x8f,0x06,0xfd,0xe2,0xb0,0x01,0xe5,0x56,0x8f,0x46,0x8f,0xe5,0xd3,0x70,0x34,0xb2,
+  0x6d,0x1b,0x03,0x2a,0xa1,0x88,0x7b,0x20,0x3c,0x3b,0x12,0x2b,0x74,0x74,0x41,0x78,
+  0x48,0xb8,0x22,0x11,0x43,0x3c,0x61,0x4e,0x78,0x8b,0x56,0x75,0x06,0x40,0xc2,0x00,
+  0x8a,0xda,0x71,0xf3,0x7c,0x7a,0x5d,0xb1,0x46,0x91,0x28,0x4e,0x0a,0xb1,0x83,0xc6,
+  0x44,0x88,0x0e,0x12,0x16,0xa0,0xd6,0x75,0x72,0x7b,0x19,0xdc,0xa9,0x34,0xfc,0xc7,
+  0xdf,0xff,0x2f,0x46,0x2e,0x28,0xef,0xdb,0x01,0xe5,0xe9,0xb2,0x5b,0x0e,0x76,0x51,
+  0xad,0xc6,0x60,0x5f,0x39,0x38,0x33,0x39,0x27,0x2d,0x0e,0xc0,0x8a,0xd8,0xcd,0x2a,
+  0xe5,0x65,0x8f,0xbe,0x5e,0xee,0x53,0xa6,0x38,0x20,0x8b,0x86,0x48,0xeb,0x0f,0x4e,
+  0x54,0xf9,0x6c,0x18,0x77,0x10,0xde,0xd0,0xcb,0x65,0x12,0x85,0x51,0x0f,0x83,0x4f,
+  0x49,0xad,0x53,0xa4,0xda,0x17,0x09,0x34,0x09,0xa6,0xc2,0x03,0x0d,0x54,0x91,0xb1,
+  0xa8,0xd9,0x9f,0x92,0xcf,0xb2,0x28,0xee,0x30,0x3f,0xc2,0x70,0xd2,0x46,0x14,0x63,
+  0x8b,0xae,0xc5,0x36,0x4b,0x47,0x50,0xd3,0x8e,0xe6,0x43,0x1c,0x1a,0xa9,0x75,0x46,
+  0x6b,0xdc,0xeb,0x15,0xa3,0xcd,0x3e,0xd5,0x2f,0xda,0xcd,0x52,0xdf,0x2d,0x1d,0x11,
+  0x7d,0x13,0x31,0x1e,0x22,0x37,0x37,0x12,0x48,0xf7,0x32,0x84,0x1e,0x18,0x60,0xab,
+  0x0c,0x93,0xf5,0xf1,0x58,0x02,0x8c,0x30,0x15,0x44,0xe6,0x7a,0x09,0x8c,0x8c,0x8e,
+  0x7b,0xa8,0x45,0xef,0x80,0x72,0xd6,0xe0,0x82,0x1e,0xcb,0x93,0x07,0xc5,0xc0,0x5e,
+  0xaa,0x0e,0x25,0x74,0xd8,0x2b,0x4c,0xfa,0xa1,0x37,0x51,0x3c,0x03,0x5a,0x25,0xd1,
+  0x6a,0xb1,0x2c,0x6f,0x17,0x83,0xb3,0xd8,0x3d,0x20,0x2e,0x4d,0x31,0x73,0x2a,0xc6,
+  0xfc,0xf9,0x6b,0xee,0xe3,0xce,0xf4,0x39,0x45,0x4e,0x11,0xc0,0x2a,0x6a,0x10,0x00,
+  0x0f,0xe1,0xde,0xf6,0x22,0xe1,0xc4,0xcf,0x82,0x75,0xc5,0xab,0x1f,0x36,0x05,0x05,
+  0x68,0x6e,0x77,0xb2,0x13,0x47,0xff,0xb6,0x13,0xfd,0xdc,0x32,0x0c,0x15,0x9e,0xb7,
+  0x70,0xec,0x7b,0x57,0x18,0x34,0xdb,0x33,0x17,0x14,0x59,0xf5,0xaf,0x62,0xd0,0xed,
+  0x10,0x53,0xea,0xe3,0x91,0x96,0x4c,0x70,0x3e,0x1d,0xc8,0xda,0x65,0x61,0x2a,0xb4,
+  0xee,0x6b,0x61,0x1e,0xf4,0xef,0xc1,0xc2,0xac,0x79,0x69,0x93,0x85,0xf9,0xe4,0xdf,
+  0x16,0xe6,0xbf,0xca,0xc2,0x9c,0x2d,0x31,0x3a,0x21,0x55,0x0b,0x45,0x96,0x6a,0x74,
+  0x8a,0x6a,0x28,0xf3,0x0e,0x97,0x7a,0x14,0xaa,0x14,0x15,0x18,0xdc,0x97,0x4d,0x74,
+  0x86,0x86,0x08,0x67,0x71,0x99,0x83,0xb7,0x75,0x86,0x77,0xc3,0x30,0x9b,0xbb,0x51,
+  0x45,0x24,0xc8,0x86,0x28,0x85,0x9b,0x22,0xd3,0xb8,0xc9,0xb6,0xf4,0x62,0x23,0x45,
+  0x6f,0xdc,0xbf,0x53,0x60,0x3a,0x8f,0xf3,0xa6,0x78,0x30,0xb5,0x3e,0xca,0xcb,0x4c,
+  0x7e,0x83,0xc7,0xf8,0x84,0x62,0x29,0x22,0xb6,0x68,0x7e,0x81,0x5a,0xc5,0xdd,0x52,
+  0x9c,0x21,0x08,0xf7,0x3d,0x25,0xc6,0x97,0x78,0x72,0x7d,0xed,0xcd,0x96,0x7f,0x25,
+  0xd9,0x21,0x24,0xf6,0xb6,0xec,0x50,0x40,0x62,0xe2,0xfc,0xaf,0xd8,0x3b,0xf2,0xd0,
+  0x4b,0x75,0x9a,0x04,0x08,0x21,0x9d,0xc9,0xbf,0x20,0xf8,0xf6,0xd2,0x0c,0x07,0xfb,
+  0x13,0x40,0xb3,0x1a,0x18,0xd6,0x8b,0xef,0x86,0xb9,0xee,0x2d,0xec,0x06,0xf7,0x20,
+  0xec,0x6a,0x5e,0xda,0x24,0xec,0x9e,0xfe,0x5b,0xd8,0xfd,0xab,0x84,0x9d,0xc2,0x12,
+  0x88,0x38,0xec,0x96,0xd6,0x0a,0xbb,0x32,0x3a,0x45,0xe0,0x90,0x65,0xa2,0x8b,0xc4,
+  0x69,0x7e,0x9d,0x05,0x62,0x95,0xaa,0x0c,0x96,0x44,0xeb,0x54,0x6c,0x00,0x46,0x3e,
+  0x3c,0x8c,0x86,0x35,0xae,0x36,0x35,0x6f,0x11,0x6d,0xa9,0x61,0x72,0x4f,0x99,0xea,
+  0xea,0x7c,0x65,0x8a,0x4f,0x63,0x83,0xcd,0xf3,0xc3,0xbb,0x1d,0xe7,0x3c,0xc8,0x29,
+  0x5e,0xb0,0xf7,0x19,0xdd,0xf7,0x21,0xa7,0x95,0x93,0xfb,0x87,0xa7,0x2c,0x3b,0xe4,
+  0x74,0xc5,0x82,0xc4,0x53,0x26,0x50,0x9c,0xdb,0xae,0x07,0xe8,0x6b,0x5e,0x73,0x9b,
+  0x3d,0x97,0xbd,0x28,0x5f,0xd2,0x49,0xe9,0xb8,0x4a,0x00,0xde,0xe5,0x0a,0x37,0xc1,
+  0x85,0xd5,0x0a,0x1e,0x18,0x0e,0x05,0x95,0x64,0xe9,0xc3,0x5f,0xf2,0xdc,0x84,0x7d,
+  0x85,0x21,0x4f,0x9b,0xbd,0x8b,0x32,0xb9,0x9b,0x9e,0xf2,0xc0,0x03,0x77,0x10,0x7e,
+  0xe1,0xf9,0xd6,0x04,0x8c,0x73,0x30,0x9e,0x29,0x79,0xb3,0xe8,0x04,0x92,0x9b,0x58,
+  0x99,0x99,0xa7,0x33,0xf0,0x31,0x27,0x7d,0x98,0x4e,0xf7,0xf0,0xb4,0x47,0x3f,0x2c,
+  0x71,0x8c,0x58,0xd4,0x24,0xb2,0x10,0x6d,0x35,0x87,0xce,0x01,0xdb,0xb2,0xc6,0x1f,
+  0xf4,0x9e,0xa8,0x4a,0x4a,0x60,0xc0,0xe1,0xc1,0xed,0x5c,0x64,0x2a,0x95,0x13,0xe5,
+  0x3c,0x57,0xd9,0x64,0x5e,0xa6,0x0f,0xbb,0xd0,0x3a,0x63,0xcb,0x85,0x13,0xcb,0x76,
+  0x22,0x15,0x14,0xa1,0x07,0xcb,0x9c,0x27,0x8e,0xc8,0x3a,0x50,0x23,0x4a,0xc0,0x30,
+  0x13,0xe3,0xc5,0xe4,0xcf,0xe0,0x5e,0x71,0xa7,0x98,0xd2,0x01,0x5b,0xf4,0xd5,0x3a,
+  0x84,0xe1,0xaf,0xba,0xd0,0x02,0x64,0x7e,0x0d,0x82,0xb1,0xc3,0x56,0xa1,0x8f,0x1e,
+  0x33,0xf9,0x1c,0x88,0x02,0xa9,0x61,0x68,0xf7,0x99,0x4e,0x0e,0x89,0x51,0x83,0xe1,
+  0x41,0x5f,0x8d,0x89,0x09,0x61,0x2c,0x00,0x1d,0xe6,0x49,0x27,0xde,0x52,0xad,0x4c,
+  0x84,0xe1,0x63,0x4b,0xb5,0x93,0xe8,0x04,0x77,0x2b,0x4a,0x5c,0x5a,0x0b,0x90,0x8c,
+  0x93,0xc4,0x7c,0xb1,0xf0,0x22,0x1d,0x12,0x17,0xac,0xcf,0x86,0xec,0xf2,0x8b,0xd1,
+  0x66,0x4f,0x3c,0x19,0x8a,0xe7,0x9f,0x81,0x60,0xb8,0x30,0x98,0x53,0xcc,0xb1,0x05,
+  0x08,0xdd,0x38,0x78,0x1c,0x54,0x44,0x30,0x66,0x24,0x59,0x14,0x95,0xe1,0x22,0x0b,
+  0xec,0x30,0x84,0x32,0x0c,0xdf,0x3d,0x90,0x63,0x37,0x45,0x76,0xa4,0xde,0x15,0x4c,
+  0x7f,0xa6,0xf6,0xfb,0x6b,0xd8,0x3e,0x2c,0xa5,0x3b,0xbc,0xd3,0x77,0x56,0xab,0x6d,
+  0x9d,0xc7,0x77,0x49,0x5c,0xab,0x3f,0x3a,0x8c,0xc9,0x7d,0x5e,0xd0,0x64,0xe3,0xc0,
+  0x24,0xca,0x39,0x10,0xfb,0xa4,0x3f,0x47,0x14,0xaf,0xcb,0x4f,0xa3,0xf8,0xde,0x9c,
+  0x23,0x86,0x7a,0xc8,0xbe,0x98,0x95,0x82,0x59,0x2d,0x94,0xbc,0x42,0x9e,0x45,0x87,
+  0xe1,0xf5,0x26,0x50,0x97,0xca,0x97,0xe5,0x1d,0x09,0x2c,0xe0,0xe1,0x92,0xcd,0x02,
+  0x1d,0x0c,0x99,0xdc,0xe2,0xd0,0x2d,0x1c,0xd4,0xc5,0x17,0x51,0x24,0x9b,0x7d,0x27,
+  0xed,0x9a,0x0e,0x05,0xa7,0xd0,0x4f,0x16,0xf1,0x1b,0x71,0x60,0x16,0xed,0x0e,0xa0,
+  0xb2,0x55,0xe0,0x85,0x98,0x58,0x48,0x91,0x1b,0xf9,0x92,0xa9,0xd8,0xda,0x6f,0xc2,
+  0x65,0x25,0x7a,0x90,0xb8,0x77,0x86,0x44,0xa9,0x67,0xd3,0x41,0x34,0xd5,0xa0,0xfe,
+  0xe0,0x61,0xa9,0x41,0xe5,0xd9,0xc3,0xbc,0x85,0xb6,0x8f,0xa8,0x77,0xbb,0xc7,0x3d,
+  0x51,0x35,0x6c,0xf0,0xbb,0x59,0xcf,0x9d,0x37,0x46,0xd5,0x48,0xa5,0x63,0x99,0xb2,
+  0xec,0xf7,0xb3,0x35,0x5a,0x45,0x72,0x3c,0x74,0x77,0x12,0x5c,0x10,0x25,0x61,0x13,
+  0xbd,0xc9,0xfa,0x5a,0xf4,0x94,0xea,0xab,0xb0,0x93,0x37,0xd0,0x90,0xa3,0x75,0xba,
+  0x47,0x5a,0x93,0xa3,0x06,0xbf,0x8b,0xa5,0xdc,0x99,0xcc,0xe4,0x40,0x3a,0x95,0xc9,
+  0xa2,0x7f,0xfe,0x19,0x48,0x71,0xe8,0xf1,0xb8,0xdf,0x57,0x91,0xe3,0x22,0x8e,0x4d,
+  0x17,0x81,0x34,0x6d,0x50,0x80,0x0f,0x59,0x6c,0xcb,0x97,0x72,0xd7,0xaa,0x76,0x0a,
+  0x87,0xf7,0xa6,0x97,0xd4,0xde,0x3b,0x33,0x65,0x60,0x33,0xa3,0x6d,0x6e,0x6b,0xc7,
+  0x5e,0x3c,0x25,0x71,0xe6,0x3d,0x96,0x51,0xc0,0xad,0xbb,0xea,0xae,0xf9,0x2a,0x01,
+  0xf8,0x24,0xdb,0x3a,0xac,0xb3,0xad,0xa1,0xa4,0xbf,0x0d,0x6f,0x15,0xd1,0x7e,0x80,
+  0x7b,0x5a,0xa3,0xae,0x64,0x04,0x77,0xce,0x45,0xd6,0x13,0x9e,0x0b,0x42,0xcf,0x36,
+  0x04,0x63,0x14,0xb0,0xe2,0xcc,0x66,0x51,0x10,0x44,0x94,0xf6,0x4e,0xaa,0x11,0x37,
+  0xe8,0x51,0xf5,0xe1,0x66,0x3d,0x5e,0x97,0xe5,0xae,0xfc,0x46,0x44,0xad,0xd7,0x4b,
+  0x57,0x86,0xea,0xbf,0x93,0x5b,0xfd,0xb5,0xe6,0x46,0x91,0x0b,0x90,0x6f,0x39,0xe1,
+  0x19,0x22,0x84,0x1d,0xd8,0x85,0xeb,0xbc,0xfb,0x46,0x66,0x5f,0xde,0xad,0x21,0xaf,
+  0x6f,0x34,0xca,0x9d,0x5b,0x79,0x02,0xea,0x17,0xb9,0xb7,0x5b,0x33,0xfc,0xda,0x69,
+  0x98,0x60,0x69,0x02,0x07,0xf7,0x32,0x81,0x12,0xdd,0x2b,0xc2,0xda,0x4f,0xe7,0xe3,
+  0xf4,0x9a,0x44,0xb0,0xac,0xaf,0x95,0x5b,0xa5,0xfa,0x2a,0xb9,0x95,0x37,0xd0,0xe4,
+  0x96,0xd6,0xe9,0x1e,0x45,0xb0,0x1c,0x35,0xf8,0x5d,0x2c,0xe5,0xce,0x22,0x58,0x0e,
+  0xa4,0x8b,0x60,0x59,0xf4,0x3b,0x4a,0x81,0xaa,0xa2,0xb3,0x7d,0x14,0x3d,0x8a,0xb6,
+  0x26,0x2a,0x93,0xf5,0xb5,0xa8,0x29,0xd5,0x57,0xa1,0x26,0x6f,0xa0,0xa1,0x46,0xeb,
+  0x74,0x8f,0x54,0x26,0x47,0x0d,0x7e,0x17,0x4b,0xb9,0x33,0x95,0xc9,0x81,0x74,0x2a,
+  0x93,0x45,0xff,0x1f,0x28,0x7a,0x79,0x49,0x5e,0xb4,0x48,0x9c,0x78,0x79,0x5b,0xab,
+  0x30,0x30,0x75,0x9f,0xd2,0xfb,0x4f,0xe3,0xed,0xdb,0x45,0xd2,0x55,0x8c,0x17,0x15,
+  0xda,0x8b,0x28,0x5a,0x80,0x8e,0xc2,0x2c,0xe7,0xc0,0x89,0xd3,0x9e,0x13,0xa6,0x6b,
+  0x9e,0xf4,0x06,0x4f,0x0e,0x47,0x4f,0x9f,0xcd,0xa2,0xf1,0x97,0xaf,0xdf,0xbd,0x7d,
+  0x6d,0x7f,0xf0,0x9d,0x0c,0x27,0xfc,0xf9,0xe8,0xd5,0x2b,0x9e,0x02,0x33,0xc6,0x8f,
+  0x96,0xfe,0x18,0x81,0xb9,0x19,0x3a,0xfe,0x2a,0x5a,0xe3,0x32,0xe6,0x1e,0xb8,0x7a,
+  0xe2,0xa8,0x83,0x93,0x79,0xd9,0xca,0x25,0x5f,0x92,0x42,0x0e,0xf4,0x4b,0x44,0x92,
+  0xe3,0x1d,0xf3,0x56,0x5a,0x24,0x93,0x7d,0x76,0x70,0x97,0x37,0xe8,0x27,0xce,0xba,
+  0x8e,0x20,0xa1,0xb6,0x96,0x18,0xf3,0xba,0x2a,0x42,0xa4,0x4a,0x41,0x84,0xb3,0x28,
+  0x4a,0xdc,0xbc,0x39,0x91,0x60,0xf7,0x69,0x7e,0xfb,0x40,0x9e,0xd5,0xd2,0xb7,0xf7,
+  0x24,0x43,0x18,0x48,0x27,0x41,0xf8,0xf9,0x5b,0x93,0xdf,0x9f,0x75,0x9c,0x74,0xd4,
+  0xa9,0x90,0x90,0x3b,0x18,0xd5,0x62,0x78,0x49,0xe3,0x52,0x1c,0xc2,0x72,0xf9,0x22,
+  0xe1,0xdc,0x66,0xef,0xf8,0xc2,0xc1,0x3d,0x64,0x75,0x50,0x99,0xa2,0x6b,0xd1,0x2a,
+  0x5b,0x36,0x09,0xc8,0x2d,0x14,0x16,0x78,0xdf,0x89,0xc3,0x61,0x23,0x0e,0x87,0x0d,
+  0x38,0x1c,0x36,0xe1,0x70,0xb8,0x85,0xc3,0x61,0x81,0xc3,0xc1,0x13,0x85,0x44,0x7a,
+  0xba,0x33,0x16,0x87,0x65,0x2c,0x0e,0xff,0x39,0x58,0x54,0x40,0xfd,0xa5,0x68,0x5c,
+  0x63,0x20,0xb3,0xf6,0x6c,0x9d,0x7e,0x28,0x68,0xc3,0xa6,0x2c,0x8e,0x0e,0x35,0x18,
+  0x95,0x83,0x83,0xdd,0x36,0xdc,0x8e,0x15,0x92,0x79,0xfe,0x23,0x40,0xc5,0x48,0xe5,
+  0x54,0x44,0x0c,0x17,0xa7,0x66,0x02,0xb4,0xba,0xaf,0xce,0xce,0x2b,0x8e,0x5e,0x9d,
+  0x9d,0x8b,0x1c,0xfb,0xd2,0x09,0xa9,0xfc,0x64,0x54,0xe2,0x90,0xa3,0x90,0xc1,0xc4,
+  0xf2,0xcb,0xb1,0xf8,0xce,0xeb,0xad,0xa4,0x07,0x20,0x02,0x55,0xc1,0x0a,0x80,0x5c,
+  0x71,0xb8,0xaa,0x00,0x99,0xf2,0x31,0xa0,0x7b,0x87,0xc9,0xac,0xa3,0xf2,0x69,0x2a,
+  0x79,0xad,0x0b,0x25,0x06,0x4c,0x79,0x3e,0x12,0xa5,0x5a,0x6d,0x22,0xa5,0xb7,0x02,
+  0xe0,0xf7,0x5c,0xef,0x1a,0xef,0x62,0x9f,0x25,0x5e,0xac,0xdf,0x92,0xd5,0xfb,0xc1,
+  0xb9,0x76,0x44,0xa9,0x31,0x79,0x30,0x5f,0x85,0x14,0x2c,0x66,0xdc,0xf4,0x5c,0xeb,
+  0x27,0x15,0xf6,0x77,0xa3,0xd9,0x2a,0x00,0xaa,0xb0,0x41,0x58,0xbf,0xf6,0x39,0x3e,
+  0xbe,0xb8,0x7d,0xeb,0x62,0x9b,0x13,0xf6,0xa9,0xe8,0xa5,0xf1,0xcc,0x2c,0x4b,0x7c,
+  0x18,0xa0,0xae,0x27,0x56,0xb7,0x5b,0xd8,0xb2,0xe1,0x8a,0x54,0x6d,0xe4,0x12,0x3f,
+  0xfe,0x8a,0xb1,0x91,0x49,0xca,0x23,0x17,0x4c,0x8d,0xfd,0xf0,0xa0,0xda,0x4f,0x0c,
+  0x9f,0xd8,0xb8,0xf1,0x05,0xd8,0x10,0xef,0xc4,0xa4,0x1f,0xb6,0x4c,0xff,0x73,0x2d,
+  0x09,0xb1,0x13,0x1a,0xc2,0x26,0x6e,0x81,0x81,0x62,0xbc,0xf3,0xf7,0x6d,0x98,0x99,
+  0xf4,0xf0,0xc6,0x8f,0x9c,0xcc,0xdc,0x31,0x78,0xbb,0x05,0x82,0x0c,0xe6,0x4f,0x43,
+  0x58,0x5f,0x0c,0xfa,0x2a,0x23,0x92,0x16,0xbf,0xb5,0x02,0xb4,0x6f,0x7e,0xbb,0xf9,
+  0x9b,0xf9,0x02,0x76,0xce,0x7a,0x59,0xcc,0xf9,0xa8,0x6f,0xb1,0x36,0xdb,0xbf,0x6b,
+  0x90,0x77,0x6d,0x5c,0xaa,0x42,0xff,0x8e,0xb9,0xab,0x62,0x98,0x7e,0x96,0xac,0xf8,
+  0x09,0xf3,0x39,0x66,0x29,0xe1,0x6f,0xaa,0xc7,0xe3,0x33,0x67,0x1e,0xde,0x65,0xbd,
+  0x20,0x38,0x60,0xd5,0xa3,0x47,0xd8,0xc2,0xce,0x9c,0x05,0xde,0x66,0x39,0x1e,0x8f,
+  0x8d,0xb3,0x0f,0xcf,0xdf,0x19,0x16,0x95,0x8a,0x8b,0xb5,0xdf,0x45,0x2e,0x97,0xd7,
+  0xf6,0xbe,0xc4,0xfb,0xd6,0xb1,0x1f,0x02,0x92,0x06,0xce,0x97,0x88,0xb9,0x8d,0x19,
+  0x97,0xab,0x34,0x0d,0x64,0x47,0xc3,0x12,0x53,0xc0,0x0b,0xfc,0x10,0xa4,0x34,0x09,
+  0x10,0x75,0xc5,0xed,0x7f,0x62,0x98,0xe2,0x6a,0x3f,0x68,0x65,0x48,0x33,0x5a,0x13,
+  0x72,0x2d,0x71,0xfb,0x7a,0x6b,0x62,0xb4,0x4d,0xec,0xf9,0xcc,0xc0,0x2b,0xfe,0xf0,
+  0x32,0xb7,0x63,0x43,0x9c,0x16,0x35,0xac,0xb6,0xb1,0x71,0xe7,0xa9,0x21,0x81,0xa2,
+  0xad,0xc1,0x03,0x31,0x92,0x64,0x2f,0x38,0x18,0x66,0x1c,0x17,0xd1,0xd9,0x84,0x8a,
+  0x9c,0xef,0xcd,0x32,0x81,0x89,0x84,0x7c,0xcd,0xfe,0xf4,0xcd,0xd7,0x5f,0x81,0xfd,
+  0x87,0xb7,0x04,0x82,0xe8,0xc7,0x5d,0x41,0xa8,0xb3,0xa3,0x10,0xd6,0xea,0xde,0xd2,
+  0xad,0xab,0x42,0x5c,0x43,0x73,0x85,0x30,0x53,0xe0,0x09,0xdb,0x51,0xab,0x33,0x6c,
+  0x35,0x1e,0x1f,0x48,0x1a,0xd5,0x91,0x24,0x2e,0x2c,0xc4,0x1b,0x76,0xd3,0x08,0x38,
+  0xd6,0x8f,0x16,0xd8,0x4d,0xd0,0x28,0xf6,0x17,0xbb,0x88,0xe3,0xf1,0x10,0x2c,0x5d,
+  0xc0,0x93,0xf9,0x90,0x00,0xf9,0xf3,0xcf,0x4c,0x0c,0x9e,0xc6,0xd0,0x91,0x9f,0xc3,
+  0xf4,0x25,0x44,0xb9,0x6b,0x58,0x1a,0x95,0x10,0xa4,0xc5,0x8d,0xae,0x50,0xca,0xcd,
+  0xfc,0x52,0x69,0xab,0x0c,0xf0,0xd3,0x58,0xc1,0x39,0xba,0x6a,0x89,0x9b,0x61,0x99,
+  0x58,0x56,0x8a,0x37,0x5e,0xfb,0x1e,0x1d,0x82,0x88,0xd1,0x2a,0x36,0x80,0xba,0x4d,
+  0x18,0x49,0xdc,0x8d,0x2a,0x69,0xf7,0x19,0x33,0xde,0x81,0x11,0x8b,0x7b,0x49,0x20,
+  0xae,0x48,0x3f,0x44,0xb8,0xa8,0x50,0xee,0x48,0x9c,0xa6,0x59,0x02,0x9a,0x17,0xb0,
+  0x87,0x1f,0xd0,0x78,0x1d,0x82,0x29,0xe5,0xf1,0x74,0x6b,0x18,0x40,0x21,0x5e,0x1c,
+  0x4e,0x4d,0xd5,0xfb,0x40,0x51,0xa5,0xab,0xd9,0x8c,0xa7,0xe9,0x7c,0xe5,0x77,0x34,
+  0xe5,0x24,0x12,0x08,0x65,0x78,0x0a,0x0f,0x28,0xbe,0xfd,0xa0,0xee,0xef,0xb3,0xd9,
+  0x39,0x05,0x9a,0xc4,0x26,0x9d,0xc8,0x25,0xa5,0xcb,0xbf,0xc5,0xc5,0xc0,0xce,0x02,
+  0xd4,0x65,0xe7,0x57,0xce,0x8f,0x6c,0xf3,0x6b,0x2f,0xf5,0x50,0x61,0x3a,0x59,0xe9,
+  0xed,0xa6,0xd4,0xae,0x81,0x07,0x13,0xc0,0xfd,0x4b,0xbc,0xa1,0x55,0x6d,0xd0,0xe0,
+  0x86,0xec,0x61,0x7e,0xd5,0x03,0x1d,0x5f,0xa1,0x8b,0x93,0x69,0x56,0xb6,0x55,0x2c,
+  0x9b,0x92,0x5d,0x76,0x2f,0x5d,0xcd,0xfd,0x31,0xfc,0xaf,0x80,0x1e,0x33,0x8e,0x99,
+  0x61,0xa0,0x28,0x32,0xf6,0x81,0x85,0x99,0x70,0x4b,0x83,0x87,0xa0,0x80,0x50,0x5e,
+  0x72,0xab,0xde,0x40,0x17,0xa9,0x57,0x01,0x20,0xbf,0xfb,0x5c,0x9e,0x07,0x7d,0x6c,
+  0xd3,0xff,0xb5,0x26,0xf2,0x21,0xbf,0xdd,0x1c,0x39,0xd2,0x07,0x75,0x8d,0x99,0x34,
+  0x60,0x0f,0x9b,0x94,0xc9,0x86,0xc2,0x8e,0x71,0xe0,0x03,0xf6,0xd3,0x5e,0xa2,0x00,
+  0x49,0xb4,0x24,0x06,0x80,0xe8,0x49,0x0a,0x20,0xf1,0x13,0x86,0x24,0xf3,0xc3,0x4a,
+  0xd5,0x8b,0x36,0x58,0xb3,0x2c,0xd9,0xf6,0x90,0x74,0x9f,0x3a,0x83,0xc3,0x7e,0xdf,
+  0x12,0x57,0xfd,0xd3,0x5c,0xf7,0x99,0x29,0x7d,0x04,0xa2,0xb5,0x45,0x55,0x49,0x82,
+  0x36,0x08,0x31,0x7a,0x69,0xbe,0x22,0xaf,0x6f,0xac,0xcf,0x1b,0x8b,0xdc,0xf7,0x2b,
+  0x20,0xa1,0x4c,0x94,0x88,0x29,0xd4,0x80,0x11,0x56,0x86,0x50,0x81,0x35,0x92,0x8c,
+  0x8a,0x79,0x68,0x1a,0x1f,0xde,0x9f,0x9d,0x1b,0x1d,0x66,0xd8,0x3d,0xf8,0x2f,0xea,
+  0x04,0x29,0xc1,0xe0,0x25,0x52,0xa6,0x7d,0x05,0x32,0x8a,0x27,0xa6,0xf1,0x52,0xc8,
+  0x86,0xee,0x39,0xde,0xd7,0x0c,0x3d,0x88,0xf1,0xc5,0xfd,0xf5,0xbd,0x9b,0xee,0x7a,
+  0xbd,0xee,0xa2,0x20,0xe9,0xae,0x12,0x4c,0x11,0x07,0x30,0xb9,0x46,0x3e,0x54,0xe8,
+  0x9a,0x4a,0xa0,0x8f,0x8d,0x3c,0x71,0x02,0xa7,0x8a,0xc2,0x14,0x05,0xdd,0x4f,0x9f,
+  0x4e,0x6a,0xa4,0x92,0x48,0xc6,0x24,0x5e,0xa3,0x9b,0xa2,0x15,0xaf,0x81,0xb0,0x74,
+  0x00,0xce,0x06,0x10,0xf2,0x26,0x1f,0x22,0xb8,0x01,0x5e,0x58,0x4c,0xd7,0x20,0x97,
+  0x8b,0x45,0x37,0xbc,0x2c,0x5a,0xf4,0xbc,0xf2,0xf4,0x06,0xfd,0xa2,0x05,0x8f,0xa1,
+  0x85,0xcb,0xe7,0xce,0xca,0xc7,0x4f,0xbc,0x80,0xac,0xbe,0xc2,0x29,0xbb,0x36,0xbd,
+  0x0c,0x1a,0x6f,0xbe,0xf7,0x04,0xeb,0xf0,0x8d,0xb2,0x4e,0x7f,0x39,0xd5,0x5d,0x79,
+  0xba,0xdd,0x53,0x7e,0x79,0x41,0xe6,0xee,0x85,0x04,0xc3,0x65,0x59,0x25,0x8a,0x5b,
+  0x5b,0x9f,0x69,0x56,0xc8,0x71,0x31,0x58,0x51,0x68,0x29,0x1d,0x24,0xf0,0xfb,0xfc,
+  0xfc,0xe5,0x57,0x02,0xc1,0x8a,0xb3,0x7f,0x0d,0xa2,0x7f,0xc0,0xe3,0xec,0x3a,0x5e,
+  0xff,0xd7,0xd9,0xfb,0x77,0xa0,0x86,0xd0,0x32,0xf7,0xe6,0xb7,0xa6,0x6b,0x95,0x6d,
+  0x13,0x75,0xd9,0xfe,0x4f,0x0f,0x18,0xeb,0xf5,0xce,0x68,0x23,0xc3,0x21,0xc5,0x29,
+  0xef,0x9b,0x07,0x69,0x82,0x24,0xc8,0xec,0x9e,0xb8,0x5a,0xbe,0x23,0xd2,0x24,0x50,
+  0x60,0xbf,0xfc,0xf6,0x65,0x77,0x34,0x04,0xcf,0x58,0x13,0x6d,0xb8,0x9f,0x4d,0xc7,
+  0xee,0x48,0x24,0x26,0x09,0xb8,0x5f,0x2e,0xa6,0x59,0x3b,0x20,0x98,0xe8,0xce,0x0a,
+  0xc7,0x05,0xf7,0x53,0xdc,0x8b,0x4f,0x79,0xe9,0x26,0x72,0xaf,0x12,0x55,0xf6,0x2c,
+  0x8e,0x2d,0x98,0x09,0xea,0x53,0x90,0xb4,0x02,0x4d,0xea,0x7e,0x7f,0xcb,0xc6,0x3f,
+  0xe9,0x45,0xff,0x92,0x48,0xf1,0xe1,0x3c,0xb7,0x9d,0xf2,0x1e,0xf0,0xff,0xaa,0x8b,
+  0xcc,0xdf,0xb1,0x4e,0xd4,0x6f,0x71,0xbb,0xb3,0xb5,0x6d,0x62,0x55,0xb1,0x22,0x8c,
+  0x38,0xb7,0x61,0xfa,0xce,0xed,0x8b,0x15,0x9e,0x7d,0x37,0x2d,0x1b,0x4f,0x6a,0x14,
+  0x72,0x68,0x4a,0x10,0x53,0xef,0x75,0xa4,0xb1,0xf1,0x47,0x58,0xe9,0x93,0xe7,0xd8,
+  0x0d,0x1a,0x08,0x4b,0x04,0xcd,0xa6,0xee,0xe0,0x84,0x1a,0x03,0xcb,0x98,0x64,0xd0,
+  0x8d,0xfb,0xb0,0x84,0x53,0xc7,0x16,0x59,0x33,0xf0,0xdc,0x6e,0x23,0xbf,0xb0,0xef,
+  0xc7,0xcc,0xb9,0xf0,0x2e,0x4f,0xf2,0x96,0x57,0xd8,0xf2,0xea,0xf4,0x09,0xfc,0x07,
+  0x9a,0x30,0x61,0x83,0x4d,0x26,0x93,0x81,0xc5,0xbe,0x67,0x66,0xff,0xe6,0xf5,0xab,
+  0x17,0x4f,0x9e,0x8c,0x86,0x60,0x5c,0xb0,0xae,0x39,0x7b,0x34,0x10,0xd8,0xa5,0x89,
+  0x61,0x53,0x73,0xf6,0x7d,0x77,0x60,0x41,0xfb,0x3e,0xcc,0x3f,0x3a,0x23,0x2a,0x30,
+  0x07,0x47,0x96,0x98,0xce,0x0e,0x43,0x89,0xda,0x20,0x1d,0x09,0x1a,0x01,0x9b,0x09,
+  0xbc,0x99,0x05,0xe5,0x2a,0x68,0xb6,0x12,0xbf,0x46,0x19,0x90,0xed,0x6d,0x00,0x0a,
+  0xd4,0x6b,0x17,0xdc,0x33,0xa3,0xfd,0x0d,0xb8,0xa7,0xf6,0xdc,0x07,0x7f,0xc6,0x1c,
+  0xf4,0xfb,0x5f,0xf0,0x6b,0x1b,0xdb,0x70,0xb7,0x07,0x4f,0x19,0xe0,0xce,0x07,0x31,
+  0xfb,0x79,0x21,0x67,0x3f,0x15,0x53,0xfb,0x85,0x76,0x1c,0xf5,0x67,0x0d,0x94,0x21,
+  0xed,0xba,0xfd,0x24,0xba,0x1c,0x6d,0xdb,0xe4,0xb3,0xf6,0x01,0x0c,0xaa,0xc3,0x57,
+  0xe0,0xe0,0x3d,0x64,0xdf,0x8a,0x8f,0x2d,0xe8,0xb0,0xf9,0xf5,0x5f,0x25,0xd9,0xfa,
+  0xd4,0x89,0x9d,0x03,0x52,0x41,0x01,0x65,0xda,0x1e,0x13,0xbd,0x9b,0x36,0xa4,0xc1,
+  0x3f,0x95,0x70,0xb5,0xa1,0xcf,0x84,0x3c,0xc9,0x85,0x5d,0xde,0x6e,0x5b,0xe0,0x3d,
+  0x5f,0x65,0xcb,0x28,0xf1,0x7e,0xa4,0x55,0x63,0xe7,0x17,0x18,0xf4,0x49,0x80,0x72,
+  0x04,0x06,0xf1,0x83,0x1d,0xb9,0x94,0x6e,0x18,0xe7,0x4f,0x5d,0x10,0x59,0xa3,0x21,
+  0x8c,0x30,0x6b,0x6c,0xd7,0x24,0x60,0xa3,0x59,0xc6,0xf1,0x5b,0x69,0x40,0x51,0xa0,
+  0xfe,0xf4,0x51,0x40,0xd8,0x4e,0xa9,0xe0,0x13,0xfc,0x57,0x13,0xb1,0x98,0x62,0x36,
+  0xbd,0xcd,0x00,0x56,0x08,0x28,0x29,0x69,0x5f,0x8a,0xcf,0x7a,0x14,0x49,0x68,0x94,
+  0x02,0xb8,0x4e,0x3c,0x30,0xc1,0x43,0x15,0x5b,0x21,0x91,0x8a,0x29,0x7b,0x32,0xc9,
+  0x0b,0x47,0x41,0xcd,0x2d,0x24,0xa9,0x2c,0xb5,0x97,0x16,0xeb,0x52,0x76,0xe1,0x9a,
+  0x72,0xcd,0xc4,0x97,0xab,0x02,0x2e,0x92,0xc8,0xc4,0xf7,0x2f,0x40,0x2a,0x1b,0x59,
+  0x2e,0x25,0x31,0x50,0x81,0x3c,0x8c,0xd3,0x01,0x1a,0xa2,0x6f,0x10,0x98,0xbd,0x8f,
+  0x69,0xfb,0x0f,0xbd,0x0e,0xd8,0x9c,0x36,0xd8,0xa5,0x1e,0xf8,0x7f,0x1f,0x73,0xef,
+  0x6f,0x0a,0x8d,0x2f,0x2e,0x71,0x69,0x40,0xe3,0xd4,0x5b,0x4a,0xae,0xc9,0x81,0x25,
+  0xde,0x0c,0x56,0x2a,0x5e,0xde,0xa3,0x8e,0xfd,0xe0,0x9d,0x1c,0x11,0xbc,0xe9,0x40,
+  0x2c,0x8d,0xa8,0x41,0xf4,0x03,0xc1,0xf6,0xda,0x01,0x73,0x21,0xe7,0x51,0x4a,0x98,
+  0x0c,0x4b,0xd2,0x14,0x56,0xa0,0x73,0x31,0xc6,0x06,0xd4,0x4b,0x30,0x5b,0x0f,0x6c,
+  0xc7,0xb0,0x3d,0x00,0x5a,0x3b,0xc6,0xd7,0x7d,0x34,0x32,0xda,0x40,0x30,0xda,0x59,
+  0x2e,0x19,0xa4,0xfa,0x48,0x9c,0x59,0x69,0x9c,0x0e,0x68,0x1e,0x14,0xb3,0x54,0x1b,
+  0x20,0x00,0xec,0xc0,0x41,0xdb,0xa5,0xf7,0xbd,0xf9,0xd1,0x6d,0x5b,0xe6,0xb3,0xe3,
+  0x8f,0x3d,0x7a,0xb2,0x9e,0xfd,0xa1,0x67,0x9d,0xc8,0x96,0xd7,0x28,0x49,0x83,0x67,
+  0x6c,0x78,0xd0,0xff,0x22,0xb8,0x18,0x5c,0xf6,0xcc,0xe0,0x62,0x78,0xf9,0xf3,0xcf,
+  0x03,0xeb,0x18,0x24,0xbb,0x30,0xdb,0x1e,0x9a,0xd7,0x93,0x31,0x0c,0x8f,0x4e,0xde,
+  0xf5,0xe9,0x78,0x78,0x78,0x48,0x4f,0xe3,0xb1,0x26,0xda,0xae,0x2d,0xcb,0xc2,0xb5,
+  0x99,0x59,0xc1,0xb0,0xd7,0xf9,0x9c,0x49,0x57,0x60,0xce,0xa0,0xa6,0x2f,0x10,0x36,
+  0x05,0x82,0xcc,0x0b,0xd3,0xfa,0x78,0x71,0x69,0xf5,0x16,0x1d,0x83,0xfd,0x61,0xc0,
+  0x00,0x53,0x05,0xf2,0x2e,0xa9,0xf4,0x12,0xca,0x40,0xc8,0x07,0xa6,0x42,0x22,0x62,
+  0xb5,0x67,0x6d,0x43,0x3d,0xeb,0x78,0xb9,0x14,0xc4,0x37,0x07,0x9a,0x10,0xcb,0x30,
+  0x84,0x60,0xe8,0xca,0x35,0x97,0x12,0x58,0x0b,0xfa,0x17,0xea,0xc9,0xf4,0x0b,0x74,
+  0x6b,0x29,0xb3,0x41,0x90,0xa6,0x52,0xc5,0x58,0x02,0x2c,0x1e,0xba,0xba,0x0f,0xcd,
+  0x60,0x32,0x3e,0x24,0xff,0x37,0x38,0x1d,0x0f,0x86,0x8f,0xe5,0xf3,0xe7,0x87,0xfd,
+  0xf1,0xb8,0xaf,0xc1,0x64,0x6a,0xc7,0xab,0x74,0x09,0x5a,0xed,0x60,0xd4,0x09,0x7a,
+  0x87,0xfd,0x5c,0x97,0x6d,0xbd,0xdd,0x87,0xe9,0x15,0xad,0x07,0x1d,0x44,0xf5,0xc6,
+  0x04,0x3a,0x38,0x87,0xea,0xde,0x8b,0x52,0xef,0x61,0x65,0xef,0x7e,0x45,0x6f,0xe8,
+  0x9a,0x94,0xba,0xf6,0x2b,0xdb,0x98,0x06,0x2e,0x8f,0x70,0x79,0xda,0x47,0x7a,0x93,
+  0x58,0x9d,0xe6,0xea,0x5e,0x8d,0x50,0xb5,0x40,0x18,0xc0,0x2a,0x06,0x98,0x8c,0xfb,
+  0x42,0x89,0xa9,0xce,0x5d,0x31,0xee,0x08,0x01,0x5b,0x2e,0x9b,0x0c,0x0e,0x04,0x28,
+  0x0d,0x99,0x7c,0x8a,0xc1,0x70,0xe0,0x95,0x72,0xab,0x2e,0x32,0x8e,0xc8,0xcf,0x45,
+  0xee,0x9e,0x5e,0x50,0x29,0x1a,0xb2,0x08,0x8a,0xf6,0x66,0xe3,0x13,0x9d,0x26,0x2b,
+  0x27,0x7b,0xa1,0x43,0xe4,0x70,0x1b,0x22,0x65,0x3e,0xfb,0x78,0x89,0x4c,0xf6,0x45,
+  0xc1,0x64,0x9b,0x54,0x84,0x0c,0xf6,0xf3,0xcf,0x43,0x41,0x3e,0xc1,0xe9,0x10,0xd7,
+  0x19,0x4c,0xc0,0x64,0xd9,0xa6,0x92,0xc3,0x7e,0x3b,0x20,0xfe,0xdb,0x9c,0x56,0xef,
+  0xfb,0x8b,0x76,0xf7,0xf2,0x19,0xbc,0xe3,0x0f,0x3d,0x1b,0xaf,0x34,0x82,0x7e,0x08,
+  0x51,0xe2,0x45,0x67,0x0a,0x72,0xd8,0x3a,0x1d,0x8f,0x06,0xda,0xbc,0x87,0xfd,0x76,
+  0x41,0xc7,0x1b,0x98,0x97,0xef,0x15,0xfa,0x4c,0xfe,0x45,0x4f,0x48,0xa1,0x47,0xc2,
+  0x1c,0xa3,0xbd,0xf8,0xe1,0xb9,0x14,0x8f,0xcd,0x52,0xa5,0xd2,0x0e,0x05,0xb6,0x1f,
+  0xa8,0x11,0x24,0xf7,0x4f,0xb7,0xf4,0x04,0xa9,0xd2,0xa9,0xd4,0x11,0xe2,0xf4,0x22,
+  0x7e,0x6e,0x80,0xbe,0x63,0x50,0xe8,0x91,0xc2,0x44,0x5e,0xcc,0x5c,0x5d,0xc4,0xdd,
+  0x74,0x6e,0x8b,0xf8,0xb7,0x79,0xfb,0x0c,0xeb,0xcd,0xdb,0xce,0xcd,0xe7,0xb7,0x20,
+  0xab,0x6e,0x2c,0x29,0x6c,0xaa,0xc5,0xe3,0x75,0x2e,0x1a,0x71,0x48,0xec,0x78,0xdd,
+  0x19,0x22,0x89,0xe7,0xe3,0x5d,0x3f,0x63,0xd7,0x3d,0xb7,0x6d,0xba,0xa7,0x50,0xfe,
+  0x8c,0x19,0x3d,0xa3,0x0d,0x0f,0x3d,0x97,0x22,0x15,0xc7,0xe8,0x9a,0xa9,0x37,0xa0,
+  0x48,0x51,0x5a,0xe6,0xe2,0x12,0x34,0xbc,0xfc,0x8b,0xee,0x55,0x1f,0x1b,0xd0,0x61,
+  0x40,0xd3,0x3b,0x55,0xf4,0x56,0x92,0xff,0x51,0x8c,0xdc,0x72,0x01,0x46,0xf1,0x65,
+  0x0e,0xee,0x28,0x1e,0x13,0x2b,0x08,0x2d,0x42,0x00,0xcd,0xec,0x1f,0x22,0x0f,0x2c,
+  0x0a,0x10,0x84,0xf0,0x5e,0xf1,0x0a,0x45,0x0c,0x8a,0x14,0xa2,0xf8,0x94,0xf8,0x14,
+  0x48,0x90,0xfa,0x44,0x71,0x17,0xb1,0x2d,0x31,0x53,0xb4,0x82,0xc1,0xf5,0x66,0xc8,
+  0xe7,0x95,0x4d,0x06,0x45,0x13,0xdf,0x68,0x93,0xe0,0x10,0x13,0xb5,0xaa,0xdb,0x0f,
+  0x8b,0xf6,0x8b,0x7d,0xda,0x8f,0x8a,0xf6,0x81,0xd1,0x16,0x4d,0xbf,0x38,0xdc,0x9e,
+  0xef,0x29,0xf1,0xda,0x4f,0x79,0x63,0xd3,0x68,0x93,0xdb,0x61,0xe3,0x5e,0x11,0xb0,
+  0x7c,0x0a,0xf6,0x0a,0xc0,0xb7,0xe3,0xb5,0x69,0xc5,0x30,0x8f,0x4e,0x41,0x24,0x05,
+  0x89,0xdc,0x10,0x34,0x00,0x68,0x56,0x01,0xcb,0x36,0xc8,0x1f,0x64,0x3f,0xd6,0x1e,
+  0x33,0xd9,0x79,0x1b,0xaa,0x38,0xd9,0x43,0x0d,0x5e,0x17,0x25,0x78,0xa9,0xd2,0xcb,
+  0x2f,0x40,0xfe,0xd0,0x18,0xc0,0xab,0x52,0x1e,0x7f,0x2a,0xc8,0x5f,0xe0,0x52,0xbc,
+  0x98,0x8c,0x8d,0x07,0x9b,0xfb,0x03,0xe2,0x20,0x87,0xee,0x9b,0x16,0xe6,0x52,0xe1,
+  0x98,0xd2,0xef,0x2d,0x1f,0x50,0x3f,0xc5,0xa1,0xec,0x18,0x9c,0x40,0x96,0xd0,0x17,
+  0x1c,0x51,0x2c,0xe5,0x0c,0xa5,0x9a,0x97,0x7c,0xfd,0x19,0xc9,0xac,0x9b,0xfd,0xdc,
+  0x9b,0x6a,0xe3,0xf8,0xa6,0x14,0x1f,0xca,0xa3,0x2a,0x30,0x8b,0xd2,0xd6,0x90,0x7a,
+  0xf9,0xc9,0x5d,0x1c,0x29,0x11,0x36,0xaf,0x08,0x99,0x57,0xbb,0xb3,0xbb,0x9d,0xbd,
+  0x5f,0xeb,0x4f,0xdd,0xc1,0x59,0xda,0x63,0x99,0x40,0x39,0x1b,0xde,0x14,0x48,0x1c,
+  0xf4,0x95,0x44,0xa0,0x10,0xc4,0xcd,0x1e,0xfe,0xc8,0x86,0x43,0x22,0xdd,0x91,0x2a,
+  0x67,0x44,0x60,0x40,0xf3,0x45,0xee,0xc3,0x33,0xc8,0xfd,0x82,0xad,0xd8,0x40,0x99,
+  0xd6,0xd1,0x8b,0xd3,0x68,0x7d,0x9f,0x0d,0x8c,0x7c,0xef,0x00,0x26,0x82,0x10,0xa4,
+  0x58,0xc5,0x94,0x62,0x15,0xc6,0xaf,0x42,0x26,0x2a,0xca,0x2d,0x37,0x76,0x93,0x3f,
+  0x24,0xf3,0x10,0xa0,0x37,0xd6,0xa6,0x4f,0xce,0x52,0xfa,0xa0,0x80,0xf8,0x97,0xaf,
+  0x2b,0x01,0x5e,0x80,0xaa,0x0c,0x19,0x1d,0x9b,0x3f,0x49,0xd6,0x95,0xd2,0xc3,0x78,
+  0x8d,0xf8,0x07,0x3a,0x68,0x53,0x88,0x8b,0xf4,0xb7,0xb9,0xb9,0xad,0x62,0x89,0x0f,
+  0xf9,0x96,0xd9,0x59,0xe9,0xb3,0xcd,0xc6,0xcf,0x36,0x0b,0x8e,0xc5,0x3b,0x0c,0x11,
+  0xb4,0x2d,0x66,0x95,0x7f,0xf9,0x4c,0x7e,0xd4,0x54,0x05,0xa5,0xc5,0x0f,0xb6,0x19,
+  0x0a,0x45,0xff,0x61,0x7b,0xc7,0x65,0x23,0xbc,0xf8,0x70,0x8c,0x04,0x2e,0x62,0x9a,
+  0x14,0xfc,0xb4,0x48,0xad,0x8a,0x28,0xa9,0x63,0x6c,0xec,0x09,0xab,0x21,0xf5,0xd7,
+  0xa0,0xd5,0xfe,0xcc,0xc0,0xbd,0x62,0xe3,0xd8,0x10,0xdb,0xd1,0xaa,0xff,0x74,0xcf,
+  0xfe,0xf8,0xfa,0x67,0xaa,0xef,0xb1,0x18,0x4b,0x3a,0x38,0xa5,0xd5,0x69,0x1f,0x4f,
+  0xdb,0x1e,0x58,0xf5,0x2f,0xc5,0x19,0xd5,0xb7,0xce,0x68,0x17,0xab,0xf4,0xd5,0xb1,
+  0xea,0x99,0x4d,0x9f,0x16,0xd3,0x42,0xc0,0x88,0x65,0xb1,0xf2,0xba,0xf4,0x6f,0x6c,
+  0xdd,0x6d,0x18,0xfa,0xd2,0xb2,0x51,0x0e,0x85,0xca,0xaf,0x02,0xd0,0x0c,0x37,0xaf,
+  0xde,0xaf,0x19,0xfd,0x60,0xd7,0x24,0x75,0xf3,0x4e,0xca,0x42,0xc9,0x78,0x81,0x87,
+  0xa4,0x95,0x26,0x33,0x8b,0xe5,0x8f,0x36,0x38,0xfc,0x29,0x7d,0x58,0xb5,0x7e,0xab,
+  0x4f,0x7c,0x0d,0xb7,0xbc,0x09,0xb4,0x74,0xc4,0xd7,0xa9,0x5c,0x71,0x01,0xc7,0x07,
+  0xd0,0x00,0x29,0x17,0x9b,0x56,0xcf,0x7d,0xda,0x10,0xc2,0xfb,0x5c,0x32,0xef,0x9a,
+  0xee,0x47,0xcf,0xe4,0xad,0x33,0xf7,0xf0,0xc5,0xdb,0x32,0x8e,0x4b,0x72,0x18,0xe4,
+  0x60,0xc1,0x6a,0x32,0xf2,0x88,0x65,0x85,0xcf,0xfa,0x08,0x5c,0x56,0x10,0xfd,0x4e,
+  0x10,0x9f,0xe8,0xae,0xec,0xa9,0x28,0xf6,0xb3,0x52,0xe9,0x44,0x94,0x2e,0xca,0xa5,
+  0x2d,0x51,0xfa,0xb7,0x55,0x84,0xe5,0xa5,0xc9,0x38,0xae,0x1b,0xc5,0x99,0x99,0x72,
+  0xbf,0x03,0x18,0xea,0x88,0xd0,0x0b,0x89,0xd6,0xa8,0x61,0xcf,0x5b,0x24,0xe0,0xe3,
+  0x50,0x51,0xce,0xbb,0xf0,0x17,0x7f,0xea,0x58,0xc0,0xd1,0x70,0x7f,0xca,0xb7,0xe9,
+  0x12,0x52,0x57,0x6c,0x35,0x45,0xe5,0x19,0xcc,0x3d,0xdf,0xa7,0xc3,0x96,0x66,0x9a,
+  0x9b,0xd6,0xe2,0x60,0x24,0x58,0xaa,0xc6,0x4b,0xa3,0x63,0xbc,0x7a,0xf4,0xd9,0xd3,
+  0x27,0xa3,0xc7,0x27,0xf8,0x08,0xff,0x5e,0x17,0x3f,0x5f,0xc3,0xbf,0x37,0xf0,0xef,
+  0xcb,0xa2,0xe8,0x4b,0xf8,0xf7,0xbc,0xf8,0xf9,0x1c,0xfe,0xbd,0x28,0x7e,0xbe,0x30,
+  0xb4,0xa8,0xb1,0x37,0x3e,0x78,0x8a,0x01,0xe6,0xf1,0x93,0x27,0x22,0xb6,0x9c,0x43,
+  0xa3,0xe3,0x75,0x68,0x0a,0x17,0xa6,0xd7,0x05,0x7b,0xf7,0xf3,0xc1,0xf0,0xb2,0x6d,
+  0x6a,0x31,0x0a,0x51,0xdc,0x1b,0x0c,0xad,0xf6,0x81,0xb5,0xbd,0x1c,0x18,0x23,0xb7,
+  0xc7,0x30,0xbf,0x8d,0x2d,0xe8,0xb3,0xc5,0x78,0x4e,0x55,0x1e,0x72,0xf0,0xbd,0x34,
+  0x43,0x5b,0x2c,0x07,0x30,0x68,0xad,0xe4,0x56,0x6c,0x9d,0x46,0xc9,0x73,0xdf,0x37,
+  0x0d,0x91,0x08,0x65,0x8b,0x23,0xe5,0x5a,0x6c,0x42,0x81,0xcb,0x2a,0x7c,0x14,0xba,
+  0xc5,0x0f,0xa1,0x25,0x6e,0xbd,0x86,0x75,0x7e,0x13,0xc9,0x87,0x73,0xd0,0x86,0xe2,
+  0xe9,0x3b,0xee,0x86,0xea,0xf9,0x7c,0xb9,0x4a,0xe4,0xe3,0x9b,0xc4,0x13,0x0f,0xea,
+  0x4b,0x25,0x06,0x79,0x13,0xbb,0x27,0xa6,0xb2,0xf1,0x2b,0xc2,0x26,0x88,0xc8,0x8d,
+  0x20,0xfe,0xf8,0x68,0x1b,0xc4,0x38,0xed,0x0b,0xef,0x12,0xe1,0x27,0xb6,0x12,0xf2,
+  0x2e,0x87,0x43,0xea,0x33,0x38,0x3c,0x52,0x41,0x7f,0x8a,0xbe,0xc0,0x1a,0x73,0xe7,
+  0xd4,0xeb,0x0e,0x40,0xe5,0x7e,0x31,0x38,0x3c,0x51,0x43,0xa2,0xa4,0x19,0x80,0xa8,
+  0x81,0x91,0xc1,0x65,0x82,0xda,0x67,0xc6,0x3f,0xfe,0xfe,0x5f,0x20,0x9f,0xc1,0x54,
+  0xd7,0x63,0xe7,0x41,0xef,0xa8,0x8f,0x61,0x31,0x30,0x9d,0xc0,0x17,0x6b,0x9b,0xc1,
+  0xe7,0xf0,0xdb,0x92,0xbe,0x40,0x77,0x28,0xf0,0xa9,0x0b,0x3c,0x98,0xe6,0x34,0xba,
+  0xa1,0xa4,0x29,0x11,0x94,0xc4,0x8d,0x1b,0x28,0x01,0x12,0xa5,0x8b,0xbe,0xc5,0xbd,
+  0xd2,0x64,0x73,0x8b,0x4b,0x1b,0xe9,0x43,0x64,0xe2,0xe3,0x30,0x53,0x2f,0x0b,0x9c,
+  0xf4,0x8a,0x99,0xf0,0xc0,0xfa,0xb0,0x00,0xf5,0x79,0x98,0x6b,0x0f,0xe4,0x0a,0x65,
+  0x0a,0x32,0xf5,0xb9,0xcd,0x4a,0x7c,0x0a,0x64,0x0a,0x4c,0x0a,0x2c,0x0a,0xfc,0x09,
+  0xd4,0x09,0xbc,0x21,0x51,0x23,0x80,0x96,0x62,0x6b,0xf0,0xc1,0xd6,0x16,0xca,0x63,
+  0x09,0xfc,0x25,0x7a,0x2b,0xad,0xd3,0x8a,0x44,0xcb,0x99,0x5c,0x93,0x48,0x5b,0x6c,
+  0xb5,0x3d,0xb7,0xdd,0x72,0xe1,0x4f,0xbb,0xb5,0x99,0xaa,0x87,0x93,0x33,0x3f,0xb6,
+  0x44,0x93,0x8f,0x98,0x28,0xd9,0x9b,0xb4,0xda,0x12,0x97,0xed,0x56,0xfe,0x49,0xd4,
+  0x96,0xe6,0xc1,0x2f,0xa1,0xbc,0x2e,0x45,0x52,0x0c,0x44,0xa3,0x6c,0x79,0x36,0xf4,
+  0x2e,0x4a,0x56,0x53,0xf8,0xef,0x9f,0xd4,0xad,0x0d,0x94,0x05,0x26,0xb6,0xb5,0x0d,
+  0xd7,0x68,0x7b,0x96,0x2d,0x2f,0xb5,0x04,0xb5,0xc1,0x7e,0x1e,0xb3,0xc1,0xe9,0xa9,
+  0x77,0x22,0x12,0xdf,0x72,0x81,0x15,0xc8,0x4c,0x24,0x2a,0xdd,0xd0,0x71,0xea,0x0e,
+  0x52,0xd2,0x72,0xf2,0x36,0xcf,0x1a,0xe5,0x36,0x1c,0x15,0xda,0x6d,0xf4,0x2c,0xd7,
+  0x6a,0xc7,0x2c,0xb7,0x0b,0x74,0xed,0x16,0xb9,0x04,0x87,0x54,0x51,0x93,0x0c,0xe5,
+  0x62,0xf0,0xb4,0x55,0x9d,0xd9,0x5a,0x02,0x75,0x55,0x7a,0xeb,0x46,0x83,0x8a,0x1c,
+  0x57,0xad,0x45,0x91,0x31,0x5f,0xea,0x56,0x95,0x21,0xaf,0x23,0xb0,0x55,0x9b,0x95,
+  0x2b,0x06,0x59,0x6e,0x1f,0x20,0x68,0xb5,0xf9,0x75,0xbb,0xb5,0xdf,0x89,0x01,0x31,
+  0x48,0xb0,0x9d,0xba,0x2f,0x06,0xd9,0x83,0x76,0x54,0x86,0xad,0x28,0xb9,0x97,0x24,
+  0xdb,0x32,0x39,0x82,0x90,0x11,0x17,0xae,0x99,0x61,0x07,0xb4,0xbf,0x16,0x7b,0x12,
+  0xc5,0xf2,0x78,0x7e,0xfe,0x05,0x27,0xbc,0x55,0xdb,0x9b,0x2d,0x29,0x9b,0x96,0xbe,
+  0xed,0x84,0x89,0x9d,0x14,0xfc,0xef,0x8a,0x33,0xfc,0xf2,0xc2,0x80,0x99,0x0c,0x41,
+  0xce,0x3d,0xee,0xbb,0xa9,0x48,0x62,0x85,0xf1,0xc5,0xde,0xc5,0xf3,0xaf,0xff,0x4a,
+  0x1b,0x53,0xfa,0xa7,0x09,0xec,0x25,0xc6,0xb5,0x74,0xb2,0x2c,0xe7,0x38,0x61,0xe2,
+  0xac,0xd1,0x56,0x42,0x0b,0x5a,0x19,0x9a,0xa6,0xe0,0xa1,0xdc,0xf0,0xd7,0x2e,0x90,
+  0x2b,0xc9,0x5e,0x67,0x3c,0x00,0x81,0x7a,0x0a,0xee,0xb7,0xd3,0x6e,0xe3,0xcd,0x69,
+  0xb3,0xf6,0xf8,0x49,0x29,0xec,0x34,0xd5,0xbd,0xa3,0x79,0x61,0xbc,0xb4,0x28,0xb5,
+  0xb7,0xd5,0x36,0xb1,0xcf,0xdc,0xda,0x16,0x1c,0x32,0xc7,0xb7,0x95,0xc7,0xf2,0x2f,
+  0x40,0xc2,0x81,0x6b,0xd3,0xca,0x2f,0xe7,0x66,0xd0,0xdb,0xc1,0x3d,0x8b,0x16,0x9d,
+  0x5c,0x68,0x5d,0x76,0x64,0x84,0x51,0xb6,0xdb,0xef,0x6e,0xee,0x56,0x7b,0x6a,0x82,
+  0x62,0x6e,0xdd,0xcb,0xdd,0x89,0x8d,0x73,0xd0,0x6f,0xd0,0x6e,0xb5,0x0b,0xde,0x36,
+  0x3c,0xa3,0x8d,0x34,0x02,0xeb,0xb8,0xeb,0x99,0xa2,0x9a,0xf7,0xbd,0x02,0x74,0x16,
+  0x6f,0x2a,0x90,0x6b,0x08,0x70,0x8f,0x2c,0x4b,0xeb,0x97,0x5f,0xbf,0x56,0xf4,0xaf,
+  0xbe,0x66,0x07,0x21,0x75,0x50,0x09,0xa9,0xdf,0xe3,0x55,0x6b,0xad,0xd2,0x12,0xc5,
+  0xcd,0x2a,0xc5,0x0a,0x2b,0xef,0xe7,0xc1,0x05,0x1e,0xd2,0x02,0xf7,0x1c,0xa4,0xfa,
+  0xbe,0x1d,0x1c,0xe6,0x08,0x87,0x69,0xb5,0xc9,0x9d,0x79,0xac,0x33,0x1d,0x12,0x6b,
+  0xe5,0xe0,0x78,0x07,0x68,0x31,0x74,0xf3,0x2d,0xa0,0xf8,0x86,0xc7,0xf7,0x47,0xb3,
+  0x34,0x8b,0xcb,0xaa,0x5d,0x44,0xa9,0x4a,0xb9,0xdf,0x60,0xdd,0xa3,0x9b,0x08,0xca,
+  0xd2,0xb7,0x09,0x37,0x98,0x2d,0x8b,0xba,0x2e,0xbf,0xdd,0x14,0x68,0xdb,0xbb,0xe8,
+  0x5f,0xaa,0x2d,0x34,0x6a,0xa9,0x8b,0x20,0xa8,0x1d,0x80,0x41,0xc2,0xcb,0xc9,0x66,
+  0xa5,0x94,0x54,0xf0,0x36,0xb8,0x48,0x38,0x93,0x91,0xae,0xc2,0x09,0xe0,0x05,0x55,
+  0x1f,0x5a,0x2a,0x16,0xaa,0xcb,0xe1,0x38,0xf6,0x6f,0xe7,0xbe,0xb3,0x48,0x51,0xf8,
+  0x90,0x10,0xfe,0xca,0xc3,0xbd,0x5e,0xb0,0xc4,0x44,0x42,0x9b,0xb8,0x57,0x46,0xde,
+  0x7a,0x68,0xe1,0x0d,0xa0,0x20,0x78,0x28,0x97,0xdf,0xc9,0xe8,0x96,0xd0,0xd0,0xc8,
+  0xc4,0x30,0xea,0xf6,0x2a,0xb1,0x83,0xdc,0x6c,0xf5,0x5e,0x10,0x30,0xbe,0x18,0xb7,
+  0xe6,0xdd,0xd6,0x65,0x95,0xd1,0xcb,0x7d,0x29,0x26,0x51,0x94,0x0a,0x51,0x39,0x43,
+  0xc1,0xae,0xe0,0xf8,0x35,0x98,0xfc,0x64,0xa5,0xcc,0x6c,0x71,0x91,0x0a,0x5e,0xd1,
+  0x8d,0x50,0x35,0x68,0xd7,0xe5,0xe1,0xfc,0x62,0xa6,0xed,0xad,0x0d,0xad,0x4b,0xe1,
+  0x00,0x43,0x77,0x2d,0x65,0xf9,0xfd,0x07,0xfc,0x0a,0x0d,0xf4,0x80,0x62,0xb1,0x5a,
+  0x81,0x00,0xdc,0x80,0xf1,0xb7,0x43,0x0c,0x64,0x81,0x9c,0xe4,0x39,0x5f,0xdb,0x9b,
+  0xee,0x04,0x06,0xbc,0x94,0xd5,0xd4,0xcd,0x91,0x6b,0x0a,0x50,0xba,0x36,0xfc,0x05,
+  0x44,0xb7,0x0d,0x1b,0xf4,0x09,0xfd,0x18,0xe8,0x3f,0x86,0xe4,0x28,0x00,0xbe,0x70,
+  0xeb,0x85,0xdc,0xc1,0x12,0x19,0xe0,0x20,0x6d,0x66,0x8a,0xb6,0xa3,0xcb,0x67,0xac,
+  0xd5,0x75,0xc1,0xce,0x31,0x7f,0xc1,0xd7,0x78,0xb6,0xcf,0x92,0xc9,0x8f,0xeb,0xa0,
+  0x9a,0xb6,0x5a,0xc7,0x60,0x3a,0xfd,0x92,0x61,0x7b,0xf8,0xb5,0x20,0x27,0xe5,0x69,
+  0x0f,0x20,0xdc,0xbb,0x6e,0xb5,0x61,0xa6,0xa8,0xb6,0x1a,0x5f,0x06,0xe0,0xee,0xf5,
+  0xdc,0x08,0x69,0x08,0xec,0xbc,0xab,0xe2,0xda,0x4e,0x3c,0xf4,0xad,0x48,0x4d,0x7c,
+  0xff,0xe7,0xba,0xc3,0x7e,0xc0,0xe3,0x20,0x68,0x13,0x80,0x35,0xf6,0x03,0xb4,0x13,
+  0x00,0x0b,0x00,0x73,0xc9,0xed,0x06,0xbc,0x5c,0x8a,0x25,0x72,0x7b,0xc9,0x9d,0xb8,
+  0x6d,0x50,0x12,0x43,0xca,0xf0,0x07,0x8b,0x01,0x7b,0xec,0x51,0x00,0x76,0x0f,0xf8,
+  0xef,0x0c,0xc1,0x2f,0x5a,0x26,0x4e,0x00,0x0d,0xe7,0x78,0xfd,0x0d,0xf0,0x0b,0x1e,
+  0xd9,0x29,0x57,0x42,0x19,0xee,0x52,0xec,0x70,0xe7,0x6c,0x71,0xef,0x78,0x0d,0x45,
+  0x6f,0x32,0xb7,0x2b,0x9a,0xeb,0x2e,0x9b,0xa0,0x99,0x2b,0x34,0x54,0x00,0xd9,0x92,
+  0x09,0xc8,0x1a,0xbf,0x6a,0x1b,0x4b,0x41,0xdd,0xf4,0x1c,0x50,0xd2,0xb6,0x2a,0xce,
+  0xed,0x70,0xcd,0x35,0x83,0xfe,0x17,0x57,0x97,0xe8,0x9f,0x9d,0xe4,0x5d,0xf2,0x76,
+  0xa2,0x12,0x9c,0x35,0x0c,0x33,0xf6,0xe8,0x1b,0x3a,0xc8,0x5f,0x74,0x63,0xaf,0x97,
+  0xdf,0xd9,0x5c,0xda,0x81,0xa1,0x31,0xf0,0xd0,0x18,0x6e,0x9f,0xe7,0xcf,0x45,0xb8,
+  0x51,0xbe,0x6f,0x40,0x79,0x5f,0x6f,0xbc,0x1b,0xee,0x9a,0x03,0x42,0x30,0x1d,0x1a,
+  0xa1,0xbb,0x65,0x68,0x6c,0x3a,0x35,0x95,0xea,0xc7,0xa6,0xb6,0x5f,0xe3,0xf6,0xd5,
+  0xf2,0x36,0xa7,0x5c,0xeb,0xb2,0x88,0x7e,0xba,0xbb,0x52,0x4c,0x6a,0x32,0xf1,0xac,
+  0x47,0x03,0xb1,0xd4,0x4d,0x0f,0x73,0xf3,0xe5,0x62,0x75,0x5b,0xaf,0x95,0xdb,0x48,
+  0xc2,0x4a,0x15,0x79,0x87,0xd2,0x12,0x55,0x5b,0x44,0x79,0x7c,0x8c,0x64,0x63,0x2e,
+  0x13,0x3d,0x99,0x84,0x88,0x71,0x0c,0x91,0x37,0xb3,0x44,0x11,0x2b,0x3e,0xb0,0x95,
+  0x66,0x3b,0x04,0xa5,0xe7,0x36,0xcb,0x47,0xb1,0xf5,0x3c,0xf5,0x2e,0xb5,0x9d,0x67,
+  0xa4,0x32,0x57,0xc8,0x41,0xf1,0xac,0xa8,0x89,0x88,0xc7,0x17,0x11,0xbf,0x54,0xea,
+  0x26,0x6b,0xab,0xa4,0x4e,0xf2,0xe5,0x3b,0xc9,0x74,0x38,0x83,0x20,0x13,0x66,0xb1,
+  0xb3,0x88,0xa4,0xe4,0x02,0xb9,0x9c,0x61,0x88,0x75,0x83,0x15,0xcd,0x74,0x3c,0xee,
+  0x0e,0x30,0xdb,0x9f,0x3e,0x31,0x21,0x4f,0x1c,0x1c,0x8b,0xf2,0x21,0x9d,0x02,0x10,
+  0x47,0x3d,0xe8,0x1b,0xa5,0xe2,0x2c,0xda,0xda,0x11,0x77,0x39,0xab,0xc3,0x64,0xe8,
+  0x00,0xd2,0x25,0x07,0xd4,0xd0,0x21,0xfc,0x51,0x14,0x12,0xe3,0x85,0xd4,0x05,0x63,
+  0xf2,0x66,0x7a,0x7a,0xd4,0x7f,0xc6,0x52,0xe0,0x63,0x91,0x77,0x66,0xa2,0xc6,0x5a,
+  0x44,0xf4,0xb2,0xd3,0xd1,0x11,0x6e,0xe7,0x68,0xfc,0x91,0x8a,0xd0,0x85,0xa4,0xf5,
+  0x52,0xdb,0x27,0x47,0x07,0x5b,0x8d,0xb1,0x3f,0x36,0x47,0x3b,0xb3,0x68,0x0c,0x76,
+  0x39,0xae,0x6a,0x78,0x20,0xaf,0xb7,0xc0,0x52,0xcb,0xb2,0x36,0x36,0x5b,0x44,0xb4,
+  0x35,0x8f,0x62,0xe1,0xf9,0xc0,0x59,0x14,0xdf,0x2a,0x32,0x94,0xa0,0xee,0x14,0x37,
+  0xa7,0xa9,0x2c,0x2c,0xf1,0xed,0x24,0xb1,0xbf,0xa3,0x7c,0x1d,0x51,0xb6,0xa4,0xdb,
+  0xdb,0xe8,0xfe,0x27,0x27,0x93,0x07,0x2f,0x5c,0x41,0x69,0x48,0x92,0xaf,0xb1,0x51,
+  0x65,0x9e,0x2b,0x06,0xd6,0xd7,0x5e,0xe8,0x46,0x6b,0x9b,0x1a,0x9d,0xc1,0xbc,0x67,
+  0x5c,0x4f,0xbd,0xc9,0x63,0xc3,0x72,0x37,0x48,0x6b,0x06,0x12,0xae,0x47,0xef,0x97,
+  0x9e,0x4e,0x11,0x46,0x8e,0x42,0x95,0xfe,0xb5,0x99,0xa8,0xf9,0x7e,0x8a,0xc2,0xda,
+  0x06,0xad,0x0d,0x76,0xb3,0x39,0x77,0x66,0x20,0x06,0xb4,0xed,0x13,0x7e,0x6d,0xbb,
+  0x4e,0xe6,0x60,0xd0,0xc0,0x05,0x89,0x82,0xf5,0xa6,0xda,0xc3,0xd1,0x87,0x17,0x39,
+  0x66,0xe5,0xcd,0x24,0x98,0x0f,0xb6,0x27,0x21,0xbd,0xe9,0xbb,0x7d,0xcb,0xe5,0xe1,
+  0x04,0x6d,0xc7,0x52,0x24,0x72,0xea,0xb1,0x89,0xfc,0x8d,0x5a,0xfc,0xc0,0x17,0x5e,
+  0x1d,0x96,0x8b,0x55,0x0a,0xcb,0x61,0x86,0x01,0x57,0x34,0xbf,0x54,0x26,0xda,0xc3,
+  0x31,0x36,0xb1,0xc3,0x6d,0xc1,0x8e,0x29,0xe5,0x1b,0x62,0x4a,0x34,0x55,0xb2,0xaa,
+  0x1c,0xc4,0x6d,0x3e,0x0d,0x25,0xb3,0x4d,0x76,0x8c,0x57,0xcc,0xee,0xc2,0xbb,0xb4,
+  0x31,0x58,0x2c,0xf7,0x0d,0x91,0x05,0xa9,0xb1,0x0b,0x15,0x60,0xf5,0x30,0x03,0x78,
+  0xee,0xe3,0xaa,0xdf,0x77,0xfa,0x40,0xbf,0x79,0x0d,0x2d,0x74,0xc3,0x4c,0x15,0x20,
+  0x68,0xcb,0xee,0x5e,0x30,0x1e,0x23,0x1f,0xe3,0x8d,0x64,0xc8,0x26,0x45,0x29,0xee,
+  0x43,0xe0,0x81,0x4c,0x71,0x7e,0xc4,0x92,0x1d,0x80,0x81,0xb1,0x1c,0x8f,0xaf,0x8a,
+  0x6d,0xa5,0x22,0x0d,0x24,0x14,0x11,0x39,0xdc,0xb2,0xc5,0x38,0x34,0xa5,0x64,0x1a,
+  0xe4,0x06,0x62,0x3c,0x8e,0xee,0x49,0x87,0xbf,0xc5,0x67,0xb0,0x28,0x62,0x37,0x05,
+  0xe1,0x00,0xa8,0x36,0x94,0xa5,0x54,0x87,0x79,0xf1,0xf6,0x79,0x38,0x19,0x0f,0xfb,
+  0x38,0xdf,0x33,0x25,0x97,0x01,0xa8,0x2b,0x9a,0x78,0x98,0x5e,0xc8,0x36,0x97,0x3f,
+  0xff,0x8c,0x33,0x46,0xdb,0x6a,0x63,0x39,0xa6,0x92,0x7f,0xb0,0x2e,0x2b,0x3f,0x18,
+  0x23,0x57,0xe6,0x2d,0x26,0xa2,0x95,0x66,0x48,0xe4,0x55,0x62,0x00,0xba,0x8b,0x37,
+  0x07,0x13,0x15,0xa3,0xb0,0x13,0x8b,0x84,0xe1,0xc4,0x2a,0x71,0xb7,0x58,0x5d,0x93,
+  0x28,0x81,0xf4,0xe9,0x81,0x2f,0x4f,0xad,0x26,0x22,0x10,0x29,0xb7,0xb1,0xc5,0x8f,
+  0x9c,0x23,0xc4,0x4f,0x1c,0x5c,0x9c,0x94,0x78,0x50,0xc4,0xca,0x4f,0x1e,0xec,0xda,
+  0x78,0xff,0x75,0xdb,0xee,0xa5,0xa4,0xe3,0x87,0xb4,0x5b,0x4b,0xac,0x28,0x93,0xac,
+  0xb7,0x76,0x8f,0xa2,0x95,0xef,0x52,0xce,0x24,0x49,0xeb,0x59,0x69,0x33,0x69,0xd7,
+  0xce,0x51,0x49,0xb1,0xa2,0xc8,0xbf,0xd7,0x8d,0x24,0x3d,0x3b,0x42,0x9d,0x3a,0x69,
+  0xda,0xd9,0x45,0xca,0x2b,0x62,0x57,0xae,0x2d,0x1e,0x3a,0xf2,0x01,0xa3,0x14,0x27,
+  0xba,0x4f,0xe5,0xda,0x73,0x55,0x20,0xdd,0x02,0x1c,0x40,0x6d,0x4b,0x9e,0xb0,0xfc,
+  0x9b,0xe0,0xda,0x67,0x9a,0xf2,0x7d,0xde,0x3c,0x2b,0x00,0xc0,0x0d,0x03,0xd9,0xe4,
+  0x5e,0x5b,0xfa,0xbe,0x3d,0x65,0x96,0x08,0xe2,0x20,0x6d,0x9c,0x13,0xca,0xde,0x59,
+  0x11,0x25,0xa4,0x69,0x2e,0x90,0xbe,0x13,0xb8,0x65,0x0d,0x88,0x7d,0xcc,0x42,0x3c,
+  0xd3,0xf6,0x39,0xca,0xd5,0x8a,0x1d,0xf7,0xba,0xe3,0x25,0x62,0xd3,0x1d,0x9c,0x6c,
+  0x3a,0x4f,0x0d,0xde,0xf6,0x34,0x72,0x6f,0xe1,0x0f,0x6e,0xe7,0x4d,0x1e,0xfc,0x3f,
+  0x06,0xf5,0x07,0x5e,0x43,0x9b,0x00,0x00,
+};
+
+#endif //ADMIN_PAGE_H
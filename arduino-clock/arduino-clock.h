@@ -8,6 +8,9 @@
 
 ////////////////////////////////////////////
 
+#include "traits.h" //what this config has, as compile-time constants
+#define SHOW_IRRELEVANT_OPTIONS 0 //whether to show everything in settings menu and page (network), regardless of config
+
 
 //Unique IDs for the functions - see also fnScroll
 #define FN_TOD 0 //time of day
@@ -18,27 +21,83 @@
 #define FN_TUBETEST 5 //simply cycles all digits for nixie tube testing
 #define FN_OPTS 201 //fn values from here to 255 correspond to settings in the settings menu
 
+//Alarms. Alarm 0 is the one shown and switched on the clock (FN_ALARM), and keeps its original locs - see alarmLoc().
+//The others are set via the settings page, and kept in records of ALARM_SIZE bytes from ALARM_LOC.
+#define ALARMS 4
+#define ALARM_LOC 152
+#define ALARM_SIZE 8
+//Alarm record fields, by offset
+#define AL_TIME 0 //mins (int)
+#define AL_ON 2
+#define AL_DAYS 3 //days of the week, as a bitmask - bit 0 is Sunday
+#define AL_SIGNAL 4 //0=piezo, 1=switch, 2=pulse
+#define AL_PITCH 5
+#define AL_PATTERN 6
+#define AL_FIB 7 //fibonacci mode
+
+//Timers. Timer 0 is the chrono/timer shown on the clock (FN_TIMER). When another countdown is set while one is running,
+//the running one is handed off to one of the others, which run in the background until they go off - see timerPark().
+#define TIMERS 4
+#define TIMER_LAPS 8 //how many of the chrono's laps are kept for review
+
+//Settings menu schema entries - see opts.h
+struct OptDef {
+  byte num; //setting number, as displayed in the menu and the instructions
+  byte loc; //EEPROM loc
+  byte fmt; //how it's displayed when set - FMT_
+  byte size; //bytes in EEPROM: 1, or 2 for an int (if max is over 255)
+  bool applies; //to this clock's config - if not, it's skipped in the menu, and left off the admin page
+  int def, min, max;
+};
+//Value formats, for updateDisplay() when setting
+#define FMT_NUM 0 //plain number - leading zeros for negatives
+#define FMT_TOD 1 //time of day or duration in mins, as hours and mins
+#define FMT_SECS 2 //seconds, on the seconds digits
+#define FMT_PITCH 3 //piezo pitch - plays a demo beep
+#define FMT_PATTERN 4 //signal pattern - plays a demo measure
+#define FMT_SIGNAL 5 //signal type - only those equipped (see signalOK())
+#define FMT_UTC 6 //UTC offset in quarter hours plus 100, as hours and mins
+#define FMT_COORD 7 //latitude/longitude in tenths of a degree
+
+struct WeatherPeriod; //see weather.h
+
 void setup();
 void loop();
-void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity=0);
+void checkLoopStats();
+unsigned long getUptime();
+word getLoopRate();
+word getLoopStallMax();
+void ctrlEvt(byte ctrl, byte evt, byte evtLast, byte velocity=0);
 void fnScroll(byte dir);
 void fnOptScroll(byte dir);
 void goToFn(byte thefn, byte thefnPg=0);
 void switchAlarmState(byte dir);
 void setAlarmState(byte state);
 byte getAlarmState();
+int alarmLoc(byte a, byte field);
+byte alarmDays(byte a);
+bool alarmFibonacci(byte a);
 void switchPower(byte dir);
-void startSet(int n, int m, int x, byte p);
+void startSet(int n, int m, int x, byte p, byte fmt=FMT_NUM);
 void doSet(int delta);
+int getSetDelta(bool up, byte velocity);
 void clearSet();
 bool initEEPROM(bool hard);
+OptDef getOpt(byte opt);
+byte getOptCount();
+int findOpt(int loc);
+OptDef getAlarmOpt(byte field);
 void findFnAndPageNumbers();
 void checkRTC(bool force);
+unsigned long getRtcSecAt();
+void checkTimeline();
+unsigned long scheduleEvent(byte type, unsigned long after);
+void timedEvent(byte type);
 void fibonacci(byte h, byte m, byte s);
 void autoDST();
 bool isDST(int y, byte m, byte d);
 bool isDSTByHour(int y, byte m, byte d, byte h, bool setFlag);
-byte nthSunday(int y, byte m, byte nth);
+byte nthSunday(int y, byte m, int nth);
 byte daysInMonth(word y, byte m);
 int daysInYear(word y);
 int dateToDayCount(word y, byte m, byte d);
@@ -54,28 +113,40 @@ void timerStart();
 void timerStop();
 void timerClear();
 void timerLap();
+bool timerPark();
+void timerCancel(byte t);
+bool timerNextPage();
+unsigned long timerLapGet(byte i);
 void timerRunoutToggle();
 void cycleTimer();
 void timerSleepSwitch(bool on);
 byte getTimerState();
 void setTimerState(char pos, bool val);
+byte getDisplayDim();
+byte getFn();
+byte getFnPg();
+byte getFnSetPg();
+int getSignalActive();
 void tempDisplay(int i0, int i1=0, int i2=0, int i3=0);
 void updateDisplay();
 void calcSun();
 void displaySun(byte which, int d, int tod);
+const WeatherPeriod* findWeather(byte which, int tod);
 void displayWeather(byte which);
 void initOutputs();
 void signalStart(byte sigFn, byte sigDur);
 void signalStop();
 void cycleSignal();
+unsigned long getSignalCount(byte sigFn);
 word getSignalPitch();
 word getHz(byte note);
 byte getSignalOutput();
 byte getSignalPattern();
 void quickBeep(int pitch);
-void quickBeepPattern(int source, int pattern);
+void quickBeepPattern(int source, int pattern, byte alarm=0);
 void updateBacklight();
 void cycleBacklight();
+word getIdleNap();
 byte getVersionPart(byte part);
 
 #endif //ARDUINO_CLOCK_H
\ No newline at end of file
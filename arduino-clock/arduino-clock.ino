@@ -28,6 +28,14 @@ const bool vDev = 0;
 #include "rtcMillis.h" //if RTC_MILLIS is defined in config – for a fake RTC based on millis
 #include "input.h" //for Sel/Alt/Up/Dn - supports buttons, rotary control, and Nano 33 IoT IMU
 #include "network.h" //if not AVR – enables WiFi/web-based config/NTP sync on Nano 33 IoT WiFiNINA
+#include "weather.h" //if ENABLE_DATE_WEATHER is true in config – forecast for the date pages, fetched via network
+#include "trace.h" //if INPUT_TRACE is defined in config – records control events for debugging
+#include "pintrace.h" //output writes - and if PIN_TRACE is defined in config, records them for checking timing
+#include "piezo.h" //if PIEZO_PIN is set in config – plays beeps from a timer interrupt
+#include "pattern.h" //signal patterns and custom tunes for the piezo
+#include "timeline.h" //when timed events are next due
+#include "expiry.h" //when timers are next due
+#include "power.h" //naps between loop cycles while the display is off
 
 
 ////////// Variables and storage //////////
@@ -41,7 +49,7 @@ IMPORTANT! If adding more variables, be sure to increase STORAGE_SPACE in storag
 These ones are set outside the settings menu (defaults defined in initEEPROM() where applicable):
   0-1 Alarm time, mins
   2 Alarm on
-  3 [free]
+  3 Alarm days, if custom (bitmask, bit 0 = Sunday) - see alarmDays()
   4 Day count direction
   5 Day count month
   6 Day count date
@@ -57,8 +65,9 @@ These ones are set outside the settings menu (defaults defined in initEEPROM() w
   55-86 Wi-Fi SSID (32 bytes)
   87-150 Wi-Fi WPA passphrase/key or WEP key (64 bytes)
   151 Wi-Fi WEP key index
+  152-175 Alarms 1-3 (8 bytes each, per the AL_ fields in arduino-clock.h) - alarm 0 is the one above, see alarmLoc()
 
-These ones are set inside the settings menu (defaults defined in arrays below).
+These ones are set inside the settings menu (numbers, formats, ranges and defaults defined in opts.h).
 Some are skipped when they wouldn't apply to a given clock's hardware config, see fnOptScroll(); these ones will also be set at startup to the start= values, see setup(). Otherwise, make sure these ones' defaults work for all configs.
   10-11 Latitude
   12-13 Longitude
@@ -70,7 +79,7 @@ Some are skipped when they wouldn't apply to a given clock's hardware config, se
   20 Digit fade duration
   21 Strike - piezo or pulse signal only (start=0)
   22 Auto DST
-  23 Alarm days
+  23 Alarm days (0=every day, 1=work week, 2=weekend, 3=custom per loc 3)
   24 Alarm snooze
   25 [free] - formerly Timer interval mode (now a volatile var)
   26 Backlight behavior - skipped when no backlight pin
@@ -88,23 +97,20 @@ Some are skipped when they wouldn't apply to a given clock's hardware config, se
   42 Alarm signal (0=piezo, 1=switch, 2=pulse)
   43 Timer signal
   44 Strike signal
-  45 Temperature format - skipped when !ENABLE_TEMP_FN TODO also useful for weather display
+  45 Temperature format - skipped when !ENABLE_TEMP_FN && !ENABLE_DATE_WEATHER
   46 Anti-cathode poisoning
   47 Alarm beeper pattern - piezo signal only
   48 Timer beeper pattern - piezo signal only
   49 Strike beeper pattern - piezo signal only
   50 Alarm Fibonacci mode
+
+These ones are bulk data, read and written directly rather than via storageBytes (see readEEPROMDirect() in storage.cpp):
+  256-511 Custom signal tunes (see pattern.cpp)
 */
 
-//Settings menu numbers (displayed in UI and readme), locs, and default/min/max/current values.
-//Setting numbers/order can be changed (though try to avoid for user convenience);
-//but locs should be maintained so AVR EEPROM doesn't need reset after an upgrade (SAMD does it anyway).
-//                       General                    Alarm              Timer     Strike       Night and away shutoff           Geo
-const byte optsNum[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,11,12,13,14,15, 21,22,23, 30,31,32,33, 40,  41,  42,43,44,45,  46,  47,    50,   51, 52};
-const byte optsLoc[] = {16,17,18,19,20,22,26,46,45, 23,42,39,47,24,50, 43,40,48, 21,44,41,49, 27,  28,  30,32,33,34,  35,  37,    10,   12, 14};
-const  int optsDef[] = { 2, 1, 0, 0, 5, 0, 1, 0, 0,  0, 0,76, 4, 9, 0,  0,76, 2,  0, 0,68, 5,  0,1320, 360, 0, 1, 5, 480,1080,     0,    0,100};
-const  int optsMin[] = { 1, 1, 0, 0, 0, 0, 0, 0, 0,  0, 0,49, 0, 0, 0,  0,49, 0,  0, 0,49, 0,  0,   0,   0, 0, 0, 0,   0,   0,  -900,-1800, 52};
-const  int optsMax[] = { 2, 5, 3, 1,20, 6, 4, 2, 1,  2, 2,88, 5,60, 1,  2,88, 5,  4, 2,88, 5,  2,1439,1439, 2, 6, 6,1439,1439,   900, 1800,156};
+//Settings menu numbers (displayed in UI and readme), locs, formats, and default/min/max values - and the same for
+//the fields of alarms 1 and up
+#include "opts.h"
 
 //The rest of these variables are not backed by persistent storage, so they are regular named vars.
 
@@ -115,6 +121,7 @@ byte fnSetPg = 0; //whether this function is currently being set, and which page
  int fnSetVal; //the value currently being set, if any
  int fnSetValMin; //min possible
  int fnSetValMax; //max possible
+byte fnSetFmt; //how to display it - FMT_
 bool fnSetValVel; //whether it supports velocity setting (if max-min > 30)
  int fnSetValDate[3]; //holder for newly set date, so we can set it in 3 stages but set the RTC only once
 bool fnSetValDid; //false when starting a set; true when value is changed - to detect if value was not changed
@@ -128,7 +135,8 @@ byte fnDateSunnext = 255;
 byte fnDateWeathernext = 255;
 
 // Volatile running values used throughout the code. (Others are defined right above the method that uses them)
-bool alarmSkip = 0;
+bool alarmSkip = 0; //alarm 0 only
+byte alarmSignaling = 0; //which alarm last went off - its signal, snooze, and fibonacci settings apply to the alarm signal
 byte signalSource = 0; //which function triggered the signal - FN_TOD (chime), FN_ALARM, or FN_TIMER
 byte signalPattern = 0; //the pattern for that source
 word signalRemain = 0; //alarm/timer signal timeout counter, seconds
@@ -138,6 +146,12 @@ word timerInitialMins = 0; //timer original duration setting, minutes - up to 99
 word timerInitialSecs = 0; //timer original duration setting, seconds - up to 59s (could be a byte, but I had trouble casting to unsigned int when doing the math to set timerTime)
 unsigned long timerTime = 0; //timestamp of timer target / chrono origin (while running) or duration (while stopped)
 unsigned long timerLapTime = 0; 
+unsigned long timerEnds[TIMERS]; //background countdowns' targets, per ms() - [0] is unused, as timer 0 uses timerTime
+byte timersRunning = 0; //which background countdowns are running (bitmask)
+byte timerSignaling = 0; //which countdown last went off - see getSignalPitch()
+unsigned long timerLaps[TIMER_LAPS]; //the chrono's latest laps (time since its origin), as a ring...
+byte timerLapNext = 0; //...where the next one goes...
+byte timerLapCount = 0; //...and how many there have been since it was cleared (up to 255)
 const byte millisCorrectionInterval = 30; //used to calibrate millis() to RTC for timer/chrono purposes
 unsigned long millisAtLastCheck = 0;
 word unoffRemain = 0; //un-off (briefly turn on display during full night/away shutoff) timeout counter, seconds
@@ -150,8 +164,6 @@ int tempValDispQueue[4];
 const int tempValDispDur = 2500; //ms
 unsigned int tempValDispLast = 0;
 
-#define SHOW_IRRELEVANT_OPTIONS 0 //whether to show everything in settings menu and page (network)
-
 ////////// Main code control //////////
 
 void setup(){
@@ -159,6 +171,9 @@ void setup(){
   // #ifndef __AVR__ //SAMD only
   // while(!Serial);
   // #endif
+  #ifdef PIN_TRACE
+  pinTraceInit(); //before any outputs are written
+  #endif
   rtcInit();
   initStorage(); //pulls persistent storage data into volatile vars - see storage.cpp
   byte changed = initEEPROM(false); //do a soft init to make sure vals in range
@@ -166,7 +181,7 @@ void setup(){
   initOutputs(); //depends on some EEPROM settings
   if(initInputs()){ //inits inputs and returns true if CTRL_SEL is held
     versionShowing = 1;
-    //skip network for now, since wifi connect hangs - we'll do it after version is done
+    //skip network for now, in case the user holds Sel to reset EEPROM (incl. wifi creds) - we'll do it after version is done
   } else {
     if(networkSupported()) initNetwork();
   }
@@ -176,24 +191,29 @@ void setup(){
   
   //Signals: if the current eeprom selection is not available,
   //try to use the default specified in the config, failing to pulse and then switch (alarm/timer only)
-  if((readEEPROM(42,false)==0 && PIEZO_PIN<0) || (readEEPROM(42,false)==1 && SWITCH_PIN<0) || (readEEPROM(42,false)==2 && PULSE_PIN<0))
-    changed += writeEEPROM(42,(ALARM_SIGNAL==0 && PIEZO_PIN>=0? 0: (ALARM_SIGNAL==2 && PULSE_PIN>=0? 2: 1)),false,false); //alarm
-  if((readEEPROM(43,false)==0 && PIEZO_PIN<0) || (readEEPROM(43,false)==1 && SWITCH_PIN<0) || (readEEPROM(43,false)==2 && PULSE_PIN<0))
-    changed += writeEEPROM(43,(TIMER_SIGNAL==0 && PIEZO_PIN>=0? 0: (TIMER_SIGNAL==2 && PULSE_PIN>=0? 2: 1)),false,false); //timer
-  if((readEEPROM(44,false)==0 && PIEZO_PIN<0) || (readEEPROM(44,false)==1 && SWITCH_PIN<0) || (readEEPROM(44,false)==2 && PULSE_PIN<0))
-    changed += writeEEPROM(44,(CHIME_SIGNAL==0 && PIEZO_PIN>=0? 0: 2),false,false); //chime
+  for(byte a=0; a<ALARMS; a++){
+    int loc = alarmLoc(a,AL_SIGNAL);
+    if(!signalOK(readEEPROM(loc,false)))
+      changed += writeEEPROM(loc,(ALARM_SIGNAL==0 && hasPiezo? 0: (ALARM_SIGNAL==2 && hasPulse? 2: 1)),false,false); //alarms
+  }
+  if(!signalOK(readEEPROM(43,false)))
+    changed += writeEEPROM(43,(TIMER_SIGNAL==0 && hasPiezo? 0: (TIMER_SIGNAL==2 && hasPulse? 2: 1)),false,false); //timer
+  if(!signalOK(readEEPROM(44,false)))
+    changed += writeEEPROM(44,(CHIME_SIGNAL==0 && hasPiezo? 0: 2),false,false); //chime
   
-  if((PIEZO_PIN<0 && SWITCH_PIN<0 && PULSE_PIN<0) || !ENABLE_ALARM_FN){ //can't do alarm
-    changed += writeEEPROM(2,0,false,false); //force alarm off
+  if(!hasAlarm){ //can't do alarm
+    for(byte a=0; a<ALARMS; a++){
+      changed += writeEEPROM(alarmLoc(a,AL_ON),0,false,false); //force alarms off
+      changed += writeEEPROM(alarmLoc(a,AL_FIB),0,false,false); //force fibonacci off
+    }
     changed += writeEEPROM(23,0,false,false); //force autoskip off
-    changed += writeEEPROM(50,0,false,false); //force fibonacci off
   } else { //ok to do alarm
-    if(!ENABLE_SOFT_ALARM_SWITCH) changed += writeEEPROM(2,1,false,false); //no soft alarm switch: force alarm on
+    if(!ENABLE_SOFT_ALARM_SWITCH) changed += writeEEPROM(2,1,false,false); //no soft alarm switch: force alarm 0 on
     if(!ENABLE_SOFT_ALARM_SWITCH || !ENABLE_ALARM_AUTOSKIP) changed += writeEEPROM(23,0,false,false); //no soft switch or no autoskip: force autoskip off
-    if((PIEZO_PIN<0 && PULSE_PIN<0) || !ENABLE_ALARM_FIBONACCI) changed += writeEEPROM(50,0,false,false); //no fibonacci, or no piezo or pulse: force fibonacci off
+    if(!hasFibonacci) for(byte a=0; a<ALARMS; a++) changed += writeEEPROM(alarmLoc(a,AL_FIB),0,false,false); //no fibonacci, or no piezo or pulse: force fibonacci off
   }
   
-  if((PIEZO_PIN<0 && PULSE_PIN<0) || !ENABLE_TIME_CHIME){ //can't do chime
+  if(!hasChime){ //can't do chime
     changed += writeEEPROM(21,0,false,false); //force chime off
   }
   
@@ -215,24 +235,60 @@ void setup(){
 
 void loop(){
   //Every loop cycle, check the RTC and inputs (previously polled, but works fine without and less flicker)
+  checkLoopStats(); //for metrics
   //checkEffects(false); //cleaning and scrolling display effects - not handled by checkRTC since they have their own timing
   checkRTC(false); //if clock has ticked, decrement timer if running, and updateDisplay
   millisApplyDrift();
   checkInputs(); //if inputs have changed, this will do things + updateDisplay as needed
+  #ifdef PIN_TRACE
+  pinTraceCycle(); //writes out the pin trace, if asked to over serial
+  #endif
   if(networkSupported()) cycleNetwork();
   cycleTimer();
   cycleDisplay(displayDim,fnSetPg); //keeps the display hardware multiplexing cycle going
   cycleBacklight();
   cycleSignal();
+  cyclePower(); //if the display is off and nothing is going on, naps until the loop is next needed
 }
 
 
+//Loop stats, for the metrics endpoint (see sendMetrics() in network.cpp) - to catch a clock whose loop is bogging down
+unsigned long loopCount = 0; //since boot
+unsigned long loopLast = 0; //when the last loop started
+unsigned long loopRateStart = 0; //start of the current one-second count
+unsigned long loopRateCount = 0; //loopCount at that start
+word loopRate = 0; //loops per second, per the last full second
+word loopStallMax = 0; //longest loop so far this minute, ms, not counting its nap (see cyclePower())...
+word loopStallMaxLast = 0; //...and in the previous minute, so it doesn't reset to nothing right as it's reported
+byte loopStallSecs = 0; //seconds counted toward the current minute
+byte millisRollovers = 0; //so uptime can outlast millis()
+void checkLoopStats(){
+  unsigned long now = millis();
+  if(loopCount){
+    unsigned long dur = (unsigned long)(now-loopLast)-getPowerNap(); //the nap is the loop having nothing to do
+    if(dur>loopStallMax) loopStallMax = (dur>65535? 65535: dur);
+    if(now<loopLast) millisRollovers++;
+  }
+  loopLast = now; loopCount++;
+  if((unsigned long)(now-loopRateStart)>=1000){
+    loopRate = (loopCount-loopRateCount)*1000/(unsigned long)(now-loopRateStart);
+    loopRateStart = now; loopRateCount = loopCount;
+    if(++loopStallSecs>=60){ loopStallMaxLast = loopStallMax; loopStallMax = 0; loopStallSecs = 0; }
+  }
+}
+unsigned long getUptime(){ return (unsigned long)millisRollovers*4294967 + millis()/1000; } //seconds
+word getLoopRate(){ return loopRate; }
+word getLoopStallMax(){ return (loopStallMax>loopStallMaxLast? loopStallMax: loopStallMaxLast); } //ms, over the last minute or two
+
+
 
 ////////// Input handling and value setting //////////
 
-void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
+void ctrlEvt(byte ctrl, byte evt, byte evtLast, byte velocity){
   //Handle control events from inputs, based on current fn and set state.
-  //evt: 1=press, 2=short hold, 3=long hold, 4=verylong, 5=superlong, 0=release.
+  //evt: 1=press, 2=short hold, 3=long hold, 4=verylong, 5=superlong, 0=release,
+  //6=double press (after its second press), 7=chord (ctrl pressed while evtLast, another ctrl, was held).
+  //velocity: for up/down presses, how fast the input is going (0-255) - see getSetDelta().
   //We only handle press evts for up/down ctrls, as that's the only evt encoders generate,
   //and input.cpp sends repeated presses if up/down buttons are held.
   //But for sel/alt (always buttons), we can handle different hold states here.
@@ -242,7 +298,7 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
     if(ctrl==CTRL_SEL && (evt==0 || evt==5)){ //SEL release or superlong hold
       if(evt==5){ initEEPROM(true); commitEEPROM(); } //superlong hold: reset EEPROM
       versionShowing = false; inputStop(); updateDisplay();
-      if(networkSupported()) initNetwork(); //we didn't do this earlier since the wifi connect makes the clock hang
+      if(networkSupported()) initNetwork(); //we didn't do this earlier in case of EEPROM reset
       return;
     } else {
       return; //ignore other controls
@@ -254,7 +310,7 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
     signalStop();
     if(signalSource==FN_ALARM) { //If this was the alarm
       //If the alarm is using the switch signal and this is the Alt button; or if alarm is *not* using the switch signal and this is Fibonacci mode; don't set the snooze
-      if((readEEPROM(42,false)==1 && CTRL_ALT>0 && ctrl==CTRL_ALT) || (readEEPROM(42,false)!=1 && readEEPROM(50,false))) {
+      if((readEEPROM(alarmLoc(alarmSignaling,AL_SIGNAL),false)==1 && hasAlt && ctrl==CTRL_ALT) || alarmFibonacci(alarmSignaling)) {
         quickBeep(64); //Short signal to indicate the alarm has been silenced until tomorrow
         displayBlink(); //to indicate this as well
       } else { //start snooze
@@ -304,12 +360,12 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
   
   if(networkSupported()){
     //Short hold, Alt; or very long hold, Sel if no Alt: start admin
-    if((evt==2 && ctrl==CTRL_ALT)||(evt==4 && ctrl==CTRL_SEL && CTRL_ALT<=0)) {
+    if((evt==2 && ctrl==CTRL_ALT)||(evt==4 && ctrl==CTRL_SEL && !hasAlt)) {
       networkStartAdmin();
       return;
     }
     //Super long hold, Alt, or Sel if no Alt: start AP (TODO would we rather it forget wifi?)
-    if(evt==5 && (ctrl==CTRL_ALT || (ctrl==CTRL_SEL && CTRL_ALT<=0))) {
+    if(evt==5 && (ctrl==CTRL_ALT || (ctrl==CTRL_SEL && !hasAlt))) {
       networkStartAP();
       return;
     }
@@ -328,7 +384,7 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
       if(evt==2 && ctrl==CTRL_SEL) { //CTRL_SEL hold: enter setting mode
         switch(fn){
           case FN_TOD: //set mins
-            startSet(rtcGetTOD(),0,1439,1); break;
+            startSet(rtcGetTOD(),0,1439,1,FMT_TOD); break;
           case FN_CAL: //depends what page we're on
             if(fnPg==0){ //regular date display: set year
               fnSetValDate[1]=rtcGetMonth(), fnSetValDate[2]=rtcGetDate(); startSet(rtcGetYear(),2000,9999,1);
@@ -336,14 +392,16 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
               startSet(readEEPROM(5,false),1,12,1);
             } else if(fnPg==fnDateSunlast || fnPg==fnDateSunnext){ //lat and long
               //TODO
-            } else if(fnPg==fnDateWeathernow || fnDateWeathernext){ //temperature units??
+            } else if(fnPg==fnDateWeathernow || fnPg==fnDateWeathernext){ //temperature units??
               //TODO
             } break;
           case FN_ALARM: //set mins
-            startSet(readEEPROM(0,true),0,1439,1); break;
+            startSet(readEEPROM(0,true),0,1439,1,FMT_TOD); break;
           case FN_TIMER: //set mins
+            fnPg = 0; //the timer itself, even if on a background countdown or lap
+            if(timerState&1 && !((timerState>>1)&1)) timerPark(); //If a countdown is running, hand it off to the background if possible, to set another
             if(timerTime!=0 || timerState&1) { timerClear(); } // updateDisplay(); break; } //If the timer is nonzero or running, zero it. But rather than stop there, just go straight into setting – since adjDn (or cycling fns) can reset to zero
-            startSet(timerInitialMins,0,5999,1); break; //minutes
+            startSet(timerInitialMins,0,5999,1,FMT_TOD); break; //minutes
           //fnIsDayCount removed in favor of paginated calendar
           case FN_THERM: //could do calibration here if so inclined
           case FN_TUBETEST:
@@ -351,18 +409,29 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
         }
         return;
       }
+      else if(evt==6 && ctrl==CTRL_SEL) { //CTRL_SEL double press: back to the time of day, from any fn or page
+        inputStop(); //so its release doesn't go on to the next fn
+        goToFn(FN_TOD);
+        checkRTC(true); //updates display
+      }
       else if((ctrl==CTRL_SEL && evt==0) || ((ctrl==CTRL_UP || ctrl==CTRL_DN) && evt==1)) { //sel release or adj press
         //we can't handle sel press here because, if attempting to enter setting mode, it would switch the fn first
         if(ctrl==CTRL_SEL){ //sel release
           //Serial.println(F("sel release"));
-          if(fn==FN_TIMER && !(timerState&1)) timerClear(); //if timer is stopped, clear it
-          fnScroll(1); //Go to next fn in the cycle
-          fnPg = 0; //reset page counter in case we were in a paged display
-          checkRTC(true); //updates display
+          if(fn==FN_TIMER && timerNextPage()) updateDisplay(); //the timer's other pages first, if any
+          else {
+            if(fn==FN_TIMER && !(timerState&1)) timerClear(); //if timer is stopped, clear it
+            fnScroll(1); //Go to next fn in the cycle
+            fnPg = 0; //reset page counter in case we were in a paged display
+            checkRTC(true); //updates display
+          }
         }
         else if(ctrl==CTRL_UP || ctrl==CTRL_DN) {
           if(fn==FN_ALARM) switchAlarmState(ctrl==CTRL_UP?1:0); //switch alarm
-          if(fn==FN_TIMER){
+          if(fn==FN_TIMER && fnPg){ //a background countdown or a lap
+            if(fnPg<TIMERS && ctrl==CTRL_DN) timerCancel(fnPg); //background countdown: cancel it
+          }
+          else if(fn==FN_TIMER){
             if(ctrl==CTRL_UP){
               if(!(timerState&1)){ //stopped
                 timerStart();
@@ -401,9 +470,9 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
         }
         //else do nothing
       } //end sel release or adj press
-      else if(CTRL_ALT>0 && ctrl==CTRL_ALT) {
+      else if(hasAlt && ctrl==CTRL_ALT) {
         //if soft power switch, we'll switch on release - but only if not held past activating settings page/AP
-        if(ENABLE_SOFT_POWER_SWITCH && SWITCH_PIN>=0) {
+        if(ENABLE_SOFT_POWER_SWITCH && hasSwitch) {
           //If holds are used to activate network stuff, and we've passed those thresholds, do not switch.
           //Otherwise, switch no matter how long held.
           if(evt==0 && !(networkSupported() && evtLast<2)) switchPower(2);
@@ -507,7 +576,7 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
                 case 1: //save timer mins, set timer secs
                   displayBlink(); //to indicate save.
                   timerInitialMins = fnSetVal; //minutes, up to 5999 (99m 59s)
-                  startSet(timerInitialSecs,0,59,2); break;
+                  startSet(timerInitialSecs,0,59,2,FMT_SECS); break;
                 case 2: //save timer secs
                   displayBlink(); //to indicate save.
                   timerInitialSecs = fnSetVal;
@@ -527,21 +596,23 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
             default: break;
           } //end switch fn
         } //end CTRL_SEL push
-        if(ctrl==CTRL_UP) doSet(velocity ? 10 : 1);
-        if(ctrl==CTRL_DN) doSet(velocity ? -10 : -1);
+        if(ctrl==CTRL_UP || ctrl==CTRL_DN) doSet(getSetDelta(ctrl==CTRL_UP,velocity));
       } //end if evt==1
+      else if(evt==7) { //chord, e.g. Up+Dn or Alt+Sel: exit setting mode without saving
+        clearSet();
+      }
     } //end fn setting
     
   } //end normal fn running/setting
   
   else { //settings menu setting - to/from EEPROM
     
-    byte opt = fn-FN_OPTS; //current setting index
+    OptDef opt = getOpt(fn-FN_OPTS); //current setting
     
     if(evt==2 && ctrl==CTRL_SEL) { //CTRL_SEL short hold: exit settings menu
       inputStop();
       //if we were setting a value, writes setting val to EEPROM if needed
-      if(fnSetPg) writeEEPROM(optsLoc[opt],fnSetVal,optsMax[opt]>255?true:false);
+      if(fnSetPg) writeEEPROM(opt.loc,fnSetVal,opt.size==2);
       fn = FN_TOD;
       //we may have changed lat/long/GMT/DST settings so recalc those
       calcSun(); //TODO pull from clock
@@ -552,7 +623,7 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
     
     if(!fnSetPg){ //setting number
       if(ctrl==CTRL_SEL && evt==0 && evtLast<3) { //CTRL_SEL release (but not after holding to get into the menu): enter setting value
-        startSet(readEEPROM(optsLoc[opt],optsMax[opt]>255?true:false),optsMin[opt],optsMax[opt],1);
+        startSet(readEEPROM(opt.loc,opt.size==2),opt.min,opt.max,1,opt.fmt);
       }
       if(ctrl==CTRL_UP && evt==1) fnOptScroll(1); //next one up or cycle to beginning
       if(ctrl==CTRL_DN && evt==1) fnOptScroll(0); //next one down or cycle to end?
@@ -561,14 +632,16 @@ void ctrlEvt(byte ctrl, byte evt, byte evtLast, bool velocity){
 
     else { //setting value
       if(ctrl==CTRL_SEL && evt==0) { //CTRL_SEL release: save value and exit
-        writeEEPROM(optsLoc[opt],fnSetVal,optsMax[opt]>255?true:false);
+        writeEEPROM(opt.loc,fnSetVal,opt.size==2);
         clearSet();
       }
       if(evt==1 && (ctrl==CTRL_UP || ctrl==CTRL_DN)){
-        if(ctrl==CTRL_UP) doSet(velocity ? 10 : 1);
-        if(ctrl==CTRL_DN) doSet(velocity ? -10 : -1);
+        doSet(getSetDelta(ctrl==CTRL_UP,velocity));
         updateDisplay(); //may also make sounds for sampling
       }
+      if(evt==7) { //chord: exit without saving
+        clearSet();
+      }
     }  //end setting value
   } //end settings menu setting
   
@@ -578,11 +651,10 @@ void fnScroll(byte dir){
   //0=down, 1=up
   //Switch to the next (up) or previous (down) enabled function. This determines the order.
   //We'll use switch blocks *without* breaks to cascade to the next enabled function
-  bool alarmOK = (PIEZO_PIN>=0 || SWITCH_PIN>=0 || PULSE_PIN>=0) && ENABLE_ALARM_FN; //skip alarm if no signals available
   if(dir) { // up
     switch(fn) {
       case FN_TOD: if(ENABLE_DATE_FN) { fn = FN_CAL; break; }
-      case FN_CAL: if(alarmOK) { fn = FN_ALARM; break; }
+      case FN_CAL: if(hasAlarm) { fn = FN_ALARM; break; }
       case FN_ALARM: if(ENABLE_TIMER_FN) { fn = FN_TIMER; break; }
       case FN_TIMER: if(ENABLE_TEMP_FN) { fn = FN_THERM; break; }
       case FN_THERM: if(ENABLE_TUBETEST_FN) { fn = FN_TUBETEST; break; }
@@ -593,7 +665,7 @@ void fnScroll(byte dir){
       case FN_TOD: if(ENABLE_TUBETEST_FN) { fn = FN_TUBETEST; break; } 
       case FN_TUBETEST: if(ENABLE_TEMP_FN) { fn = FN_THERM; break; }
       case FN_THERM: if(ENABLE_TIMER_FN) { fn = FN_TIMER; break; }
-      case FN_TIMER: if(alarmOK) { fn = FN_ALARM; break; }
+      case FN_TIMER: if(hasAlarm) { fn = FN_ALARM; break; }
       case FN_ALARM: if(ENABLE_DATE_FN) { fn = FN_CAL; break; }
       case FN_CAL: default: fn = FN_TOD; break;
     }
@@ -602,39 +674,11 @@ void fnScroll(byte dir){
 void fnOptScroll(byte dir){
   //0=down, 1=up
   //Switch to the next setting, looping around at range ends
-  byte posLast = FN_OPTS+sizeof(optsLoc)-1;
+  byte posLast = FN_OPTS+getOptCount()-1;
   if(dir==1) fn = (fn==posLast? FN_OPTS: fn+1);
   if(dir==0) fn = (fn==FN_OPTS? posLast: fn-1);
-  //Certain settings don't apply to some configurations; skip those.
-  byte optLoc = optsLoc[fn-FN_OPTS];
-  if(!SHOW_IRRELEVANT_OPTIONS && ( //see also: network requestType=1
-      //Signals disabled
-      (PIEZO_PIN<0 && (optLoc==39||optLoc==40||optLoc==41||optLoc==47||optLoc==48||optLoc==49)) //no piezo: skip all pitches and patterns
-      || ((PIEZO_PIN<0 || PULSE_PIN<0) && (optLoc==44)) //no piezo or pulse: skip strike signal type
-      || ((PIEZO_PIN<0 && PULSE_PIN<0) && (optLoc==21||optLoc==50)) //no piezo and pulse: skip the rest of strike, and alarm fibonacci mode
-      || (((PIEZO_PIN>=0)+(SWITCH_PIN>=0)+(PULSE_PIN>=0)<2) && (optLoc==42||optLoc==43)) //fewer than two signal types: skip alarm/timer signal type
-      || (((PIEZO_PIN>=0)+(SWITCH_PIN>=0)+(PULSE_PIN>=0)<1) && (optLoc==23||optLoc==24)) //no signal types: skip the rest of alarm (autoskip and snooze)
-      || ((BACKLIGHT_PIN<0) && (optLoc==26)) //no backlight pin: no backlight control
-      //Functions disabled
-      || (!ENABLE_DATE_FN && (optLoc==17||optLoc==18||optLoc==10||optLoc==12)) //date fn disabled in config: skip date and geography settings - don't skip utc offset as that's now used when setting clock from network ||optLoc==14
-      || (!ENABLE_ALARM_FN && (optLoc==23||optLoc==42||optLoc==39||optLoc==47||optLoc==24||optLoc==50)) //alarm fn disabled in config: skip alarm settings
-      || (!ENABLE_TIMER_FN && (optLoc==43||optLoc==40||optLoc==48)) //timer fn disabled in config: skip timer settings
-      || (!ENABLE_TEMP_FN && (optLoc==45)) //temp fn disabled in config: skip temp format TODO good for weather also
-      //Other functionality disabled
-      || (!ENABLE_DATE_RISESET && (optLoc==10||optLoc==12)) //date rise/set disabled in config: skip geography - don't skip utc offset as that's now used when setting clock from network ||optLoc==14
-      || (!ENABLE_ALARM_AUTOSKIP && (optLoc==23)) //alarm autoskip disabled in config: skip autoskip switch
-      || (!ENABLE_ALARM_FIBONACCI && (optLoc==50)) //fibonacci mode disabled in config: skip fibonacci switch
-      || (!ENABLE_TIME_CHIME && (optLoc==21||optLoc==44||optLoc==41||optLoc==49)) //chime disabled in config: skip chime
-      || (!ENABLE_SHUTOFF_NIGHT && (optLoc==27||optLoc==28||optLoc==30)) //night shutoff disabled in config: skip night
-      || ((!ENABLE_SHUTOFF_NIGHT || !ENABLE_SHUTOFF_AWAY) && (optLoc==32||optLoc==35||optLoc==37)) //night or away shutoff disabled in config: skip away (except workweek)
-      || ((!ENABLE_SHUTOFF_NIGHT || !ENABLE_SHUTOFF_AWAY) && (!ENABLE_ALARM_AUTOSKIP || !ENABLE_ALARM_FN) && (optLoc==33||optLoc==34)) //(night or away) and alarm autoskip disabled: skip workweek
-      //Nixie-specific
-      #ifndef DISPLAY_NIXIE
-      || (optLoc==20||optLoc==46) //digit fade and anti-poisoning
-      #endif
-    )) {
-    fnOptScroll(dir);
-  }
+  //Certain settings don't apply to some configurations (see opts.h); skip those.
+  if(!getOpt(fn-FN_OPTS).applies) fnOptScroll(dir);
 }
 void goToFn(byte thefn, byte thefnPg){ //A shortcut that also sets inputLast per human activity
   fn = thefn;
@@ -666,6 +710,31 @@ byte getAlarmState(){
   //0=off, 1=on with skip, 2=on
   return (readEEPROM(2,false)?2:0)-alarmSkip;
 }
+int alarmLoc(byte a, byte field){
+  //Where field (AL_) of alarm a is kept. Alarm 0 predates the others, so its fields stay where they always were.
+  if(a) return ALARM_LOC+(a-1)*ALARM_SIZE+field;
+  switch(field){
+    case AL_TIME: return 0;
+    case AL_ON: return 2;
+    case AL_DAYS: return 3;
+    case AL_SIGNAL: return 42;
+    case AL_PITCH: return 39;
+    case AL_PATTERN: return 47;
+    default: return 50; //AL_FIB
+  }
+}
+byte alarmDays(byte a){
+  //Which days of the week alarm a goes off, as a bitmask (bit 0 = Sunday). For alarm 0, that's per setting 23:
+  //every day, or the work week or weekend (per settings 33-34) - unless it's set to custom days.
+  if(a || readEEPROM(23,false)==3) return readEEPROM(alarmLoc(a,AL_DAYS),false)&127;
+  byte days = 0;
+  for(byte d=0; d<7; d++) if(readEEPROM(23,false)==0 || isDayInRange(readEEPROM(33,false),readEEPROM(34,false),d)==(readEEPROM(23,false)==1)) days |= 1<<d;
+  return days;
+}
+bool alarmFibonacci(byte a){
+  //Only do fibonacci if enabled and if the alarm is not using the switch signal - otherwise do regular
+  return readEEPROM(alarmLoc(a,AL_FIB),false) && readEEPROM(alarmLoc(a,AL_SIGNAL),false)!=1;
+}
 void switchPower(byte dir){
   //0=down, 1=up, 2=toggle
   signalRemain = 0; snoozeRemain = 0; //in case alarm is going now - alternatively use signalStop()?
@@ -684,13 +753,13 @@ void switchPower(byte dir){
   } else {
     //Serial.print(dir==1?F("switch on"):F("switch off"));
   }
-  digitalWrite(SWITCH_PIN,(dir==1?0:1)); updateBacklight(); //LOW = device on
+  pinWrite(SWITCH_PIN,(dir==1?0:1)); updateBacklight(); //LOW = device on
   //Serial.println(F(", switchPower"));
 }
 
-void startSet(int n, int m, int x, byte p){ //Enter set state at page p, and start setting a value
-  fnSetVal=n; fnSetValMin=m; fnSetValMax=x; fnSetValVel=(x-m>30?1:0); fnSetPg=p; fnSetValDid=false;
-  if(fnSetValMax==59) blankDisplay(0, 3, false); //setting in seconds area - blank h:m
+void startSet(int n, int m, int x, byte p, byte fmt){ //Enter set state at page p, and start setting a value, shown per fmt
+  fnSetVal=n; fnSetValMin=m; fnSetValMax=x; fnSetValVel=(x-m>30?1:0); fnSetPg=p; fnSetValDid=false; fnSetFmt=fmt;
+  if(fnSetFmt==FMT_SECS) blankDisplay(0, 3, false); //setting in seconds area - blank h:m
   else blankDisplay(4, 5, false); //setting in h:m area - blank seconds
   updateDisplay();
 }
@@ -702,15 +771,10 @@ void doSet(int delta){
     if(delta<0) if(fnSetVal-fnSetValMin<abs(delta)) fnSetVal+=((fnSetValMax-fnSetValMin)+1+delta); else fnSetVal=fnSetVal+delta;
     //In some special settings-menu cases, we have to make sure it's a valid value, and if not, doSet again in order to skip it
     if(fn>=FN_OPTS){ //in settings menu
-      switch(optsLoc[fn-FN_OPTS]){ //setting loc, per current setting index
-        case 42: case 43: case 44: //signal type: only allow those which are equipped
-          if( (fnSetVal==0 && PIEZO_PIN>=0)
-            ||(fnSetVal==1 && SWITCH_PIN>=0)
-            ||(fnSetVal==2 && PULSE_PIN>=0)) did = true;
-          //else leave as false
-          break;
+      if(fnSetFmt==FMT_SIGNAL){ if(signalOK(fnSetVal)) did = true; } //signal type: only allow those which are equipped
+      else switch(getOpt(fn-FN_OPTS).loc){ //setting loc, per current setting index
         case 26: //backlighting: skip "follow switch signal" option if not equipped
-          if(fnSetVal<4 || (fnSetVal==4 && SWITCH_PIN>=0)) did = true;
+          if(fnSetVal<4 || (fnSetVal==4 && hasSwitch)) did = true;
           //else leave as false
           break;
         default: did = true; break;
@@ -721,6 +785,19 @@ void doSet(int delta){
   updateDisplay();
 }
 
+int getSetDelta(bool up, byte velocity){
+  //How far an up/down press should move fnSetVal. At velocity 0 (or if the value doesn't support velocity setting), 1.
+  //Otherwise velocity picks a step along 1, 2, 5, 10, 20, 50... up to 1/16 of the value's range - and the value goes to
+  //the next multiple of the step, so it lands on round numbers that are easy to fine-tune from.
+  const int steps[] = {1,2,5,10,20,50,100,200,500,1000};
+  byte n = 1; //how many steps are available for this range
+  while(n<10 && steps[n]<=(fnSetValMax-fnSetValMin+1)/16) n++;
+  int step = (velocity && fnSetValVel? steps[(velocity*(n-1)+127)/255]: 1);
+  int off = ((fnSetVal%step)+step)%step; //fnSetVal can be negative
+  if(up) return step-off;
+  return -(off? off: step);
+}
+
 void clearSet(){ //Exit set state
   startSet(0,0,0,0);
   fnSetValDid=false;
@@ -743,13 +820,14 @@ bool initEEPROM(bool hard){
   //The vars outside the settings menu
   if(hard || readEEPROM(0,true)>1439) changed += writeEEPROM(0,420,true,false); //0-1: alarm at 7am
   //2: alarm on, handled by init
-  //3: free
+  //3: alarm days - see below
   if(hard || readEEPROM(4,false)<0 || readEEPROM(4,false)>2) changed += writeEEPROM(4,2,false,false); //4: day counter direction: count up...
   if(hard || readEEPROM(5,false)<1 || readEEPROM(5,false)>12) changed += writeEEPROM(5,12,false,false); //5: ...December...
   if(hard || readEEPROM(6,false)<1 || readEEPROM(6,false)>31) changed += writeEEPROM(6,31,false,false); //6: ...31st. (This gives the day of the year)
   if(hard) changed += writeEEPROM(7,0,false,false); //7: Alt function preset
   //8: TODO functions/pages enabled (bitmask)
   if(hard) changed += writeEEPROM(15,0,false,false); //15: last known DST on flag - clear on hard reset (to match the reset RTC/auto DST/anti-poisoning settings to trigger midnight tubes as a tube test)
+  if(hard) changed += patternClearTunes(); //256-511: custom tunes
   if(networkSupported()){
     if(hard){ //everything in here needs no range testing
       //51-54 NTP server IP address (4 bytes) - e.g. from https://tf.nist.gov/tf-cgi/servers.cgi
@@ -771,29 +849,57 @@ bool initEEPROM(bool hard){
   } //end network supported
   //The vars inside the settings menu
   bool isInt = false;
-  for(byte opt=0; opt<sizeof(optsLoc); opt++) {
-    isInt = (optsMax[opt]>255?true:false);
-    if(hard || readEEPROM(optsLoc[opt],isInt)<optsMin[opt] || readEEPROM(optsLoc[opt],isInt)>optsMax[opt])
-      changed += writeEEPROM(optsLoc[opt],optsDef[opt],isInt,false);
+  for(byte i=0; i<optCount; i++) {
+    OptDef opt = getOpt(i); isInt = (opt.size==2);
+    if(hard || readEEPROM(opt.loc,isInt)<opt.min || readEEPROM(opt.loc,isInt)>opt.max)
+      changed += writeEEPROM(opt.loc,opt.def,isInt,false);
   } //end for
+  //3: alarm 0's custom days. Unless they're in use, keep them in step with its preset days (settings 23 and 33-34),
+  //so they start from those if custom days are chosen - this is also how a clock from before custom days gets them.
+  if(hard || readEEPROM(23,false)<3 || !readEEPROM(3,false) || readEEPROM(3,false)>127)
+    changed += writeEEPROM(3,(readEEPROM(23,false)<3? alarmDays(0): 127),false,false);
+  //152-175: the other alarms
+  for(byte a=1; a<ALARMS; a++) for(byte field=0; field<ALARM_SIZE; field++) {
+    if(field==AL_TIME+1) continue; //the time's low byte
+    int loc = alarmLoc(a,field); isInt = (field==AL_TIME);
+    OptDef opt = getAlarmOpt(field);
+    if(hard || readEEPROM(loc,isInt)<opt.min || readEEPROM(loc,isInt)>opt.max)
+      changed += writeEEPROM(loc,opt.def,isInt,false);
+  }
   return changed>0; //whether EEPROM was changed
 } //end initEEPROM()
 
+//For validating and listing settings from elsewhere (e.g. the network admin), without exposing the schema
+OptDef getOpt(byte opt){
+  //Copies the settings menu entry out of flash - see opts.h
+  OptDef o; memcpy_P(&o,&opts[opt],sizeof(OptDef)); return o;
+}
+byte getOptCount(){ return optCount; }
+int findOpt(int loc){
+  //Returns the settings menu index of the setting stored at loc, or -1 if it's not a menu setting
+  byte opt = (loc>=0 && loc<OPT_LOCS? pgm_read_byte(&optsByLoc[loc]): 255);
+  return (opt==255? -1: opt);
+}
+OptDef getAlarmOpt(byte field){
+  //Copies the schema entry for an alarm record field out of flash - see alarmOpts in opts.h
+  OptDef o; memcpy_P(&o,&alarmOpts[field],sizeof(OptDef)); return o;
+}
+
 void findFnAndPageNumbers(){
   //Each function, and each page in a paged function, has a number. //TODO should pull from EEPROM 8
   fnDatePages = 1; //date function always has a page for the date itself
   if(ENABLE_DATE_COUNTER && readEEPROM(4,false)){ fnDatePages++; fnDateCounter=fnDatePages-1; }
   if(ENABLE_DATE_RISESET){ fnDatePages++; fnDateSunlast=fnDatePages-1; }
-  if(false){ fnDatePages++; fnDateWeathernow=fnDatePages-1; }
+  if(ENABLE_DATE_WEATHER && networkSupported()){ fnDatePages++; fnDateWeathernow=fnDatePages-1; }
   if(ENABLE_DATE_RISESET){ fnDatePages++; fnDateSunnext=fnDatePages-1; }
-  if(false){ fnDatePages++; fnDateWeathernext=fnDatePages-1; }
+  if(ENABLE_DATE_WEATHER && networkSupported()){ fnDatePages++; fnDateWeathernext=fnDatePages-1; }
 }
 
 
 ////////// Timing and timed events //////////
 
 byte rtcSecLast = 61;
-byte rtcDid = 0; //bitmask to indicate whether we just did things that would be bad to overdo, in case checkRTC is called multiple times during the trigger period (such as if fn is changed during second :00). bit 0 = timer drift correction. At this time other things are OK to overdo since they just restart the same action (alarm/chime signal triggering, date/anti-poisoning display routines) or have other means of canceling (DST change, per DST flag). TODO could get away from this if we move the force stuff into another method?
+unsigned long rtcSecAt = 0; //millis() when we saw rtcSecLast start - for getIdleNap(), and traces (see trace.cpp)
 void checkRTC(bool force){
   //Checks display timeouts;
   //checks for new time-of-day second -> decrements timeouts and checks for timed events;
@@ -816,14 +922,16 @@ void checkRTC(bool force){
     fnPg++; setInputLast(FN_PAGE_TIMEOUT*1000); //but leave inputLastTODMins alone so the subsequent page displays will be based on the same TOD
     while(fnPg<fnDatePages && fnPg<200 && ( //skip inapplicable date pages. The 200 is an extra failsafe
         (!readEEPROM(10,true) && !readEEPROM(12,true) && //if no lat+long specified, skip weather/rise/set
-          (fnPg==fnDateWeathernow || fnPg==fnDateWeathernext || fnPg==fnDateSunlast || fnPg==fnDateSunnext))
+          (fnPg==fnDateWeathernow || fnPg==fnDateWeathernext || fnPg==fnDateSunlast || fnPg==fnDateSunnext)) ||
+        (fnPg==fnDateWeathernow && !findWeather(0,getInputLastTODMins())) || //no forecast (yet) for this period
+        (fnPg==fnDateWeathernext && !findWeather(1,getInputLastTODMins()))
       )) fnPg++;
     if(fnPg >= fnDatePages){ fnPg = 0; fn = FN_TOD; } // when we run out of pages, go back to time. When the half-minute date is triggered, fnPg is set to 254, so it will be 255 here and be cancelled after just the one page.
     force=true;
   }
   //Temporary-display function timeout: if we're *not* in a permanent one (time, or running/signaling timer)
   // Stopped/non-signaling timer shouldn't be permanent, but have a much longer timeout, mostly in case someone is waiting to start the chrono in sync with some event, so we'll give that an hour.
-  else if(fn!=FN_TOD && !(fn==FN_TIMER && (timerState&1 || signalRemain>0))){
+  else if(fn!=FN_TOD && !(fn==FN_TIMER && (timerState&1 || timersRunning || signalRemain>0))){
     if((unsigned long)(now-getInputLast())>=(fn==FN_TIMER?3600:FN_TEMP_TIMEOUT)*1000) { fnSetPg = 0; fn = FN_TOD; force=true; }
   }
   
@@ -854,9 +962,9 @@ void checkRTC(bool force){
       if(snoozeRemain>0) {
         snoozeRemain--;
         //Serial.print("sr "); Serial.println(snoozeRemain,DEC);
-        if(snoozeRemain<=0 && readEEPROM(2,false)) { //alarm on
+        if(snoozeRemain<=0 && readEEPROM(alarmLoc(alarmSignaling,AL_ON),false)) { //alarm on
           fnSetPg = 0; fn = FN_TOD;
-          if(readEEPROM(50,false) && readEEPROM(42,false)!=1) fibonacci(rtcGetHour(),rtcGetMinute(),rtcGetSecond()); //fibonacci sequence
+          if(alarmFibonacci(alarmSignaling)) fibonacci(rtcGetHour(),rtcGetMinute(),rtcGetSecond()); //fibonacci sequence
           else signalStart(FN_ALARM,1); //regular alarm
         }
       }
@@ -865,109 +973,135 @@ void checkRTC(bool force){
       }
     } //end natural second
   
-    //Things to do at specific times
-    //Timer drift correction: per the millisCorrectionInterval
-    if(rtcGetSecond()%millisCorrectionInterval==0){ //if time:
-      if(!(rtcDid&1)) millisCheckDrift(); bitWrite(rtcDid,0,1); //do if not done, set as done
-    } else bitWrite(rtcDid,0,0); //if not time: set as not done
-    //DST change check: every 2am
-    if(rtcGetSecond()==0 && rtcGetMinute()==0 && rtcGetHour()==2) autoDST();
-    //Alarm check: at top of minute for normal alarm, or 23 seconds past for fibonacci (which starts 26m37s early)
-    //Only do fibonacci if enabled and if the alarm is not using the switch signal - otherwise do regular
-    bool fibOK = readEEPROM(50,false) && readEEPROM(42,false)!=1;
-    if((rtcGetSecond()==0 && !fibOK) || (rtcGetSecond()==23 && fibOK)){
-      int alarmTime = readEEPROM(0,true);
-      if(rtcGetSecond()==23){ alarmTime-=27; if(alarmTime<0) alarmTime+=1440; } //set min to n-27 with midnight rollover
-      if(rtcGetHour()*60+rtcGetMinute()==alarmTime){
-        //Serial.println(rtcGetSecond()==23?F("It's fibonacci time"):F("It's regular alarm time"));
-        if(readEEPROM(2,false) && !alarmSkip) { //if the alarm is on and not skipped, sound it!
-          fnSetPg = 0; fn = FN_TOD;
-          if(rtcGetSecond()==23) fibonacci(rtcGetHour(),rtcGetMinute(),rtcGetSecond()); //fibonacci sequence
-          else signalStart(FN_ALARM,1); //regular alarm
-        }
-        //set alarmSkip for the next instance of the alarm
-        alarmSkip =
-          //if alarm is any day of the week
-          (readEEPROM(23,false)==0 ||
-          //or if alarm is weekday only, and tomorrow is a weekday
-          (readEEPROM(23,false)==1 && isDayInRange(readEEPROM(33,false),readEEPROM(34,false),(rtcGetWeekday()==6?0:rtcGetWeekday()+1))) ||
-          //or if alarm is weekend only, and tomorrow is a weekend
-          (readEEPROM(23,false)==2 && !isDayInRange(readEEPROM(33,false),readEEPROM(34,false),(rtcGetWeekday()==6?0:rtcGetWeekday()+1)))
-          ? 0: 1); //then don't skip the next alarm; else skip it
-      } //end alarm trigger
-    }
-    //At bottom of minute, see if we should show the date
-    if(rtcGetSecond()==30 && fn==FN_TOD && fnSetPg==0 && unoffRemain==0 && versionShowing==false) { /*cleanRemain==0 && scrollRemain==0 && */ 
-      if(readEEPROM(18,false)>=2) { goToFn(FN_CAL,254); updateDisplay(); }
-      //if(readEEPROM(18,false)==3) { startScroll(); }
-    }
-    //Anti-poisoning routine triggering: start when applicable, and not at night, during setting, or after a button press (unoff)
-    if(rtcGetSecond()<2 && displayDim==2 && fnSetPg==0 && unoffRemain==0) {
-      //temporarily we'll recalculate the sun stuff every day
-      if(readEEPROM(27,false)>0? //is night shutoff enabled?
-        rtcGetSecond()==0 && rtcGetHour()*60+rtcGetMinute()==readEEPROM(28,true): //if so, at start of night shutoff (at second :00 before dim is in effect)
-        rtcGetSecond()==1 && rtcGetHour()*60+rtcGetMinute()==0) //if not, at 00:00:01
-          calcSun(); //take this opportunity to perform a calculation that blanks the display for a bit
-      // TODO the below will need to change cleanRemain=x to displayClean(x)
-      
-      // switch(readEEPROM(46,false)) { //how often should the routine run?
-      //   case 0: //every day
-      //     if(readEEPROM(27,false)>0? //is night shutoff enabled?
-      //       rtcGetSecond()==0 && rtcGetHour()*60+rtcGetMinute()==readEEPROM(28,true): //if so, at start of night shutoff (at second :00 before dim is in effect)
-      //       rtcGetSecond()==1 && rtcGetHour()*60+rtcGetMinute()==0) //if not, at 00:00:01
-      //         cleanRemain = 151; //run routine for fifteen cycles
-      //     break;
-      //   case 1: //every hour
-      //     if(rtcGetSecond()==1 && rtcGetMinute()==0) //at min/sec :00:01
-      //       cleanRemain = 101; //run routine for ten cycles
-      //     break;
-      //   case 2: //every minute
-      //     if(rtcGetSecond()==1) //at second :01
-      //       cleanRemain = 21; //run routine for two cycles
-      //     break;
-      //   default: break;
-      // }
-    }
-    
-    //NTP cue at :59:00
-    if(rtcGetMinute()==59 && networkSupported()){
-      if(rtcGetSecond()==0) cueNTP();
-      if(rtcGetSecond()==30 && ntpSyncAgo()>=30000) cueNTP(); //if at first you don't succeed...
-    }
-    
-    //Strikes - only if fn=clock, not setting, not signaling/snoozing, not night/away. Setting 21 will be off if signal type is no good
-    //The six pips
-    if(rtcGetMinute()==59 && rtcGetSecond()==55 && readEEPROM(21,false)==2 && signalRemain==0 && snoozeRemain==0 && fn==FN_TOD && fnSetPg==0 && displayDim==2) {
-      signalStart(FN_TOD,6); //the signal code knows to use pip durations as applicable
-    }
-    //Strikes on/after the hour
-    if(rtcGetSecond()==0 && (rtcGetMinute()==0 || rtcGetMinute()==30) && signalRemain==0 && snoozeRemain==0 && fn==FN_TOD && fnSetPg==0 && displayDim==2){
-      byte hr; hr = rtcGetHour(); hr = (hr==0?12:(hr>12?hr-12:hr));
-      switch(readEEPROM(21,false)) {
-        case 1: //single beep
-          if(rtcGetMinute()==0) signalStart(FN_TOD,0); break;
-        case 3: //hour strike via normal signal cycle
-          if(rtcGetMinute()==0) signalStart(FN_TOD,hr); break;
-        case 4: //ship's bell at :00 and :30 mins via normal signal cycle
-          signalStart(FN_TOD,((hr%4)*2)+(rtcGetMinute()==30?1:0)); break;
-        default: break;
-      } //end strike type
-    } //end strike
+    //Things to do at specific times - see checkTimeline()
+    checkTimeline();
     
     //Finally, update the display, whether natural tick or not, as long as we're not setting or on a scrolled display (unless forced eg. fn change)
     //This also determines night/away shutoff, which is why strikes will happen if we go into off at top of hour, and not when we come into on at the top of the hour TODO find a way to fix this
     //Also skip updating the display if this is date and not being forced, since its pages take some calculating that cause it to flicker
     if(fnSetPg==0 && (true || force) && !(fn==FN_CAL && !force)) updateDisplay(); /*scrollRemain==0 ||*/
     
+    if(rtcSecLast != rtcGetSecond()) rtcSecAt = now;
     rtcSecLast = rtcGetSecond();
     
   } //end if force or new second
 } //end checkRTC()
+unsigned long getRtcSecAt(){ return rtcSecAt; }
+
+//Timed events are kept in a timeline (see timeline.cpp), each with the time it's next due, so each tick only needs to
+//compare the time against the earliest. When one comes due, it's handled, and scheduled again for its next time.
+//They are all rescheduled when a setting changes (which may change their times), or when the clock is set.
+unsigned long timelineLast = 0; //time of the last tick handled, per timelineSeconds() - 0 to start afresh
+word timelineChanges = 0; //getStorageChanges() as of the last schedule
+void checkTimeline(){
+  //Handles any timed events that have come due, as of the current RTC snapshot
+  unsigned long now = timelineSeconds(rtcGetYear(),rtcGetMonth(),rtcGetDate(),rtcGetHour(),rtcGetMinute(),rtcGetSecond());
+  if(!timelineLast || (now>timelineLast? now-timelineLast: timelineLast-now)>TL_JUMP){
+    //Starting, or the clock has been set: from here on, events due from this second on
+    timelineLast = now-1; timelineChanges = getStorageChanges()-1;
+  }
+  if(timelineChanges!=getStorageChanges()){ //settings changed - reschedule everything not yet handled
+    timelineChanges = getStorageChanges();
+    timelineClear();
+    for(byte type=0; type<TL_TYPES; type++) timelineAdd(type,scheduleEvent(type,timelineLast));
+  }
+  while(timelineNext()<=now){ //if the clock stepped back, this waits until it catches up again
+    unsigned long at = timelineNext();
+    byte type = timelinePop();
+    timelineAdd(type,scheduleEvent(type,at));
+    timedEvent(type);
+  }
+  if(now>timelineLast) timelineLast = now;
+}
+unsigned long scheduleEvent(byte type, unsigned long after){
+  //When event type is next due, after the given time, per the current settings (or TL_NEVER)
+  if(type>=TL_ALARM && type<TL_ALARM+ALARMS){
+    //At top of minute for normal alarm, or 26m37s earlier for fibonacci, on the next of its days.
+    //Alarm 0 goes daily instead, on or off, and applies its days via alarmSkip (see timedEvent()), so it can be skipped/unskipped
+    //on the clock - and so the skip is current when it's switched back on.
+    byte a = type-TL_ALARM;
+    byte days = (a? alarmDays(a): 127);
+    if((a && !readEEPROM(alarmLoc(a,AL_ON),false)) || !days) return TL_NEVER;
+    unsigned long lead = (alarmFibonacci(a)? 1597: 0), at = after+lead;
+    do at = timelineAfter(at,86400,readEEPROM(alarmLoc(a,AL_TIME),true)*60UL); while(!((days>>timelineWeekday(at))&1));
+    return at-lead;
+  }
+  switch(type){
+    case TL_DRIFT: return timelineAfter(after,millisCorrectionInterval,0);
+    case TL_DST: return timelineAfter(after,86400,7200); //2am
+    case TL_DATE: return (readEEPROM(18,false)>=2? timelineAfter(after,60,30): TL_NEVER);
+    case TL_CLEAN: return timelineAfter(after,86400,(readEEPROM(27,false)>0? readEEPROM(28,true)*60UL: 1)); //at start of night shutoff, or if none, at 00:00:01
+    case TL_NTP: {
+      if(!networkSupported()) return TL_NEVER;
+      unsigned long cue = timelineAfter(after,3600,3540), retry = timelineAfter(after,3600,3570); //:59:00, :59:30
+      return (cue<retry? cue: retry);
+    }
+    case TL_PIPS: return (readEEPROM(21,false)==2? timelineAfter(after,3600,3595): TL_NEVER); //:59:55
+    case TL_STRIKE:
+      switch(readEEPROM(21,false)){
+        case 1: case 3: return timelineAfter(after,3600,0); //single beep, hour strike
+        case 4: return timelineAfter(after,1800,0); //ship's bell at :00 and :30
+        default: return TL_NEVER;
+      }
+    default: return TL_NEVER;
+  }
+}
+void timedEvent(byte type){
+  //Handles an event that has come due - things like night shutoff and signals going are checked now
+  if(type>=TL_ALARM && type<TL_ALARM+ALARMS){
+    byte a = type-TL_ALARM;
+    if(readEEPROM(alarmLoc(a,AL_ON),false) && !(a==0 && alarmSkip)) { //if the alarm is on and not skipped, sound it!
+      if(alarmSignaling!=a){ signalStop(); alarmSignaling = a; } //stop another alarm's signal per its own settings, before switching to this one's
+      fnSetPg = 0; fn = FN_TOD;
+      if(alarmFibonacci(a)) fibonacci(rtcGetHour(),rtcGetMinute(),rtcGetSecond()); //fibonacci sequence
+      else signalStart(FN_ALARM,1); //regular alarm
+    }
+    if(a==0){ //set alarmSkip for the next instance of alarm 0: skip it if tomorrow isn't one of its days
+      unsigned long tomorrow = timelineSeconds(rtcGetYear(),rtcGetMonth(),rtcGetDate(),rtcGetHour(),rtcGetMinute(),rtcGetSecond())+(alarmFibonacci(0)? 1597: 0)+86400;
+      alarmSkip = !((alarmDays(0)>>timelineWeekday(tomorrow))&1);
+    }
+    return;
+  }
+  switch(type){
+    case TL_DRIFT: //timer drift correction, per the millisCorrectionInterval
+      millisCheckDrift(); break;
+    case TL_DST: //DST change check
+      autoDST(); break;
+    case TL_DATE: //at bottom of minute, see if we should show the date
+      if(fn==FN_TOD && fnSetPg==0 && unoffRemain==0 && versionShowing==false) { goToFn(FN_CAL,254); updateDisplay(); }
+      break;
+    case TL_CLEAN: //anti-poisoning routine triggering: start when applicable, and not at night, during setting, or after a button press (unoff)
+      //temporarily we'll recalculate the sun stuff every day
+      if(displayDim==2 && fnSetPg==0 && unoffRemain==0) calcSun(); //take this opportunity to perform a calculation that blanks the display for a bit
+      break;
+    case TL_NTP: //NTP cue at :59:00
+      if(rtcGetSecond()<30 || ntpSyncAgo()>=30000) cueNTP(); //at :30, if at first you don't succeed...
+      break;
+    case TL_PIPS: //the six pips - only if fn=clock, not setting, not signaling/snoozing, not night/away
+      if(signalRemain==0 && snoozeRemain==0 && fn==FN_TOD && fnSetPg==0 && displayDim==2) signalStart(FN_TOD,6); //the signal code knows to use pip durations as applicable
+      break;
+    case TL_STRIKE: //strikes on/after the hour - likewise. Setting 21 will be off if signal type is no good
+      if(signalRemain==0 && snoozeRemain==0 && fn==FN_TOD && fnSetPg==0 && displayDim==2){
+        byte hr; hr = rtcGetHour(); hr = (hr==0?12:(hr>12?hr-12:hr));
+        switch(readEEPROM(21,false)) {
+          case 1: //single beep
+            signalStart(FN_TOD,0); break;
+          case 3: //hour strike via normal signal cycle
+            signalStart(FN_TOD,hr); break;
+          case 4: //ship's bell at :00 and :30 mins via normal signal cycle
+            signalStart(FN_TOD,((hr%4)*2)+(rtcGetMinute()==30?1:0)); break;
+          default: break;
+        } //end strike type
+      }
+      break;
+    default: break;
+  }
+}
 
 void fibonacci(byte h, byte m, byte s){
   //This powers the alarm fibonacci feature, using snooze and quick beeps.
   //Find difference between alarm time and current time, in minutes, with midnight rollover
-  int diff = readEEPROM(0,true)-(h*60+m); if(diff<0) diff+=1440;
+  int diff = readEEPROM(alarmLoc(alarmSignaling,AL_TIME),true)-(h*60+m); if(diff<0) diff+=1440;
   //Serial.print(F("diff min ")); Serial.print(diff,DEC);
   //If we are within 30 minutes of alarm time, do Fibonacci stuff
   //This is so the difference can stay an int once we convert it to seconds
@@ -1042,9 +1176,10 @@ bool isDSTByHour(int y, byte m, byte d, byte h, bool setFlag){
   }
   return dstNow;
 }
-byte nthSunday(int y, byte m, byte nth){
+byte nthSunday(int y, byte m, int nth){
+  //Date of the nth Sunday of the month, or if nth is negative, counting back from the end (-1 = last)
   if(nth>0) return (((7-dayOfWeek(y,m,1))%7)+1+((nth-1)*7));
-  if(nth<0) return (dayOfWeek(y,m,1)==0 && daysInMonth(y,m)>28? 29: nthSunday(y,m,1)+21+((nth+1)*7));
+  if(nth<0) return (daysInMonth(y,m)-dayOfWeek(y,m,daysInMonth(y,m))+((nth+1)*7));
   return 0;
 }
 byte daysInMonth(word y, byte m){
@@ -1075,7 +1210,9 @@ byte dayOfWeek(word y, byte m, byte d){
 int dateComp(int y, byte m, byte d, byte mt, byte dt, bool countUp){
   //If m+d is later   { if count up from, use last year, else use this year }: in Feb, count up from last Mar or down to this Mar
   //If m+d is earlier { if count down to, use next year, else use this year }: in Feb, count down to next Jan or up from this Jan
-  bool targetDir = mt*100+dt>=m*100+d+(countUp&&!(mt==12&&dt==31)?1:0); //if count up from 12/31 (day of year), show 365/366 instead of 0
+  //In common years, 2/29 falls on 3/1 - as dateToDayCount() has it
+  byte mty = mt; byte dty = dt; if(mt==2 && dt==29 && daysInMonth(y,2)<29){ mty = 3; dty = 1; }
+  bool targetDir = mty*100+dty>=m*100+d+(countUp&&!(mt==12&&dt==31)?1:0); //if count up from 12/31 (day of year), show 365/366 instead of 0
   int targetYear = (countUp && targetDir? y-1: (!countUp && !targetDir? y+1: y));
   int targetDayCount; targetDayCount = dateToDayCount(targetYear, mt, dt);
   if(targetYear<y) targetDayCount -= daysInYear(targetYear);
@@ -1178,6 +1315,8 @@ void timerStart(){
   //If timer (count down), timestamp is a destination in the future: now plus duration.
   timerTime = ((timerState>>1)&1? ms() - timerTime: ms() + timerTime);
   if(!((timerState>>1)&1)) timerSleepSwitch(1); //possibly toggle the switch signal, but only if counting down
+  if((timerState>>1)&1) expirySet(EXP_MAX,timerTime+360000000); //chrono: when it will max out (100h, or 360M ms)
+  else expirySet(0,timerTime); //timer: when it will run out
   quickBeep(69);
 } //end timerStart()
 void timerStop(){
@@ -1190,6 +1329,7 @@ void timerStop(){
   if(!((timerState>>1)&1)) timerSleepSwitch(0); //possibly toggle the switch signal, but only if counting down
   quickBeep(64);
   bitWrite(timerState,4,0); //set timer lap display (bit 4) to off (0)
+  expiryCancel(0); expiryCancel(EXP_LAP); expiryCancel(EXP_MAX);
   updateDisplay(); //since cycleTimer won't do it
 }
 void timerClear(){
@@ -1198,78 +1338,118 @@ void timerClear(){
   timerTime = 0; //set timer duration
   timerSleepSwitch(0);
   bitWrite(timerState,4,0); //set timer lap display (bit 4) to off (0)
+  expiryCancel(0); expiryCancel(EXP_LAP); expiryCancel(EXP_MAX);
+  timerLapNext = 0; timerLapCount = 0;
   //updateDisplay is called not long after this
 }
 void timerLap(){
   timerLapTime = ms();
   bitWrite(timerState,4,1); //set timer lap display (bit 4) to on (1)
+  expirySet(EXP_LAP,timerLapTime+3000); //for 3 seconds
+  timerLaps[timerLapNext] = timerLapTime-timerTime; //keep it for review, over the oldest
+  timerLapNext = (timerLapNext+1)%TIMER_LAPS;
+  if(timerLapCount<255) timerLapCount++;
   quickBeep(81);
 }
+bool timerPark(){
+  //Hands the running countdown off to a free background one, so another can be set. Returns whether it could:
+  //not if they're all running, or if the timer uses the switch signal, since that follows the countdown on display.
+  if(readEEPROM(43,false)==1) return false;
+  for(byte t=1; t<TIMERS; t++) if(!((timersRunning>>t)&1)){
+    timerEnds[t] = timerTime; bitWrite(timersRunning,t,1);
+    expirySet(t,timerTime);
+    expiryCancel(0); bitWrite(timerState,0,0); timerTime = 0; //timer 0 is now free (timerClear() is about to tidy up)
+    return true;
+  }
+  return false;
+}
+void timerCancel(byte t){
+  //Stops background countdown t
+  bitWrite(timersRunning,t,0); expiryCancel(t);
+  quickBeep(64);
+  fnPg = 0; updateDisplay();
+}
+bool timerNextPage(){
+  //The timer function's pages, after the timer itself, are each running background countdown, then each lap
+  //(latest first) if the chrono is stopped. Goes to the next page, flashing its number, if there is one.
+  byte laps = ((timerState&3)==2? (timerLapCount<TIMER_LAPS? timerLapCount: TIMER_LAPS): 0); //stopped, counting up
+  for(byte pg=fnPg+1; pg<TIMERS+laps; pg++) if(pg>=TIMERS || (timersRunning>>pg)&1){
+    fnPg = pg;
+    tempDisplay(pg<TIMERS? pg+1: timerLapCount-(pg-TIMERS)); //countdown number (the timer itself is 1), or lap number
+    return true;
+  }
+  return false;
+}
+unsigned long timerLapGet(byte i){
+  //The chrono's lap i, counting back from the latest (0)
+  return timerLaps[(timerLapNext+TIMER_LAPS-1-i)%TIMER_LAPS];
+}
 void timerRunoutToggle(){
-  if(PIEZO_PIN>=0){ //if piezo equipped
+  if(hasPiezo){ //if piezo equipped
     //cycle thru runout options: 00 stop, 01 repeat, 10 chrono, 11 chrono short signal
     timerState ^= (1<<2); //toggle runout repeat bit
     if(!((timerState>>2)&1)) timerState ^= (1<<3); //if it's 0, toggle runout chrono bit
     //do a quick signal to indicate the selection
     signalPattern = ((timerState>>2)&3)+1; //convert 00/01/10/11 to 1/2/3/4
-    signalSource = FN_TIMER;
+    signalSource = FN_TIMER; timerSignaling = 0;
     signalStart(-1,0); //Play a signal measure using above pattern and source
   }
 }
 void cycleTimer(){
-  if(timerState&1){ //If the timer is running
-    //Check if we've hit a wall
-    if(!((timerState>>1)&1)){ //If we are counting down,
-      if((unsigned long)(ms()-timerTime)<1000){ //see if now is past timerTime (diff has rolled over)
-        //timer has run out
-        //runout action and display
-        if((timerState>>3)&1){ //runout chrono - keep target, change direction, kill sleep, change display
-          bitWrite(timerState,1,1); //set timer direction (bit 1) to up (1)
-          timerSleepSwitch(0);
-          fnSetPg = 0; fn = FN_TIMER;
-        } else {
-          if((timerState>>2)&1){ //runout repeat - keep direction, change target, keep sleep, don't change display
-            timerTime += (timerInitialMins*60000)+(timerInitialSecs*1000); //set timer duration ahead by initial setting
-          } else { //runout clear - clear timer, change display
-            timerClear();
-            //If switch signal (radio sleep), go to time of day; otherwise go to empty timer to appear with signal
-            fnSetPg = 0; fn = (readEEPROM(43,false)==1 ? FN_TOD: FN_TIMER);
-            updateDisplay();
-          }
-        }
-        //piezo or pulse signal
-        if((timerState>>2)&1){ //short signal (piggybacks on runout repeat flag)
-          if(readEEPROM(43,false)!=1) signalStart(FN_TIMER,1);
-          //using 1 instead of 0, because in signalStart, FN_TIMER "quick measure" has a custom pitch for runout option setting
-        } else { //long signal
-          if(readEEPROM(43,false)!=1) signalStart(FN_TIMER,SIGNAL_DUR);
+  //Handles whatever timers have come due, per the expiry queue (see expiry.cpp) - only the soonest is checked each time
+  //If the chrono is over the amount we can display by a LOT, it was probably due to a rare overflow possibility right after starting (see ms()) – so just restart.
+  if((timerState&3)==3 && (unsigned long)(ms()-timerTime)>=370000000){ timerTime = ms(); expirySet(EXP_MAX,timerTime+360000000); }
+  byte id;
+  while((id = expiryDue(ms()))!=EXP_NONE){
+    if(id==0){ //timer has run out
+      //runout action and display
+      if((timerState>>3)&1){ //runout chrono - keep target, change direction, kill sleep, change display
+        bitWrite(timerState,1,1); //set timer direction (bit 1) to up (1)
+        expirySet(EXP_MAX,timerTime+360000000);
+        timerSleepSwitch(0);
+        fnSetPg = 0; fn = FN_TIMER; fnPg = 0;
+      } else {
+        if((timerState>>2)&1){ //runout repeat - keep direction, change target, keep sleep, don't change display
+          timerTime += (timerInitialMins*60000)+(timerInitialSecs*1000); //set timer duration ahead by initial setting
+          expirySet(0,timerTime);
+        } else { //runout clear - clear timer, change display
+          timerClear();
+          //If switch signal (radio sleep), go to time of day; otherwise go to empty timer to appear with signal
+          fnSetPg = 0; fn = (readEEPROM(43,false)==1 ? FN_TOD: FN_TIMER); fnPg = 0;
+          updateDisplay();
         }
       }
-    } else { //If we are counting up,
-      if((timerState>>4)&1){ //if we're doing a lap display, see if we need to cancel it after 3 seconds
-        if((unsigned long)(ms()-timerLapTime)>=3000) bitWrite(timerState,4,0); //set timer lap display (bit 4) to cancel (0)
-      }
-      if((unsigned long)(ms()-timerTime)>=360000000){ //find out if now is over the amount we can display (100h, or 360M ms)
-        //chrono has maxed out
-        // if it has maxed out by a LOT, it was probably due to a rare overflow possibility right after starting (see ms()) – so just restart.
-        if((unsigned long)(ms()-timerTime)>=370000000) timerTime = ms();
-        else timerClear();
-        // I thought about restarting anytime the chrono maxes out, but I don't really want to support leaving the chrono running indefinitely, since the display has no good function indicator – an unfamiliar user might accidentally start the chrono, then later be looking for the idle `0` which is the surefire timer/chrono indicator and never find it. This is the same reason I make it reset if the user switches away while it's stopped.
-        // Serial.print(F("Chrono has maxed out per "));
-        // Serial.print(ms(),DEC);
-        // Serial.print(F("-"));
-        // Serial.print(timerTime,DEC);
+      //piezo or pulse signal
+      timerSignaling = 0;
+      if((timerState>>2)&1){ //short signal (piggybacks on runout repeat flag)
+        if(readEEPROM(43,false)!=1) signalStart(FN_TIMER,1);
+        //using 1 instead of 0, because in signalStart, FN_TIMER "quick measure" has a custom pitch for runout option setting
+      } else { //long signal
+        if(readEEPROM(43,false)!=1) signalStart(FN_TIMER,SIGNAL_DUR);
       }
     }
-    //If it's on display, update
-    if(fn==FN_TIMER) updateDisplay();
+    else if(id<TIMERS){ //a background countdown has run out - it's done, so just signal
+      bitWrite(timersRunning,id,0);
+      if(fn==FN_TIMER && fnPg==id) fnPg = 0;
+      timerSignaling = id;
+      if(readEEPROM(43,false)!=1) signalStart(FN_TIMER,SIGNAL_DUR);
+    }
+    else if(id==EXP_LAP){ //lap display is done, after 3 seconds
+      bitWrite(timerState,4,0); //set timer lap display (bit 4) to cancel (0)
+    }
+    else if(id==EXP_MAX){ //chrono has maxed out
+      timerClear();
+      // I thought about restarting anytime the chrono maxes out, but I don't really want to support leaving the chrono running indefinitely, since the display has no good function indicator – an unfamiliar user might accidentally start the chrono, then later be looking for the idle `0` which is the surefire timer/chrono indicator and never find it. This is the same reason I make it reset if the user switches away while it's stopped.
+    }
   }
+  //If it's on display, update
+  if(fn==FN_TIMER && (timerState&1 || timersRunning)) updateDisplay();
 } //end cycleTimer()
 void timerSleepSwitch(bool on){
   //When timer is set to use switch signal, it's on while timer is running, "radio sleep" style.
   //We won't use the true signal methods so that other signals might not interrupt it. TODO confirm
   if(readEEPROM(43,false)==1) { //start "radio sleep"
-    digitalWrite(SWITCH_PIN,(on?LOW:HIGH)); updateBacklight(); //LOW = device on
+    pinWrite(SWITCH_PIN,(on?LOW:HIGH)); updateBacklight(); //LOW = device on
     // Serial.print(millis(),DEC);
     // if(on) Serial.println(F(" Switch signal on, timerSleepSwitch"));
     // else   Serial.println(F(" Switch signal off, timerSleepSwitch"));
@@ -1280,6 +1460,12 @@ void setTimerState(char pos, bool val){
   if(val) timerState |= (1<<pos); else timerState &= ~(1<<pos);
 }
 
+//For the display mirror (see sendEvent() in network.cpp)
+byte getDisplayDim(){ return displayDim; }
+byte getFn(){ return fn; }
+byte getFnPg(){ return fnPg; }
+byte getFnSetPg(){ return fnSetPg; }
+
 void tempDisplay(int i0, int i1, int i2, int i3){ //TODO can you improve this
   tempValDispQueue[0] = i0;
   tempValDispQueue[1] = i1;
@@ -1344,28 +1530,25 @@ void updateDisplay(){
   else if(fnSetPg) { //setting value, for either fn or settings menu
     displayDim = 2;
     // blankDisplay(4, 5, false); //taken over by startSet
-    byte fnOptCurLoc = (fn>=FN_OPTS? optsLoc[fn-FN_OPTS]: 0); //current setting index loc, to tell what's being set
-    if(fnSetValMax==1439) { //Time of day (0-1439 mins, 0:00–23:59): show hrs/mins
-      editDisplay(fnSetVal/60, 0, 1, readEEPROM(19,false), false); //hours with leading zero per settings
-      editDisplay(fnSetVal%60, 2, 3, true, false);
-    } else if(fnSetValMax==5999) { //Timer duration mins (0-5999 mins, up to 99:59): show hrs/mins w/regular leading
+    byte fnOptCurLoc = (fn>=FN_OPTS? getOpt(fn-FN_OPTS).loc: 0); //current setting loc, to tell what's being set
+    if(fnSetFmt==FMT_TOD) { //Time of day (0-1439 mins, 0:00–23:59) or timer duration (0-5999 mins, up to 99:59): show hrs/mins
       editDisplay(fnSetVal/60, 0, 1, readEEPROM(19,false), false); //hours with leading zero per settings
       editDisplay(fnSetVal%60, 2, 3, true, false); //minutes with leading zero always
-    } else if(fnSetValMax==59) { //Timer duration secs: show with leading
+    } else if(fnSetFmt==FMT_SECS) { //Timer duration secs: show with leading
       //If 6 digits (0-5), display on 4-5
       //If 4 digits (0-3), dislpay on 2-3
       // blankDisplay(0, 3, false); //taken over by startSet
       editDisplay(fnSetVal, (DISPLAY_SIZE>4? 4: 2), (DISPLAY_SIZE>4? 5: 3), true, false);
-    } else if(fnSetValMax==88) { //A piezo pitch. Play a short demo beep.
+    } else if(fnSetFmt==FMT_PITCH) { //A piezo pitch. Play a short demo beep.
       editDisplay(fnSetVal, 0, 3, false, false);
       quickBeep(fnSetVal); //Can't use signalStart since we need to specify pitch directly
-    } else if(fnOptCurLoc==47 || fnOptCurLoc==48 || fnOptCurLoc==49) { //Signal pattern. Play a demo measure.
+    } else if(fnSetFmt==FMT_PATTERN) { //Signal pattern. Play a demo measure.
       editDisplay(fnSetVal, 0, 3, false, false);
       quickBeepPattern((fnOptCurLoc==49?FN_TOD:(fnOptCurLoc==48?FN_TIMER:FN_ALARM)),fnSetVal);
-    } else if(fnSetValMax==156) { //Timezone offset from UTC in quarter hours plus 100 (since we're not set up to support signed bytes)
+    } else if(fnSetFmt==FMT_UTC) { //Timezone offset from UTC in quarter hours plus 100 (since we're not set up to support signed bytes)
       editDisplay((abs(fnSetVal-100)*25)/100, 0, 1, fnSetVal<100, false); //hours, leading zero for negatives
       editDisplay((abs(fnSetVal-100)%4)*15, 2, 3, true, false); //minutes, leading zero always
-    } else if(fnSetValMax==900 || fnSetValMax==1800) { //Lat/long in tenths of a degree
+    } else if(fnSetFmt==FMT_COORD) { //Lat/long in tenths of a degree
       //If 6 digits (0-5), display degrees on 0-3 and tenths on 4, with 5 blank
       //If 4 digits (0-3), display degrees on 0-2 and tenths on 3
       editDisplay(abs(fnSetVal), 0, (DISPLAY_SIZE>4? 4: 3), fnSetVal<0, false);
@@ -1373,7 +1556,7 @@ void updateDisplay(){
   }
   else if(fn >= FN_OPTS){ //settings menu, but not setting a value
     displayDim = 2;
-    editDisplay(optsNum[fn-FN_OPTS],0,1,false,false); //display setting number on hour digits
+    editDisplay(getOpt(fn-FN_OPTS).num,0,1,false,false); //display setting number on hour digits
     blankDisplay(2,5,false);
   }
   else { //fn running
@@ -1442,18 +1625,21 @@ void updateDisplay(){
         }
         break;
       case FN_TIMER: //timer - display time
-        unsigned long td; td = (!(timerState&1)? timerTime: //If stopped, use stored duration
+        bool tup; tup = (fnPg>=TIMERS || (!fnPg && (timerState>>1)&1)); //counting up: chrono or lap
+        unsigned long td; td = (fnPg>=TIMERS? timerLapGet(fnPg-TIMERS): //lap page
+          (fnPg? ((timersRunning>>fnPg)&1? timerEnds[fnPg]-ms(): 0): //background countdown page
+          (!(timerState&1)? timerTime: //If stopped, use stored duration
           //If running, use same math timerStop() does to calculate duration
           ((timerState>>1)&1? ((timerState>>4)&1? timerLapTime: ms()) - timerTime: //count up - use timerLapTime during lap display
             timerTime - ms() //count down
           )
-        );
+        )));
         byte tdc; tdc = (td%1000)/10; //capture hundredths (centiseconds)
-        td = td/1000+(!((timerState>>1)&1)&&tdc!=0?1:0); //remove mils, and if countdown, round up
+        td = td/1000+(!tup&&tdc!=0?1:0); //remove mils, and if countdown, round up
         //Countdown shows H:M:S, but on DISPLAY_SIZE<6 and H<1, M:S
         //Countup shows H:M:S, but if H<1, M:S:C, but if DISPLAY_SIZE<6 and M<1, S:C
         bool lz; lz = readEEPROM(19,false)&1;
-        if((timerState>>1)&1){ //count up
+        if(tup){ //count up
           if(DISPLAY_SIZE<6 && td<60){ //under 1 min, 4-digit displays: [SS]CC--
             if(td>=1||lz) editDisplay(td,0,1,lz,true); else blankDisplay(0,1,true); //secs, leading per lz, fade
             editDisplay(tdc,2,3,td>=1||lz,false); //cents, leading if >=1sec or lz, no fade
@@ -1518,7 +1704,10 @@ void updateDisplay(){
   //Write display changes to console
   //for(byte w=0; w<6; w++) { if(displayNext[w]>9) Serial.print(F("-")); else Serial.print(displayNext[w],DEC); }
   //Serial.println();
-       
+  
+  #ifdef INPUT_TRACE
+  traceDisplayed(); //for the event-to-display latency
+  #endif
 } //end updateDisplay()
 
 // void serialPrintDate(int y, byte m, byte d){
@@ -1615,12 +1804,44 @@ void calcSun(){}
 void displaySun(byte which, int d, int tod){}
 #endif
 
+#if ENABLE_DATE_WEATHER
+const WeatherPeriod* findWeather(byte which, int tod){
+  //Finds the cached forecast (see weather.cpp) for the current sun period (which==0) or the next one (which==1),
+  //per today's sunrise/sunset if we have them, or 6am/6pm if not. A night belongs to the date it starts on.
+  int rise = 360; int set = 1080;
+  #if ENABLE_DATE_RISESET
+  if(sunDate==rtcGetDate() && sunRise1>=0 && sunSet1>=0){ rise = sunRise1; set = sunSet1; }
+  #endif
+  word y = rtcGetYear(); byte m = rtcGetMonth(); byte d = rtcGetDate();
+  int days = 0; bool night = true; //relative to today
+  if(tod<rise) days = -1; //last night
+  else if(tod<set) night = false; //today
+  if(which){ if(night){ days++; night = false; } else night = true; }
+  if(days<0){ d--; if(d<1){ m--; if(m<1){ y--; m=12; } d=daysInMonth(y,m); }}
+  if(days>0){ d++; if(d>daysInMonth(y,m)){ d=1; m++; if(m>12){ m=1; y++; }}}
+  return getWeather(m,d,night);
+}
 void displayWeather(byte which){
-  //shows high/low temp (for day/night respectively) in place of hour/min, and precipitation info in place of seconds
+  //shows high/low temp (for day/night respectively) in place of hour/min, and precipitation chance in place of seconds
   //which==0: display for current sun period (after last sun event)
   //which==1: display for next sun period (after next sun event)
-  //IoT: Show the weather for the current period (after last sun event): high (day) or low (night) and precip info//IoT: Show the weather for the period after the next sun event
+  //Like the sun displays, based on the time of day when the function display was triggered
+  const WeatherPeriod *w = findWeather(which,getInputLastTODMins());
+  if(!w){ blankDisplay(0,5,true); return; } //the page would have been skipped, but the forecast may have expired since
+  int temp = (w->night? w->low: w->high);
+  if(temp==WEATHER_NONE) blankDisplay(0,3,true);
+  else {
+    if(readEEPROM(45,false)==1) temp = (temp*18+(temp<0?-5:5))/10+32; //°F, rounded
+    editDisplay(abs(temp),0,3,(temp<0),true); //leading zeros if negative
+  }
+  if(w->precip>100) blankDisplay(4,5,true);
+  else editDisplay((w->precip>99? 99: w->precip),4,5,false,true);
 }
+#else
+//to give other fns something empty to call, when weather isn't enabled
+const WeatherPeriod* findWeather(byte which, int tod){ return NULL; }
+void displayWeather(byte which){}
+#endif
 
 
 
@@ -1628,19 +1849,23 @@ void displayWeather(byte which){
 ////////// Hardware outputs //////////
 
 void initOutputs() {
-  if(PIEZO_PIN>=0) pinMode(PIEZO_PIN, OUTPUT);
-  if(SWITCH_PIN>=0) { pinMode(SWITCH_PIN, OUTPUT); digitalWrite(SWITCH_PIN, HIGH); } //LOW = device on
-  if(PULSE_PIN>=0) { pinMode(PULSE_PIN, OUTPUT); digitalWrite(PULSE_PIN, HIGH); } //LOW = device on
-  if(BACKLIGHT_PIN>=0) pinMode(BACKLIGHT_PIN, OUTPUT);
+  if(hasPiezo) { pinMode(PIEZO_PIN, OUTPUT); piezoInit(); }
+  if(hasSwitch) { pinMode(SWITCH_PIN, OUTPUT); pinWrite(SWITCH_PIN, HIGH); } //LOW = device on
+  if(hasPulse) { pinMode(PULSE_PIN, OUTPUT); pinWrite(PULSE_PIN, HIGH); } //LOW = device on
+  if(hasBacklight) pinMode(BACKLIGHT_PIN, OUTPUT);
   updateBacklight(); //set to initial value
 }
 
 //Signals are like songs made up of measures (usually 1sec each) tracked by the signalRemain counter.
 //Measures are made up of steps such as piezo beeps and pulses, tracked by signalMeasureStep.
 //When used with switch signal, it simply turns on at the start, and off at the end, like a clock radio – the measures just wait it out.
-//Timed using ms() instead of millis() – see timer/chrono for details.
+//Piezo measures are queued ahead to the sequencer in piezo.cpp, which times the beeps itself; signalMeasureStep just stays nonzero while they play.
+//Otherwise timed using ms() instead of millis() – see timer/chrono for details.
 unsigned long signalMeasureStartTime = 0; //to keep track of individual measures
 byte signalMeasureStep = 0; //step number, or 255 if waiting for next measure, or 0 if not signaling
+word signalToQueue = 0; //piezo measures still to queue...
+byte signalQueued = 0; //...and queued but not yet played
+unsigned long signalCount[3] = {0,0,0}; //signals started since boot, per source: chime, alarm, timer - for metrics
 void signalStart(byte sigFn, byte sigDur){
   //sigFn isn't necessarily the current fn, just the one generating the signal
   //sigDur is the number of measures to put on signalRemain,
@@ -1650,8 +1875,9 @@ void signalStart(byte sigFn, byte sigDur){
   if(!(sigFn==255 && signalSource==FN_TIMER)) signalStop(); // if there is a signal going per the current signalSource, stop it - can only have one signal at a time – except if this is a forced FN_TIMER signal (for signaling runout options) which is cool to overlap timer sleep
   //except if this is a forced
   if(sigFn!=255) signalSource = sigFn;
+  if(sigFn==FN_TOD || sigFn==FN_ALARM || sigFn==FN_TIMER) signalCount[sigFn==FN_TOD? 0: sigFn-FN_ALARM+1]++; //not samples or pattern measures (sigFn 255)
   if(sigFn!=255) signalPattern = (
-    (signalSource==FN_TOD && readEEPROM(21,false)==2)? -1: //special case: the pips
+    (signalSource==FN_TOD && readEEPROM(21,false)==2)? PATTERN_PIPS: //special case: the pips
     getSignalPattern() //usual: get pattern from user settings
   );
   // Serial.print(F("signalStart, sigFn="));
@@ -1667,89 +1893,66 @@ void signalStart(byte sigFn, byte sigDur){
   //Start a measure for cycleSignal to pick up. For "quick measures" we won't set signalRemain.
   signalMeasureStartTime = ms();
   signalMeasureStep = 1; //waiting to start a new measure
+  signalToQueue = 1; //for piezo, just the quick measure, unless set below
   if(sigDur!=0){ //long-duration signal (alarm, sleep, etc) - set signalRemain
     //If switch signal, except if this is a forced FN_TIMER signal (for signaling runout options)
     if(getSignalOutput()==1 && !(sigFn==255 && signalSource==FN_TIMER)) { //turn it on now
       signalRemain = (sigFn==FN_ALARM? SWITCH_DUR: sigDur); //For alarm signal, use switch signal duration from config (eg 2hr)
-      digitalWrite(SWITCH_PIN,LOW); updateBacklight(); //LOW = device on
+      pinWrite(SWITCH_PIN,LOW); updateBacklight(); //LOW = device on
       //Serial.print(millis(),DEC); Serial.println(F(" Switch signal on, signalStart"));
     } else { //start piezo or pulse signal. If neither is present, this will have no effect since cycleSignal will clear it
       signalRemain = (sigFn==FN_ALARM? SIGNAL_DUR: sigDur); //For alarm signal, use signal duration from config (eg 2min)
+      //Alarm/timer durations are in seconds, but a custom tune's measure can be longer than one - so count its measures instead
+      if(getSignalOutput()==0 && (sigFn==FN_ALARM || sigFn==FN_TIMER)){
+        word measureDur = patternMeasure(signalPattern);
+        if(measureDur>1000) signalRemain = ((unsigned long)signalRemain*1000+measureDur-1)/measureDur;
+      }
+      signalToQueue = signalRemain;
     }
   }
   //cycleSignal will pick up from here
 } //end signalStart()
 void signalStop(){ //stop current signal and clear out signal timer if applicable
   //Serial.println(F("signalStop"));
-  signalRemain = 0; snoozeRemain = 0; signalMeasureStep = 0;
-  if(getSignalOutput()==0 && PIEZO_PIN>=0) noTone(PIEZO_PIN);
-  if(getSignalOutput()==1 && SWITCH_PIN>=0){
-    digitalWrite(SWITCH_PIN,HIGH); //LOW = device on
+  signalRemain = 0; snoozeRemain = 0; signalMeasureStep = 0; signalToQueue = 0; signalQueued = 0;
+  if(hasPiezo){ piezoStop(); patternReset(); }
+  if(getSignalOutput()==1 && hasSwitch){
+    pinWrite(SWITCH_PIN,HIGH); //LOW = device on
     //Serial.print(millis(),DEC); Serial.println(F(" Switch signal off, signalStop"));
   }
-  if(getSignalOutput()==2 && PULSE_PIN>=0){
-    digitalWrite(PULSE_PIN,HIGH); //LOW = device on
+  if(getSignalOutput()==2 && hasPulse){
+    pinWrite(PULSE_PIN,HIGH); //LOW = device on
     //Serial.print(millis(),DEC); Serial.println(F(" Pulse signal off, signalStop"));
   }
   updateBacklight();
 } //end signalStop()
 void cycleSignal(){
   //Called on every loop to control the signal.
-  word measureDur = 1000; //interval between measure starts, ms - beep pattern can customize this
+  word measureDur = 1000; //interval between measure starts, ms - for piezo, the pattern sets its own (see pattern.cpp)
   if(signalMeasureStep){ //if there's a measure going (or waiting for a new one)
-    if((getSignalOutput()==0 || (signalRemain==0 && signalSource==FN_TIMER)) && PIEZO_PIN>=0) { // beeper, or single measure for FN_TIMER runout setting
-      //Since tone() handles the duration of each beep,
-      //we only need to use signalMeasureStep to track beep starts; they'll stop on their own.
-      byte bc = 0; //this many beeps
-      word bd = 0; //of this ms duration and separation
-      //Could also set a custom value for the measure interval, if we wanted it to go faster or slower than 1/sec
-      switch(signalPattern){
-        case 255: //the pips: 100ms, except the last is 500ms
-          bc = 1; bd = (signalRemain>0? 100: 500); break;
-        case 0: //long (one 1/2-second beep)
-          bc = 1; bd = 500; break;
-        case 1: default: //short (one 1/4-second beep)
-          bc = 1; bd = 250; break;
-        case 2: case 5: //double and cuckoo (two 1/8-second beeps)
-          bc = 2; bd = 125; break;
-        case 3: //triple (three 1/12-second beeps)
-          bc = 3; bd = 83; break;
-        case 4: //quad (four 1/16-second beeps)
-          bc = 4; bd = 62; break;
-      }
-      //See if it's time to start a new measure
-      if(signalMeasureStep==255 && (unsigned long)(ms()-signalMeasureStartTime)>=measureDur){
-        //Serial.println(F("Starting new measure, sPS -1 -> 1"));
-        signalMeasureStartTime += measureDur;
-        signalMeasureStep = 1;
-      }
-      //See if it's time to start a new beep
-      if((unsigned long)(ms()-signalMeasureStartTime)>=(signalMeasureStep-1)*bd*2){
-        word piezoPitch = (signalPattern==5 && signalMeasureStep==2? getSignalPitch()*0.7937: //cuckoo: go down major third (2^(-4/12)) on 2nd beep
-          (signalPattern==255? 1000: //the pips: use 1000Hz just like the Beeb
-            (signalRemain==0 && signalSource==FN_TIMER? getHz(69): //FN_TIMER runout setting: use timer start pitch
-              getSignalPitch() //usual: get pitch from user settings
-            )
-          )
-        );
-        noTone(PIEZO_PIN); tone(PIEZO_PIN, piezoPitch, bd);
-        //Serial.print(F("Starting beep, sPS "));
-        //Serial.print(signalMeasureStep,DEC);
-        //Serial.print(F(" -> "));
-        //Set up for the next event
-        if(signalMeasureStep<bc) {
-          signalMeasureStep++; //set up for another beep in this measure
-          //Serial.println(signalMeasureStep,DEC);
-        }
-        else {
-          if(signalRemain) signalRemain--; //this measure is done
-          if(signalRemain) signalMeasureStep = 255; //if more measures, set up to start another measure
-          else signalMeasureStep = 0; //otherwise, go idle - not using signalStop so as to let the beep expire on its own & fibonacci snooze continue
-          //Serial.println(signalMeasureStep,DEC);
-        }
+    if((getSignalOutput()==0 || (signalRemain==0 && signalSource==FN_TIMER)) && hasPiezo) { // beeper, or single measure for FN_TIMER runout setting
+      //The piezo sequencer times the beeps, so they don't wait on the loop. Here we keep it fed with whole measures,
+      //and count down signalRemain as it finishes them.
+      //Count the measures that have finished - or all of them, if the sequencer was stopped some other way (e.g. quickBeep)
+      byte done = piezoMeasuresDone();
+      if(!piezoPlaying()) done = signalQueued;
+      if(done>signalQueued) done = signalQueued;
+      signalQueued -= done;
+      signalRemain = (signalRemain>done? signalRemain-done: 0);
+      //Queue more of the pattern (see pattern.cpp), as there's room
+      word piezoPitch = (signalPattern==PATTERN_PIPS? 1000: //the pips: use 1000Hz just like the Beeb
+        (signalRemain==0 && signalSource==FN_TIMER? getHz(69): //FN_TIMER runout setting: use timer start pitch
+          getSignalPitch() //usual: get pitch from user settings
+        )
+      );
+      while(signalToQueue){
+        byte step = patternStep(signalPattern,piezoPitch,signalToQueue==1); //the last measure doesn't wait out its end, and the last pip is long
+        if(!step) break; //no room
+        if(step==2){ signalToQueue--; signalQueued++; }
       }
+      if(!signalToQueue && !signalQueued) signalMeasureStep = 0; //all played - go idle - not using signalStop so as to let fibonacci snooze continue
     } //end beeper
-    else if(getSignalOutput()==2 && PULSE_PIN>=0){ //pulse signal
+    else if(getSignalOutput()==2 && hasPulse){ //pulse signal
       //We don't follow the beep pattern here, we simply energize the pulse signal for PULSE_LENGTH time
       //Unlike beeper, we need to use a signalMeasureStep (2) to stop the pulse.
       //See if it's time to start a new measure
@@ -1760,13 +1963,13 @@ void cycleSignal(){
       }
       //Upon new measure, start the pulse immediately
       if(signalMeasureStep==1){
-        digitalWrite(PULSE_PIN,LOW); updateBacklight(); //LOW = device on
+        pinWrite(PULSE_PIN,LOW); updateBacklight(); //LOW = device on
         //Serial.print(millis(),DEC); Serial.println(F(" Pulse signal on, cycleSignal"));
         signalMeasureStep = 2; //set it up to stop
       }
       //See if it's time to stop the pulse
       else if(signalMeasureStep==2 && (unsigned long)(ms()-signalMeasureStartTime)>=PULSE_LENGTH) {
-        digitalWrite(PULSE_PIN,HIGH); updateBacklight(); //LOW = device on
+        pinWrite(PULSE_PIN,HIGH); updateBacklight(); //LOW = device on
         //Serial.print(millis(),DEC); Serial.println(F(" Pulse signal off, cycleSignal"));
         //Set up for the next event
         if(signalRemain) signalRemain--; //this measure is done
@@ -1787,8 +1990,14 @@ void cycleSignal(){
     } //end switch signal / default
   } //end if there's a measure going
 } //end cycleSignal()
+int getSignalActive(){ return (signalMeasureStep? signalSource: -1); } //source of the signal going, if any - for the display mirror
+unsigned long getSignalCount(byte sigFn){ return signalCount[sigFn==FN_TOD? 0: (sigFn==FN_ALARM? 1: 2)]; }
 word getSignalPitch(){ //for current signal: chime, timer, or (default) alarm
-  return getHz(readEEPROM((signalSource==FN_TOD?41:(signalSource==FN_TIMER?40:39)),false));
+  if(signalSource==FN_TIMER){ //each background countdown goes a major third higher than the last, to tell them apart
+    byte note = readEEPROM(40,false)+timerSignaling*4; if(note>88) note -= 12;
+    return getHz(note);
+  }
+  return getHz(readEEPROM((signalSource==FN_TOD?41:alarmLoc(alarmSignaling,AL_PITCH)),false));
 }
 word getHz(byte note){
   //Given a piano key note, return frequency
@@ -1798,7 +2007,7 @@ word getHz(byte note){
   return mult;
 }
 byte getSignalOutput(){ //for current signal: chime, timer, or (default) alarm: 0=piezo, 1=switch, 2=pulse
-  return readEEPROM((signalSource==FN_TOD?44:(signalSource==FN_TIMER?43:42)),false);
+  return readEEPROM((signalSource==FN_TOD?44:(signalSource==FN_TIMER?43:alarmLoc(alarmSignaling,AL_SIGNAL))),false);
 }
 byte getSignalPattern(){ //for current signal: chime, timer, or (default) alarm: (applies only to piezo)
   //0 = long (1/2-second beep)
@@ -1807,7 +2016,8 @@ byte getSignalPattern(){ //for current signal: chime, timer, or (default) alarm:
   //5 = cuckoo (two 1/8-second beeps, descending major third)
   //3 = triple (three 1/12-second beeps)
   //4 = quad (four 1/16-second beeps)
-  return readEEPROM((signalSource==FN_TOD?49:(signalSource==FN_TIMER?48:47)),false);
+  //6-9 = custom tunes 1-4 (short, if not uploaded)
+  return readEEPROM((signalSource==FN_TOD?49:(signalSource==FN_TIMER?48:alarmLoc(alarmSignaling,AL_PATTERN))),false);
 }
 void quickBeep(int pitch){
   //This is separate from signal system
@@ -1819,11 +2029,16 @@ void quickBeep(int pitch){
   //B6 = 75 //second loudest
   //C7 = 76 //loudest
   //F7 = 81
-  if(PIEZO_PIN>=0) { noTone(PIEZO_PIN); tone(PIEZO_PIN, getHz(pitch), 100); }
+  if(hasPiezo) { piezoStop(); piezoQueue(getHz(pitch),100,0); }
 }
-void quickBeepPattern(int source, int pattern){
+void quickBeepPattern(int source, int pattern, byte alarm){
+  //For FN_ALARM, alarm is which alarm's signal settings to use. Skipped while another alarm is snoozing, since the
+  //snooze will go off per alarmSignaling's settings, which the sample would need to change.
+  if(source==FN_ALARM && snoozeRemain>0 && alarm!=alarmSignaling) return;
   signalPattern = pattern;
   signalSource = source;
+  if(source==FN_ALARM) alarmSignaling = alarm;
+  if(source==FN_TIMER) timerSignaling = 0;
   signalStart(-1,1); //Play a sample using the above source and pattern
 }
 
@@ -1832,7 +2047,7 @@ byte backlightNow = 0;
 byte backlightTarget = 0;
 void updateBacklight(){
   //Run whenever something is changed that might affect the backlight state: initial (initOutputs), signal start/stop, switch signal on/off, setting change
-  if(BACKLIGHT_PIN>=0) {
+  if(hasBacklight) {
     switch(readEEPROM(26,false)){
       case 0: //always off
         backlightTarget = 0;
@@ -1851,7 +2066,7 @@ void updateBacklight(){
         //Serial.print(signalRemain && (signalSource==FN_ALARM || signalSource==FN_TIMER)?F("Backlight on"):F("Backlight off")); Serial.println(F(" per alarm/timer"));
         break;
       case 4: //off, but on with switch signal
-        if(SWITCH_PIN>=0) {
+        if(hasSwitch) {
           backlightTarget = (!digitalRead(SWITCH_PIN)? 255: 0); //LOW = device on
           //Serial.print(!digitalRead(SWITCH_PIN)? F("Backlight on"): F("Backlight off")); Serial.println(F(" per switch signal"));
         }
@@ -1873,13 +2088,27 @@ void cycleBacklight() {
       // Serial.print(backlightNow,DEC);
       // Serial.print(F(" => "));
       // Serial.println(backlightTarget,DEC);
-      analogWrite(BACKLIGHT_PIN,backlightNow);
+      pinAnalogWrite(BACKLIGHT_PIN,backlightNow);
     } else { //just switch
       backlightNow = backlightTarget = (backlightTarget<255? 0: 255);
-      digitalWrite(BACKLIGHT_PIN,(backlightNow?LOW:HIGH)); //LOW = device on
+      pinWrite(BACKLIGHT_PIN,(backlightNow?LOW:HIGH)); //LOW = device on
     }
   }
 }
+word getIdleNap(){
+  //How long the loop can nap before it's next needed (see cyclePower() in power.cpp), ms - 0 unless the display is off
+  //and nothing is going on: no setting or temporary display, no signal, timer, fade, or network activity.
+  if(displayDim || fn!=FN_TOD || fnSetPg || tempValDispLast || signalMeasureStep || piezoPlaying()
+    || timerState&1 || timersRunning || backlightNow!=backlightTarget) return 0;
+  if(networkSupported() && networkBusy()) return 0;
+  //A tick can come up to a nap late, since the display is off (snooze only counts them) - unless there's an event due
+  //on it, in which case, only nap until a nap before it's expected (as we may have seen the last one a nap late), and
+  //wait for it awake
+  if(!timelineLast || timelineNext()>timelineLast+1) return POWER_NAP;
+  unsigned long wait = (unsigned long)(rtcSecAt+1000-POWER_NAP-millis());
+  if(wait>1000) return 0; //it could come any moment
+  return (wait<POWER_NAP? wait: POWER_NAP);
+}
 byte getVersionPart(byte part){
   switch(part){
     case 0: return vMajor; break;
@@ -12,6 +12,7 @@
 #define ENABLE_DATE_FN true // Date function, optionally including pages below
 #define ENABLE_DATE_COUNTER true // Adds date page with an anniversary counter
 #define ENABLE_DATE_RISESET true // Adds date pages with sunrise/sunset times. Requires Dusk2Dawn library by DM Kichi to be installed in IDE.
+#define ENABLE_DATE_WEATHER false // Adds date pages with the forecast high/low and precip chance. Requires Wi-Fi (Nano 33 IoT) and a WEATHER_HOST - see ~sample.h.
 #define ENABLE_ALARM_FN true
 #define ENABLE_ALARM_AUTOSKIP true
 #define ENABLE_ALARM_FIBONACCI true
@@ -34,15 +35,16 @@
 //To use, tilt clock: backward=Sel, forward=Alt, left=Down, right=Up
 //This is mutually exclusive with the button/rotary controls.
 #define INPUT_IMU
-//Which side of the IMU/Arduino faces clock front/side? 0=bottom, 1=top, 2=left side, 3=right side, 4=USB end, 5=butt end
+//Which side of the IMU/Arduino faces clock front/top? 0=bottom, 1=top, 2=left side, 3=right side, 4=USB end, 5=butt end
+//(top/bottom per the component side; left/right as seen from the top with the USB end pointing away)
 #define IMU_FRONT 0 //(UNDB: 0)
 #define IMU_TOP 4 //(UNDB: 4)
 #define IMU_DEBOUNCING 150 //ms
 
 //For all input types:
 //How long (in ms) are the hold durations?
-#define CTRL_HOLD_SHORT_DUR 1000 //for entering setting mode, or hold-setting at low velocity (x1)
-#define CTRL_HOLD_LONG_DUR 3000 //for entering settings menu, or hold-setting at high velocity (x10)
+#define CTRL_HOLD_SHORT_DUR 1000 //for entering setting mode, or hold-setting slowly
+#define CTRL_HOLD_LONG_DUR 3000 //for entering settings menu, or hold-setting faster, and accelerating
 #define CTRL_HOLD_VERYLONG_DUR 5000 //for wifi info / admin start (Nano IoT without Alt only)
 #define CTRL_HOLD_SUPERLONG_DUR 10000 //for wifi disconnect (Nano IoT) or EEPROM reset on startup
 //What are the timeouts for setting and temporarily-displayed functions? up to 65535 sec
@@ -101,4 +103,18 @@
 // >0 = backlight fades on and off via PWM (must use PWM pin and PWM-supportive lighting, such as LEDs). This value is the amount the PWM is increased/decreased per loop cycle. 10 is a good starting choice.
 
 
+///// Network /////
+
+//Over-the-air firmware updates via POST /update (see README). Requires ArduinoOTA library by Juraj Andrassy to be installed in your IDE,
+//and a sketch no bigger than half the flash. Uploads must include this key - choose your own, up to 40 characters, and keep it private.
+//Leave undefined to disable.
+// #define OTA_KEY "choose a secret key"
+
+//Forecast for the weather pages of the date function (ENABLE_DATE_WEATHER), fetched over plain HTTP when due (see README).
+//The clock sends GET WEATHER_PATH?lat=&lon=&utc= and expects JSON in the format served by extras/weather/standin.py.
+#define WEATHER_HOST "192.168.1.10"
+#define WEATHER_PORT 8080
+#define WEATHER_PATH "/forecast" //no query string - the clock adds its own
+
+
 #endif
\ No newline at end of file
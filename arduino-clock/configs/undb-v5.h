@@ -12,6 +12,7 @@
 #define ENABLE_DATE_FN true // Date function, optionally including pages below
 #define ENABLE_DATE_COUNTER true // Adds date page with an anniversary counter
 #define ENABLE_DATE_RISESET true // Adds date pages with sunrise/sunset times. Requires Dusk2Dawn library by DM Kichi to be installed in IDE.
+#define ENABLE_DATE_WEATHER false // Adds date pages with the forecast high/low and precip chance. Requires Wi-Fi (Nano 33 IoT) and a WEATHER_HOST - see ~sample.h.
 #define ENABLE_ALARM_FN true
 #define ENABLE_ALARM_AUTOSKIP true
 #define ENABLE_ALARM_FIBONACCI true
@@ -44,8 +45,8 @@
 
 //For all input types:
 //How long (in ms) are the hold durations?
-#define CTRL_HOLD_SHORT_DUR 1000 //for entering setting mode, or hold-setting at low velocity (x1)
-#define CTRL_HOLD_LONG_DUR 3000 //for entering settings menu, or hold-setting at high velocity (x10)
+#define CTRL_HOLD_SHORT_DUR 1000 //for entering setting mode, or hold-setting slowly
+#define CTRL_HOLD_LONG_DUR 3000 //for entering settings menu, or hold-setting faster, and accelerating
 #define CTRL_HOLD_VERYLONG_DUR 5000 //for wifi info / admin start (Nano IoT without Alt only)
 #define CTRL_HOLD_SUPERLONG_DUR 10000 //for wifi disconnect (Nano IoT) or EEPROM reset on startup
 //What are the timeouts for setting and temporarily-displayed functions? up to 65535 sec
@@ -13,6 +13,7 @@
 #define ENABLE_DATE_FN true // Date function, optionally including pages below
 #define ENABLE_DATE_COUNTER true // Adds date page with an anniversary counter
 #define ENABLE_DATE_RISESET true // Adds date pages with sunrise/sunset times. Requires Dusk2Dawn library by DM Kichi to be installed in IDE.
+#define ENABLE_DATE_WEATHER false // Adds date pages with the forecast high/low and precip chance. Requires Wi-Fi (Nano 33 IoT) and a WEATHER_HOST - see ~sample.h.
 #define ENABLE_ALARM_FN true
 #define ENABLE_ALARM_AUTOSKIP true
 #define ENABLE_ALARM_FIBONACCI true
@@ -59,24 +60,27 @@
 // #define INPUT_UPDN_ROTARY
 // #define CTRL_R1 A2
 // #define CTRL_R2 A3
-// #define ROT_VEL_START 80 //If step rate falls below this, kick into high velocity set (x10)
-// #define ROT_VEL_STOP 500 //If step rate rises above this, drop into low velocity set (x1)
+// #define ROT_VEL_START 80 //ms per step: turning this fast (or faster) sets at full velocity
+// #define ROT_VEL_STOP 500 //ms per step: turning this slowly (or slower) sets one at a time, with velocity increasing in between
 
 //If using IMU motion sensor on Nano 33 IoT:
 //To use, tilt clock: backward=Sel, forward=Alt, left=Down, right=Up
 //This is mutually exclusive with the button/rotary controls. TODO make it possible to use both together by renaming the functions or abstracting basic input functionality
 #define INPUT_IMU
-//Which side of the IMU/Arduino faces clock front/side? 0=bottom, 1=top, 2=left side, 3=right side, 4=USB end, 5=butt end
+//Which side of the IMU/Arduino faces clock front/top? 0=bottom, 1=top, 2=left side, 3=right side, 4=USB end, 5=butt end
+//(top/bottom per the component side; left/right as seen from the top with the USB end pointing away)
 #define IMU_FRONT 0 //(UNDB: 0)
 #define IMU_TOP 4 //(UNDB: 4)
 #define IMU_DEBOUNCING 150 //ms
 
 //For all input types:
 //How long (in ms) are the hold durations?
-#define CTRL_HOLD_SHORT_DUR 1000 //for entering setting mode, or hold-setting at low velocity (x1)
-#define CTRL_HOLD_LONG_DUR 3000 //for entering settings menu, or hold-setting at high velocity (x10)
+#define CTRL_HOLD_SHORT_DUR 1000 //for entering setting mode, or hold-setting slowly
+#define CTRL_HOLD_LONG_DUR 3000 //for entering settings menu, or hold-setting faster, and accelerating
 #define CTRL_HOLD_VERYLONG_DUR 5000 //for wifi info / admin start (Nano IoT without Alt only)
 #define CTRL_HOLD_SUPERLONG_DUR 10000 //for wifi disconnect (Nano IoT) or EEPROM reset on startup
+//To debug input handling, record the latest control events - up to 100. See README.
+// #define INPUT_TRACE 64
 //What are the timeouts for setting and temporarily-displayed functions? up to 65535 sec
 #define SETTING_TIMEOUT 300 //sec
 #define FN_TEMP_TIMEOUT 5 //sec
@@ -128,12 +132,16 @@
 #define DISPLAY_SIZE 6 //number of digits in display module: 6 or 4
 #define UNOFF_DUR 10 //sec - when display is off, an input will illuminate for how long?
 #define SCROLL_SPEED 100 //ms - "frame rate" of digit scrolling, e.g. date at :30 option
+//To check display and signal timing, record the latest output pin changes - up to 250. See README.
+// #define PIN_TRACE 200
+//Which to record, if not everything - e.g. PINTRACE_SIGNALS, to see beep timing over many measures (see pintrace.h)
+// #define PIN_TRACE_ROLES PINTRACE_SIGNALS
 
 
 ///// Other Outputs /////
 
 //What are the pins for each signal type? -1 to disable that signal type
-#define PIEZO_PIN -1 //Drives a piezo beeper
+#define PIEZO_PIN -1 //Drives a piezo beeper. Beeps are timed by Timer2 on AVR (so pins 3 and 11 can't do PWM) or TC5 on SAMD - see piezo.cpp
 #define SWITCH_PIN -1 //Switched to control an appliance like a radio or light fixture. If used with timer, it will switch on while timer is running (like a "sleep" function). If used with alarm, it will switch on when alarm trips; specify duration of this in SWITCH_DUR. (A3 for UNDB v9)
 #define PULSE_PIN -1 //Simple pulses to control an intermittent signaling device like a solenoid or indicator lamp. Specify pulse duration in RELAY_PULSE. Pulse frequency behaves like the piezo signal.
 //Default signal type for each function:
@@ -159,5 +167,23 @@
 // 0 = no fading; simply switches on and off.
 // >0 = backlight fades on and off via PWM (must use PWM pin and PWM-supportive lighting, such as LEDs). This value is the amount the PWM is increased/decreased per loop cycle. 10 is a good starting choice.
 
+//Low-power idle
+// #define POWER_NAP 100
+// While the display is off (night/away shutoff) and nothing else is going on, the clock sleeps between loop cycles, for up to this many ms at a time - waking early for a button press or a timed event. 0 = always run at full speed. If not defined, defaults to 100. If any button can't interrupt (e.g. on analog-only pins A6/A7), naps are kept to POWER_NAP_POLLED (default 30) so a short press isn't missed.
+
+
+///// Network /////
+
+//Over-the-air firmware updates via POST /update (see README). Requires ArduinoOTA library by Juraj Andrassy to be installed in your IDE,
+//and a sketch no bigger than half the flash. Uploads must include this key - choose your own, up to 40 characters, and keep it private.
+//Leave undefined to disable.
+// #define OTA_KEY "choose a secret key"
+
+//Forecast for the weather pages of the date function (ENABLE_DATE_WEATHER), fetched over plain HTTP when due (see README).
+//The clock sends GET WEATHER_PATH?lat=&lon=&utc= and expects JSON in the format served by extras/weather/standin.py.
+#define WEATHER_HOST "192.168.1.10"
+#define WEATHER_PORT 8080
+#define WEATHER_PATH "/forecast" //no query string - the clock adds its own
+
 
 #endif
\ No newline at end of file
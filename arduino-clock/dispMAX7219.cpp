@@ -133,6 +133,8 @@ void displayBlink(){
   displayBlinkStart = millis();
 }
 
+byte getDisplayDigit(byte pos){ return displayNext[pos]; } //0-9, or 15 for blank
+
 //void checkEffects(bool force){}
 
 #endif //DISP_MAX7219
\ No newline at end of file
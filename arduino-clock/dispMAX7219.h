@@ -9,5 +9,6 @@ void cycleDisplay(byte displayDim, byte fnSetPg);
 void editDisplay(word n, byte posStart, byte posEnd, bool leadingZeros, bool fade);
 void blankDisplay(byte posStart, byte posEnd, byte fade);
 void displayBlink();
+byte getDisplayDigit(byte pos);
 
 #endif //DISP_MAX7219_H
\ No newline at end of file
@@ -4,6 +4,7 @@
 #ifdef DISP_NIXIE //see arduino-clock.ino Includes section
 
 #include "dispNixie.h"
+#include "pintrace.h" //writes go via pinWrite(), so they can be traced if PIN_TRACE
 
 // Display cycling code derived from http://arduinix.com/Main/Code/ANX-6Tube-Clock-Crossfade.txt
 
@@ -48,9 +49,9 @@ void decToBin(bool binVal[], byte i){ //"private"
 void setCathodes(byte decValA, byte decValB){ //"private"
   bool binVal[4]; //4-bit binary number with values [1,2,4,8]
   decToBin(binVal,decValA); //have binary value of decVal set into binVal
-  for(byte i=0; i<4; i++) digitalWrite(binOutA[i],binVal[i]); //set bin inputs of SN74141
+  for(byte i=0; i<4; i++) pinWrite(binOutA[i],binVal[i]); //set bin inputs of SN74141
   decToBin(binVal,decValB);
-  for(byte i=0; i<4; i++) digitalWrite(binOutB[i],binVal[i]); //set bin inputs of SN74141
+  for(byte i=0; i<4; i++) pinWrite(binOutB[i],binVal[i]); //set bin inputs of SN74141
 } //end setCathodes()
 
 void initDisplay(){
@@ -114,31 +115,31 @@ void cycleDisplay(byte displayDim, byte fnSetPg){
   if(displayDim>0) { //if other display code says to shut off entirely, skip this part
     //Anode channel 0: tubes #2 (min x10) and #5 (sec x1)
     setCathodes(displayLast[2],displayLast[5]); //Via d2b decoder chip, set cathodes to old digits
-    digitalWrite(anodes[0], HIGH); //Turn on tubes
+    pinWrite(anodes[0], HIGH); //Turn on tubes
     delay(fadeLastDur);//-(dim?dimDur:0)); //Display for fade-out cycles
     setCathodes(displayNext[2],displayNext[5]); //Switch cathodes to new digits
     delay(fadeNextDur);//-(dim?dimDur:0)); //Display for fade-in cycles
-    digitalWrite(anodes[0], LOW); //Turn off tubes
+    pinWrite(anodes[0], LOW); //Turn off tubes
   
     if(dim) delay(dimDur);
   
     //Anode channel 1: tubes #4 (sec x10) and #1 (hour x1)
     setCathodes(displayLast[4],displayLast[1]);
-    digitalWrite(anodes[1], HIGH);
+    pinWrite(anodes[1], HIGH);
     delay(fadeLastDur);
     setCathodes(displayNext[4],displayNext[1]);
     delay(fadeNextDur);
-    digitalWrite(anodes[1], LOW);
+    pinWrite(anodes[1], LOW);
   
     if(dim) delay(dimDur);
   
     //Anode channel 2: tubes #0 (hour x10) and #3 (min x1)
     setCathodes(displayLast[0],displayLast[3]);
-    digitalWrite(anodes[2], HIGH);
+    pinWrite(anodes[2], HIGH);
     delay(fadeLastDur);
     setCathodes(displayNext[0],displayNext[3]);
     delay(fadeNextDur);
-    digitalWrite(anodes[2], LOW);
+    pinWrite(anodes[2], LOW);
   
     if(dim) delay(dimDur);
   } //end if displayDim>0
@@ -179,6 +180,8 @@ void displayBlink(){
   displayBlinkStart = millis();
 }
 
+byte getDisplayDigit(byte pos){ return displayNext[pos]; } //0-9, or 15 for blank
+
 // void checkEffects(bool force){
 //   //control the cleaning/scrolling effects - similar to checkRTC but it has its own timings
 //   unsigned long now = millis();
@@ -11,6 +11,7 @@ void editDisplay(word n, byte posStart, byte posEnd, bool leadingZeros, bool fad
 void blankDisplay(byte posStart, byte posEnd, byte fade);
 // void startScroll();
 void displayBlink();
+byte getDisplayDigit(byte pos);
 // void checkEffects(bool force);
 
 #endif //DISP_NIXIE_H
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#include "expiry.h"
+
+// Expiry queue for the chrono/timer. Each running countdown, the chrono's lap display, and the chrono's 100-hour limit
+// has one entry here with the ms() time it's due, kept in order soonest first, so cycleTimer() only has to compare
+// the time against the first - however many timers are running. Since ms() wraps, times are compared by their signed
+// difference, which is good as long as nothing is due more than 24 days out (timers go to 100 hours).
+// Compare to timeline.cpp, which does the same for the RTC's timed events, in seconds.
+
+struct ExpiryEntry {
+  unsigned long at;
+  byte id;
+};
+ExpiryEntry expiry[EXP_IDS];
+byte expiryCount = 0;
+
+void expiryCancel(byte id){
+  //Removes id's entry, if it has one
+  for(byte i=0; i<expiryCount; i++) if(expiry[i].id==id){
+    expiryCount--;
+    for(; i<expiryCount; i++) expiry[i] = expiry[i+1];
+    return;
+  }
+}
+
+void expirySet(byte id, unsigned long at){
+  //Sets (or moves) id's entry to be due at at. There are only a few, so they're kept in order by insertion.
+  expiryCancel(id);
+  byte i = expiryCount++;
+  while(i && (long)(at-expiry[i-1].at)<0){ expiry[i] = expiry[i-1]; i--; }
+  expiry[i].at = at; expiry[i].id = id;
+}
+
+byte expiryDue(unsigned long now){
+  //If the soonest entry is due as of now, removes it and returns its id; otherwise EXP_NONE
+  if(!expiryCount || (long)(now-expiry[0].at)<0) return EXP_NONE;
+  byte id = expiry[0].id;
+  expiryCount--;
+  for(byte i=0; i<expiryCount; i++) expiry[i] = expiry[i+1];
+  return id;
+}
@@ -0,0 +1,17 @@
+#ifndef EXPIRY_H
+#define EXPIRY_H
+
+//Expiry queue - when each running timer is next due, in ms(), so cycleTimer() only has to look at the soonest. See expiry.cpp.
+
+//Entries, by id: 0 to TIMERS-1 are the countdowns (see TIMERS), then these
+#define EXP_LAP TIMERS //end of the chrono's lap display
+#define EXP_MAX (TIMERS+1) //chrono maxing out
+#define EXP_IDS (TIMERS+2)
+
+#define EXP_NONE 255
+
+void expirySet(byte id, unsigned long at);
+void expiryCancel(byte id);
+byte expiryDue(unsigned long now);
+
+#endif //EXPIRY_H
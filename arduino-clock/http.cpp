@@ -0,0 +1,329 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#ifndef __AVR__ //only used by network.cpp - see there
+
+#include "http.h"
+
+// A small state machine that tokenizes an HTTP/1.1 request one byte at a time, so checkClients() can feed it whatever
+// the client has sent so far, and find out when there's a complete request to handle. It keeps only what the admin
+// page needs (method, path, a few headers, and the body) in fixed buffers; everything else is skipped over. A body too big to
+// buffer is left for the caller to read as it arrives (see POST /update in network.cpp).
+
+void httpReset(HttpRequest *r){
+  r->state = HTTP_ST_METHOD;
+  r->method = HTTP_UNKNOWN;
+  r->error = 0;
+  r->methodBuf[0] = '\0';
+  r->path[0] = '\0';
+  r->hdrName[0] = '\0';
+  r->hdrVal[0] = '\0';
+  r->hdrOver = false;
+  r->pos = 0;
+  r->headLen = 0;
+  r->contentLength = 0;
+  r->ifNoneMatch[0] = '\0';
+  r->auth[0] = '\0';
+  r->crc = 0;
+  r->hasCRC = false;
+  r->body[0] = '\0';
+  r->bodyLen = 0;
+  r->formPos = 0;
+  r->jsonDelim = 0;
+}
+
+byte httpFail(HttpRequest *r, int error){ //"private"
+  r->state = HTTP_ST_ERROR;
+  r->error = error;
+  return r->state;
+}
+
+byte httpHeader(HttpRequest *r){ //"private"
+  //A header line is complete - keep what we care about. A value too long for hdrVal is only trouble if it's one we
+  //keep, since we'd be acting on part of it (e.g. the leading digits of a Content-Length) - so that's rejected.
+  //Returns the new state.
+  if(!strcmp(r->hdrName,"content-length")){
+    char *end;
+    if(r->hdrOver) return httpFail(r,431);
+    r->contentLength = strtol(r->hdrVal,&end,10);
+    if(end==r->hdrVal || *end!='\0' || r->contentLength<0) r->contentLength = -1; //flagged as bad at end of headers
+  }
+  else if(!strcmp(r->hdrName,"if-none-match")){
+    strncpy(r->ifNoneMatch,r->hdrVal,HTTP_ETAG_MAX-1); r->ifNoneMatch[HTTP_ETAG_MAX-1] = '\0'; //if longer, it isn't one of ours anyway
+  }
+  else if(!strcmp(r->hdrName,"authorization")){ //sized to fit our key - if longer, it isn't ours, so leave it empty
+    if(!r->hdrOver && strlen(r->hdrVal)<HTTP_AUTH_MAX) strcpy(r->auth,r->hdrVal);
+  }
+  else if(!strcmp(r->hdrName,"x-crc32")){
+    char *end;
+    if(r->hdrOver) return httpFail(r,431);
+    r->crc = strtoul(r->hdrVal,&end,16);
+    r->hasCRC = (end!=r->hdrVal && *end=='\0');
+  }
+  return r->state;
+}
+
+byte httpFeed(HttpRequest *r, char c){
+  //Advance the parser by one byte. Returns the new state.
+  if(r->state>=HTTP_ST_DONE) return r->state; //ignore anything past the end
+  if(r->state!=HTTP_ST_BODY){
+    r->headLen++;
+    if(r->headLen>HTTP_HEAD_MAX) return httpFail(r,400);
+    if(c=='\r') return r->state; //lines may end in CRLF or bare LF
+  }
+  switch(r->state){
+    case HTTP_ST_METHOD:
+      if(c==' '){
+        if(!strcmp(r->methodBuf,"GET")) r->method = HTTP_GET;
+        else if(!strcmp(r->methodBuf,"POST")) r->method = HTTP_POST;
+        else if(!strcmp(r->methodBuf,"PATCH")) r->method = HTTP_PATCH;
+        else return httpFail(r,501);
+        r->pos = 0; r->state = HTTP_ST_PATH;
+      }
+      else if(c<'A' || c>'Z' || r->pos>=HTTP_METHOD_MAX-1) return httpFail(r,400);
+      else { r->methodBuf[r->pos++] = c; r->methodBuf[r->pos] = '\0'; }
+      break;
+    case HTTP_ST_PATH:
+      if(c==' '){
+        if(!r->pos) return httpFail(r,400);
+        r->state = HTTP_ST_VERSION;
+      }
+      else if(c=='\n' || c<' ') return httpFail(r,400);
+      else if(r->pos>=HTTP_PATH_MAX-1) return httpFail(r,414);
+      else { r->path[r->pos++] = c; r->path[r->pos] = '\0'; }
+      break;
+    case HTTP_ST_VERSION: //we answer in HTTP/1.1 regardless, so just wait for end of line
+      if(c=='\n'){ r->pos = 0; r->state = HTTP_ST_HDR_NAME; }
+      break;
+    case HTTP_ST_HDR_NAME:
+      if(c=='\n'){
+        if(r->pos) return httpFail(r,400); //header line without a colon
+        //Blank line: end of headers
+        if(r->contentLength<0) return httpFail(r,400);
+        r->pos = 0;
+        r->state = (r->contentLength>HTTP_BODY_MAX? HTTP_ST_STREAM: (r->contentLength>0? HTTP_ST_BODY: HTTP_ST_DONE)); //caller answers 413 to a stream it doesn't want
+      }
+      else if(c==':'){ r->pos = 0; r->hdrVal[0] = '\0'; r->hdrOver = false; r->state = HTTP_ST_HDR_VAL; }
+      else if(r->pos<HTTP_HDR_NAME_MAX-1){ r->hdrName[r->pos++] = (c>='A' && c<='Z'? c+('a'-'A'): c); r->hdrName[r->pos] = '\0'; } //header names are case-insensitive
+      //else truncate
+      break;
+    case HTTP_ST_HDR_VAL:
+      if(c=='\n'){
+        while(r->pos && r->hdrVal[r->pos-1]==' ') r->hdrVal[--r->pos] = '\0'; //trailing whitespace
+        if(httpHeader(r)==HTTP_ST_ERROR) return r->state;
+        r->pos = 0; r->hdrName[0] = '\0'; r->state = HTTP_ST_HDR_NAME;
+      }
+      else if(c==' ' && !r->pos) {} //leading whitespace
+      else if(r->pos<HTTP_HDR_VAL_MAX-1){ r->hdrVal[r->pos++] = c; r->hdrVal[r->pos] = '\0'; }
+      else r->hdrOver = true; //truncate - see httpHeader()
+      break;
+    case HTTP_ST_BODY:
+      r->body[r->bodyLen++] = c; r->body[r->bodyLen] = '\0';
+      if(r->bodyLen>=r->contentLength) r->state = HTTP_ST_DONE;
+      break;
+    default: break;
+  }
+  return r->state;
+}
+
+int httpFeedBuf(HttpRequest *r, const byte *buf, int len){
+  //Same, for a chunk of bytes as read from the client. Returns how many were used - if the parser stops at
+  //HTTP_ST_STREAM, the rest are the start of the body.
+  for(int i=0; i<len; i++) if(httpFeed(r,buf[i])>=HTTP_ST_DONE) return i+1;
+  return len;
+}
+
+byte httpHexVal(char c){ //"private"
+  if(c>='0' && c<='9') return c-'0';
+  if(c>='a' && c<='f') return c-'a'+10;
+  if(c>='A' && c<='F') return c-'A'+10;
+  return 255;
+}
+
+void httpDecode(char *s){
+  //Percent-decodes a url-encoded string in place ('+' is a space). Malformed escapes are left as-is.
+  char *out = s;
+  while(*s){
+    if(*s=='+'){ *out++ = ' '; s++; }
+    else if(*s=='%' && httpHexVal(s[1])<16 && httpHexVal(s[2])<16){
+      *out++ = (char)((httpHexVal(s[1])<<4) | httpHexVal(s[2]));
+      s += 3;
+    }
+    else *out++ = *s++;
+  }
+  *out = '\0';
+}
+
+bool httpFormNext(HttpRequest *r, char **key, char **val){
+  //Iterates the key=value pairs of a url-encoded body, decoding each in place.
+  //Returns false when there are no more. A pair without '=' gets an empty value.
+  while(r->formPos<r->bodyLen){
+    char *start = r->body+r->formPos;
+    char *amp = strchr(start,'&');
+    if(amp){ *amp = '\0'; r->formPos = (amp-r->body)+1; }
+    else r->formPos = r->bodyLen;
+    if(!*start) continue; //empty pair, e.g. "a=1&&b=2"
+    char *eq = strchr(start,'=');
+    if(eq){ *eq = '\0'; *val = eq+1; }
+    else *val = start+strlen(start); //empty string
+    *key = start;
+    httpDecode(*key);
+    httpDecode(*val);
+    return true;
+  }
+  return false;
+}
+
+#define JSON_WS(c) ((c)==' ' || (c)=='\t' || (c)=='\r' || (c)=='\n')
+
+char httpJSONString(char **p){ //"private"
+  //Unescapes the JSON string starting at the opening quote **p, in place, and terminates it.
+  //Advances *p past the closing quote. Returns 1, or -1 if malformed.
+  char *in = *p+1, *out = *p;
+  while(*in!='"'){
+    if(*in=='\0' || (byte)*in<' ') return -1;
+    if(*in!='\\'){ *out++ = *in++; continue; }
+    in++;
+    switch(*in){
+      case '"': case '\\': case '/': *out++ = *in; break;
+      case 'b': *out++ = '\b'; break;
+      case 'f': *out++ = '\f'; break;
+      case 'n': *out++ = '\n'; break;
+      case 'r': *out++ = '\r'; break;
+      case 't': *out++ = '\t'; break;
+      case 'u': { //written out as UTF-8 - surrogate pairs aren't combined, but nothing we store needs them
+        word u = 0;
+        for(byte i=1; i<=4; i++){ if(httpHexVal(in[i])>15) return -1; u = (u<<4) | httpHexVal(in[i]); }
+        if(u==0) return -1; //would truncate
+        if(u<0x80) *out++ = u;
+        else if(u<0x800){ *out++ = 0xC0|(u>>6); *out++ = 0x80|(u&0x3F); }
+        else { *out++ = 0xE0|(u>>12); *out++ = 0x80|((u>>6)&0x3F); *out++ = 0x80|(u&0x3F); }
+        in += 4;
+        break;
+      }
+      default: return -1;
+    }
+    in++;
+  }
+  *out = '\0';
+  *p = in+1;
+  return 1;
+}
+
+char httpJSONNext(HttpRequest *r, char **key, char **val){
+  //Iterates the members of a flat JSON object body, e.g. {"b16":2,"wssid":"Home"}, unescaping in place.
+  //Values are returned as text: strings without their quotes, numbers/true/false/null as written. Nested objects and
+  //arrays aren't supported. Returns 1 for a member, 0 at the end of the object, -1 if malformed.
+  char *p = r->body+r->formPos;
+  if(r->formPos==0 && !r->jsonDelim){ //first call
+    while(JSON_WS(*p)) p++;
+    if(*p!='{') return -1;
+    p++; while(JSON_WS(*p)) p++;
+    if(*p=='}'){ p++; r->jsonDelim = '}'; }
+    else r->jsonDelim = ',';
+  }
+  if(r->jsonDelim=='}'){ //end of object - make sure nothing follows
+    while(JSON_WS(*p)) p++;
+    r->formPos = p-r->body;
+    return (*p? -1: 0);
+  }
+  if(r->jsonDelim!=',') return -1; //malformed earlier
+  r->jsonDelim = 0;
+  //Key
+  while(JSON_WS(*p)) p++;
+  if(*p!='"') return -1;
+  *key = p;
+  if(httpJSONString(&p)<0) return -1;
+  while(JSON_WS(*p)) p++;
+  if(*p!=':') return -1;
+  p++; while(JSON_WS(*p)) p++;
+  //Value
+  char *end;
+  if(*p=='"'){
+    *val = p;
+    if(httpJSONString(&p)<0) return -1;
+    end = p; //already terminated
+  } else {
+    *val = p;
+    while((*p>='0' && *p<='9') || (*p>='a' && *p<='z') || *p=='-' || *p=='+' || *p=='.' || *p=='E') p++;
+    if(p==*val) return -1; //e.g. nested object/array
+    end = p;
+  }
+  while(JSON_WS(*p)) p++;
+  if(*p!=',' && *p!='}') return -1;
+  r->jsonDelim = *p;
+  *end = '\0'; //may overwrite the delimiter, which is why we keep it
+  r->formPos = (p+1)-r->body;
+  return 1;
+}
+
+bool httpParseIP(const char *s, byte ip[4]){
+  //Parses a dotted-quad IPv4 address, strictly: four decimal octets 0-255 and nothing else
+  for(byte i=0; i<4; i++){
+    if(*s<'0' || *s>'9') return false;
+    int octet = 0; byte digits = 0;
+    while(*s>='0' && *s<='9'){
+      octet = octet*10+(*s-'0'); s++;
+      if(++digits>3 || octet>255) return false;
+    }
+    ip[i] = octet;
+    if(i<3){ if(*s!='.') return false; s++; }
+  }
+  return *s=='\0';
+}
+
+void httpPrintJSON(Print &out, const char *s){
+  //Prints s as a quoted JSON string, escaping as needed
+  out.print('"');
+  for(; *s; s++){
+    if(*s=='"' || *s=='\\'){ out.print('\\'); out.print(*s); }
+    else if((byte)*s<' '){ out.print(F("\\u00")); out.print((byte)*s<16? F("0"): F("")); out.print((byte)*s,HEX); }
+    else out.print(*s);
+  }
+  out.print('"');
+}
+
+const __FlashStringHelper* httpReason(int status){
+  switch(status){
+    case 200: return F("OK");
+    case 202: return F("Accepted");
+    case 304: return F("Not Modified");
+    case 400: return F("Bad Request");
+    case 401: return F("Unauthorized");
+    case 403: return F("Forbidden");
+    case 404: return F("Not Found");
+    case 408: return F("Request Timeout");
+    case 409: return F("Conflict");
+    case 413: return F("Payload Too Large");
+    case 414: return F("URI Too Long");
+    case 431: return F("Request Header Fields Too Large");
+    case 501: return F("Not Implemented");
+    case 503: return F("Service Unavailable");
+    default: return F("Internal Server Error");
+  }
+}
+
+size_t HttpOut::write(uint8_t c){
+  if(len>=size){ overflow = true; return 0; }
+  buf[len++] = c;
+  return 1;
+}
+size_t HttpOut::write(const uint8_t *b, size_t n){
+  for(size_t i=0; i<n; i++) if(!write(b[i])) return i;
+  return n;
+}
+void HttpOut::begin(int status, const __FlashStringHelper *type){
+  print(F("HTTP/1.1 ")); print(status,DEC); print(' '); print(httpReason(status));
+  print(F("\r\nContent-Type: ")); print(type);
+  print(F("\r\nContent-Length:")); lenPos = len; print(F("      ")); //filled in by end()
+  print(F("\r\nConnection: close\r\n\r\n")); //so the client hangs up once it has it all - see checkClients()
+  bodyPos = len;
+}
+void HttpOut::end(){
+  //Right-align the body length in the space left for it (leading whitespace is allowed)
+  if(overflow || !lenPos) return;
+  word n = len-bodyPos;
+  for(byte i=6; i>0; i--){ buf[lenPos+i-1] = (n||i==6? '0'+(n%10): ' '); n /= 10; }
+}
+
+#endif //__AVR__
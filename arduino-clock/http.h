@@ -0,0 +1,92 @@
+#ifndef HTTP_H
+#define HTTP_H
+
+//Incremental HTTP/1.1 request parser for the admin page. Bytes are fed in as they arrive from the client,
+//into fixed-size buffers - no String, no heap. See http.cpp.
+
+#define HTTP_METHOD_MAX 8 //GET, POST, PATCH
+#define HTTP_PATH_MAX 48 //request target, including any query string
+#define HTTP_HDR_NAME_MAX 24 //longer header names are truncated (we don't care about any that long)
+#ifdef OTA_KEY //see config
+#define HTTP_AUTH_MAX (sizeof("Bearer " OTA_KEY)) //Authorization value, for POST /update - room for the whole key
+#else
+#define HTTP_AUTH_MAX 1 //not used
+#endif
+#define HTTP_HDR_VAL_MAX (HTTP_AUTH_MAX>48? HTTP_AUTH_MAX: 48) //likewise header values - unless we'd act on them, in which case they're rejected with 431
+#define HTTP_HEAD_MAX 4096 //request line + headers - anything bigger is rejected
+#define HTTP_BODY_MAX 1024 //url-encoded form or JSON body - enough to set every setting at once, or a fully percent-encoded SSID and passphrase
+#define HTTP_ETAG_MAX 16 //If-None-Match value - only needs to hold one of our own ETags
+static_assert(HTTP_HDR_VAL_MAX<=255 && HTTP_PATH_MAX<=255, "HttpRequest::pos is a byte - OTA_KEY is too long");
+
+//Parser states, in the order they normally occur
+#define HTTP_ST_METHOD 0
+#define HTTP_ST_PATH 1
+#define HTTP_ST_VERSION 2
+#define HTTP_ST_HDR_NAME 3
+#define HTTP_ST_HDR_VAL 4
+#define HTTP_ST_BODY 5
+#define HTTP_ST_DONE 6 //complete request - ready to handle
+#define HTTP_ST_ERROR 7 //malformed or too big - see HttpRequest.error for the status code to return
+#define HTTP_ST_STREAM 8 //headers complete, but the body is too big for HttpRequest.body - left for the caller to read (POST /update)
+
+//Methods
+#define HTTP_UNKNOWN 0
+#define HTTP_GET 1
+#define HTTP_POST 2
+#define HTTP_PATCH 3
+
+struct HttpRequest {
+  byte state;
+  byte method;
+  int error; //HTTP status code when state is HTTP_ST_ERROR (400, 413, 414, 431, 501)
+  char methodBuf[HTTP_METHOD_MAX];
+  char path[HTTP_PATH_MAX];
+  char hdrName[HTTP_HDR_NAME_MAX];
+  char hdrVal[HTTP_HDR_VAL_MAX];
+  bool hdrOver; //hdrVal was cut short
+  byte pos; //write position in whichever buffer the current state fills
+  word headLen; //bytes seen before the body
+  long contentLength;
+  char ifNoneMatch[HTTP_ETAG_MAX]; //to compare against the ETag of a cacheable response
+  char auth[HTTP_AUTH_MAX]; //Authorization value, for POST /update
+  unsigned long crc; //X-CRC32 value (hex), for POST /update...
+  bool hasCRC; //...if given
+  char body[HTTP_BODY_MAX+1]; //+1 for termination
+  word bodyLen;
+  word formPos; //read position for httpFormNext() or httpJSONNext()
+  char jsonDelim; //the ',' or '}' httpJSONNext() last consumed (overwritten to terminate a value)
+};
+
+void httpReset(HttpRequest *r);
+byte httpFail(HttpRequest *r, int error);
+byte httpHeader(HttpRequest *r);
+byte httpFeed(HttpRequest *r, char c);
+int httpFeedBuf(HttpRequest *r, const byte *buf, int len);
+byte httpHexVal(char c);
+void httpDecode(char *s);
+bool httpFormNext(HttpRequest *r, char **key, char **val);
+char httpJSONString(char **p);
+char httpJSONNext(HttpRequest *r, char **key, char **val);
+bool httpParseIP(const char *s, byte ip[4]);
+void httpPrintJSON(Print &out, const char *s);
+const __FlashStringHelper* httpReason(int status);
+
+//Builds a response in a RAM buffer, so it can go out to the client in a few large writes (see checkClients()).
+//begin() writes the headers with a blank Content-Length, which end() fills in once the body has been printed.
+class HttpOut : public Print {
+  public:
+    HttpOut(byte *buf, word size): buf(buf), size(size), len(0), lenPos(0), bodyPos(0), overflow(false) {}
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *b, size_t n);
+    using Print::write;
+    void begin(int status, const __FlashStringHelper *type);
+    void end();
+    word length(){ return len; }
+    bool overflowed(){ return overflow; }
+  private:
+    byte *buf;
+    word size, len, lenPos, bodyPos;
+    bool overflow;
+};
+
+#endif //HTTP_H
@@ -6,9 +6,15 @@
 //Needs access to RTC timestamps
 #include "rtcDS3231.h"
 #include "rtcMillis.h"
+//Records control events, if enabled
+#include "trace.h"
 
 #define HOLDSET_SLOW_RATE 125
 #define HOLDSET_FAST_RATE 20
+#define HOLDSET_RAMP 3000 //ms - after CTRL_HOLD_LONG_DUR, hold-setting speeds up to full velocity over this long
+#define INPUT_DOUBLE_DUR 300 //ms - a press this soon after a short press of the same button is a double press
+#define INPUT_DEBOUNCE 10000 //µs - after an edge, ignore any others on the same button for this long
+#define INPUT_QUEUE_SIZE 8 //edges that can wait for checkInputs() - must be a power of 2
 
 //#include "Arduino.h" //not necessary, since these get compiled as part of the main sketch
 #ifdef INPUT_UPDN_ROTARY
@@ -30,33 +36,92 @@
   #ifndef CTRL_DN
     #define CTRL_DN 103
   #endif
+  //The IMU fills its FIFO with acceleration samples at a fixed rate, and we collect them in batches every IMU_READ_INTERVAL,
+  //rather than making an I2C round trip for a single reading on every loop. Samples are low-pass filtered, then put
+  //through the orientation given by IMU_FRONT/IMU_TOP, so the thresholds below are in terms of the clock, not the board.
+  #include <Wire.h>
+  #define IMU_ADDR 0x6A //LSM6DS3 on Nano 33 IoT, per Arduino_LSM6DS3
+  #define IMU_READ_INTERVAL 100 //ms - about 2-3 samples per read at the FIFO rate below
+  #define IMU_FIFO_BURST 30 //most FIFO words (of 3 per sample) to read at once
+  #define IMU_1G 8192 //raw reading for 1g at the ±4g scale Arduino_LSM6DS3 sets
+  #define IMU_FILTER 2 //low-pass filter: each sample moves the filtered value 1/(2^IMU_FILTER) of the way to it
+  //Board sides (per IMU_FRONT/IMU_TOP) as sensor axes (0=x, 1=y, 2=z) and signs.
+  //Left/right are as seen from the top (component side), with the USB end pointing away.
+  #define IMU_AXIS(side) ((side)<2? 2: ((side)<4? 1: 0))
+  #define IMU_SIGN(side) ((side)==1 || (side)==2 || (side)==4? 1: -1)
+  #if IMU_AXIS(IMU_FRONT)==IMU_AXIS(IMU_TOP)
+    #error "IMU_FRONT and IMU_TOP must be adjacent sides"
+  #endif
+  //The clock's right (as seen from the front) is top × front
+  #define IMU_RIGHT_AXIS (3-IMU_AXIS(IMU_TOP)-IMU_AXIS(IMU_FRONT))
+  #define IMU_RIGHT_SIGN (IMU_SIGN(IMU_TOP)*IMU_SIGN(IMU_FRONT)*((IMU_AXIS(IMU_FRONT)-IMU_AXIS(IMU_TOP)+3)%3==1? 1: -1))
   //IMU "debouncing"
   int imuRoll = 0; //the state we're reporting (-1, 0, 1)
-  int imuRollLast = 0; //when we saw it change
+  unsigned long imuRollLast = 0; //when we saw it change
   int imuPitch = 0; //the state we're reporting (-1, 0, 1)
-  int imuPitchLast = 0; //when we saw it change
-  //int imuLastRead = 0; //for debug
+  unsigned long imuPitchLast = 0; //when we saw it change
+  unsigned long imuReadLast = 0;
+  long imuFilt[3] = {0,0,0}; //filtered acceleration per sensor axis, raw units
+  int imuSample[3]; //sample being read in...
+  byte imuSampleAxis = 0; //...and which axis is next
+  bool imuPrimed = false; //whether imuFilt has had a sample yet
+  void imuWriteReg(byte reg, byte val){
+    Wire.beginTransmission(IMU_ADDR); Wire.write(reg); Wire.write(val); Wire.endTransmission();
+  }
+  bool imuReadRegs(byte reg, byte *buf, byte len){
+    Wire.beginTransmission(IMU_ADDR); Wire.write(reg);
+    if(Wire.endTransmission(false)!=0) return false;
+    if(Wire.requestFrom((uint8_t)IMU_ADDR,len)!=len) return false;
+    for(byte i=0; i<len; i++) buf[i] = Wire.read();
+    return true;
+  }
+  void initIMU(){
+    IMU.begin(); //sets up I2C, and accelerometer at 104Hz ±4g
+    imuWriteReg(0x11,0x00); //CTRL2_G: gyroscope off - we don't use it
+    imuWriteReg(0x0A,0x00); //FIFO_CTRL5: bypass mode, which empties the FIFO
+    imuWriteReg(0x08,0x01); //FIFO_CTRL3: accelerometer into the FIFO, undecimated; gyroscope not
+    imuWriteReg(0x0A,0x16); //FIFO_CTRL5: FIFO rate ~26Hz, continuous mode (oldest samples overwritten if we fall behind)
+  }
   void readIMU(){
-    float x, y, z;
-    IMU.readAcceleration(x,y,z);
+    //Reads whatever samples have collected in the FIFO since last time, and updates imuRoll/imuPitch per the filtered result
+    if(imuReadLast && (unsigned long)(millis()-imuReadLast)<IMU_READ_INTERVAL) return;
+    imuReadLast = millis(); if(!imuReadLast) imuReadLast = 1; //can't be zero
+    byte buf[IMU_FIFO_BURST*2];
+    if(!imuReadRegs(0x3A,buf,4)) return; //FIFO_STATUS1-4
+    word words = buf[0] | ((buf[1]&0x0F)<<8); //unread
+    imuSampleAxis = (buf[2] | ((buf[3]&0x03)<<8))%3; //pattern: which axis comes out next
+    if(words>IMU_FIFO_BURST) words = IMU_FIFO_BURST; //the rest will keep
+    if(!words || !imuReadRegs(0x3E,buf,words*2)) return; //FIFO_DATA_OUT - reads repeat from the FIFO
+    for(word i=0; i<words; i++){
+      imuSample[imuSampleAxis] = (int)(int16_t)(buf[i*2] | (buf[i*2+1]<<8));
+      if(++imuSampleAxis<3) continue;
+      imuSampleAxis = 0;
+      for(byte a=0; a<3; a++){
+        if(!imuPrimed) imuFilt[a] = imuSample[a];
+        else imuFilt[a] += (imuSample[a]-imuFilt[a])/(1<<IMU_FILTER);
+      }
+      imuPrimed = true;
+    }
+    if(!imuPrimed) return;
+    //Acceleration reads +1g along whichever way is up - so front is up when tilted backward, right is down when tilted right
+    long front = IMU_SIGN(IMU_FRONT)*imuFilt[IMU_AXIS(IMU_FRONT)];
+    long right = IMU_RIGHT_SIGN*imuFilt[IMU_RIGHT_AXIS];
     int imuState;
-    
-    //Assumes Arduino is oriented with components facing back of clock, and USB port facing up. TODO add support for other orientations
 
     //Roll
     if((unsigned long)(millis()-imuRollLast)>=IMU_DEBOUNCING){ //don't check within a period from the last change
-           if(y<=-0.5) imuState = 1;
-      else if(y>= 0.5) imuState = -1;
-      else if(y>-0.3 && y<0.3) imuState = 0;
+           if(right<=-IMU_1G/2) imuState = 1;
+      else if(right>= IMU_1G/2) imuState = -1;
+      else if(right>-IMU_1G*3/10 && right<IMU_1G*3/10) imuState = 0;
       else imuState = imuRoll; //if it's borderline, treat it as "same"
       if(imuRoll != imuState){ imuRoll = imuState; imuRollLast = millis(); } //TODO maybe add audible feedback
     }
 
     //Pitch
     if((unsigned long)(millis()-imuPitchLast)>=IMU_DEBOUNCING){ //don't check within a period from the last change
-           if(z<=-0.5) imuState = 1;
-      else if(z>= 0.5) imuState = -1;
-      else if(z>-0.3 && z<0.3) imuState = 0;
+           if(front>= IMU_1G/2) imuState = 1;
+      else if(front<=-IMU_1G/2) imuState = -1;
+      else if(front>-IMU_1G*3/10 && front<IMU_1G*3/10) imuState = 0;
       else imuState = imuPitch; //if it's borderline, treat it as "same"
       if(imuPitch != imuState){ imuPitch = imuState; imuPitchLast = millis(); }
     }
@@ -66,15 +131,41 @@
 
 byte inputCur = 0; //Momentary button (or IMU position) currently in use - only one allowed at a time
 byte inputCurHeld = 0; //Button hold thresholds: 0=none, 1=unused, 2=short, 3=long, 4=verylong, 5=superlong, 10=set by inputStop()
+byte inputChord = 0; //Button pressed while inputCur was held - ignored until released
+byte inputTapBtn = 0; //Button last released after a short press, and when - for double presses
+unsigned long inputTapLast = 0;
 
 unsigned long inputLast = 0; //When an input last took place, millis()
 int inputLastTODMins = 0; //When an input last took place, time of day. Used in paginated functions so they all reflect the time of day when the input happened.
 
+//Buttons are read by interrupt where the pin allows it, so presses shorter than the loop aren't missed, and holds are
+//timed from when the button actually went down. inputSample() runs on each pin change (and once per loop, to catch
+//anything the debouncing hid) and queues each debounced edge with its micros() time; checkInputs() hands them to
+//btnEvt() in order. The queue is written only by inputSample() and read only by checkInputs(), so needs no locking.
+//Pins that can't interrupt (e.g. analog-only A6/A7 on the classic Nano) are polled as before. The rotary encoder
+//already counts by interrupt, in the Encoder library. IMU positions are polled, so if the IMU is in use, so are buttons.
+#if defined(INPUT_BUTTONS) && !defined(INPUT_IMU)
+  #define INPUT_INTERRUPTS
+#endif
+struct InputEdge {
+  byte i; //index into inputPins
+  bool pressed;
+  unsigned long t; //micros()
+};
+byte inputPins[4] = {0,0,0,0}; //Sel, Alt, Up, Dn - 0 if not equipped
+volatile byte inputIntMask = 0; //which of those are read by interrupt (bit per index)
+volatile bool inputIntState[4]; //pressed, per the last edge queued
+volatile unsigned long inputIntEdge[4]; //when that edge was, micros()
+bool inputBtnState[4]; //pressed, per the last edge handed to btnEvt()
+volatile InputEdge inputQueue[INPUT_QUEUE_SIZE];
+volatile byte inputQueueHead = 0; //next slot inputSample() will write
+volatile byte inputQueueTail = 0; //next slot checkInputs() will read
+
 bool initInputs(){
   //TODO are there no "loose" pins left floating after this? per https://electronics.stackexchange.com/q/37696/151805
   #ifdef INPUT_BUTTONS
     pinMode(CTRL_SEL, INPUT_PULLUP);
-    if(CTRL_ALT>0){ //preprocessor directives don't seem to work for this when e.g. "A7"
+    if(hasAlt){ //see traits.h - CTRL_ALT may be e.g. A7, which #if can't see
       pinMode(CTRL_ALT, INPUT_PULLUP);
     }
     #ifdef INPUT_UPDN_BUTTONS
@@ -87,15 +178,97 @@ bool initInputs(){
   #endif
   #ifdef INPUT_IMU
     //if(!IMU.begin()){ Serial.println(F("Failed to initialize IMU!")); while(1); }
-    IMU.begin();
+    initIMU();
     //Serial.println(F("IMU initialized"));
   #endif
+  #ifdef INPUT_INTERRUPTS
+    inputPins[0] = CTRL_SEL;
+    if(hasAlt) inputPins[1] = CTRL_ALT;
+    #ifdef INPUT_UPDN_BUTTONS
+      inputPins[2] = CTRL_UP;
+      inputPins[3] = CTRL_DN;
+    #endif
+  #endif
   //Check to see if CTRL_SEL is held at init - facilitates version number display and EEPROM hard init
   delay(100); //prevents the below from firing in the event there's a capacitor stabilizing the input, which can read low falsely
+  #ifdef INPUT_INTERRUPTS
+    for(byte i=0; i<4; i++){
+      if(!inputPins[i]) continue;
+      inputBtnState[i] = inputIntState[i] = readBtn(inputPins[i]); //start from the current state, so there's no spurious edge
+      if(inputAttach(inputPins[i])) inputIntMask |= (1<<i);
+    }
+  #endif
   if(readBtn(CTRL_SEL)){ inputCur = CTRL_SEL; return true; }
   else return false;
 }
 
+#ifdef INPUT_INTERRUPTS
+#if defined(__AVR__) && defined(digitalPinToPCICR)
+  //Classic AVR: pin change interrupts, which most pins have, rather than the two external interrupts
+  #ifdef PCINT0_vect
+  ISR(PCINT0_vect){ inputSample(); }
+  #endif
+  #ifdef PCINT1_vect
+  ISR(PCINT1_vect){ inputSample(); }
+  #endif
+  #ifdef PCINT2_vect
+  ISR(PCINT2_vect){ inputSample(); }
+  #endif
+#endif
+bool inputAttach(byte pin){ //"private"
+  //Has pin call inputSample() on change, if it can. If not, returns false, and it will be polled instead.
+  if(pin==A6 || pin==A7) return false; //analog-only on some boards - readBtn() uses analogRead
+  #if defined(__AVR__) && defined(digitalPinToPCICR)
+    if(!digitalPinToPCICR(pin)) return false;
+    *digitalPinToPCMSK(pin) |= _BV(digitalPinToPCMSKbit(pin));
+    *digitalPinToPCICR(pin) |= _BV(digitalPinToPCICRbit(pin));
+  #else
+    #ifdef ARDUINO_ARCH_SAMD
+      if(g_APinDescription[pin].ulExtInt==NOT_AN_INTERRUPT) return false;
+    #endif
+    if(digitalPinToInterrupt(pin)==NOT_AN_INTERRUPT) return false;
+    attachInterrupt(digitalPinToInterrupt(pin),inputSample,CHANGE);
+  #endif
+  return true;
+}
+void inputSample(){ //"private"
+  //Runs in interrupt context (or with interrupts off) - queues a debounced edge for any button that has changed.
+  //If the queue is full, the edge is dropped, and picked up on a later call instead.
+  unsigned long t = micros();
+  for(byte i=0; i<4; i++){
+    if(!(inputIntMask&(1<<i))) continue;
+    bool pressed = !(digitalRead(inputPins[i])); //LOW when pressed
+    if(pressed==inputIntState[i] || (unsigned long)(t-inputIntEdge[i])<INPUT_DEBOUNCE) continue;
+    byte next = (inputQueueHead+1)&(INPUT_QUEUE_SIZE-1);
+    if(next==inputQueueTail) continue; //full
+    inputQueue[inputQueueHead].i = i; inputQueue[inputQueueHead].pressed = pressed; inputQueue[inputQueueHead].t = t;
+    inputQueueHead = next; //only now can checkInputs() see it
+    inputIntState[i] = pressed; inputIntEdge[i] = t;
+  }
+}
+#endif //INPUT_INTERRUPTS
+
+bool inputPending(){
+  //Whether a button edge is waiting for checkInputs() - so a nap (see power.cpp) can end early for it
+  #ifdef INPUT_INTERRUPTS
+    return inputQueueHead!=inputQueueTail;
+  #else
+    return false;
+  #endif
+}
+
+bool inputPolled(){
+  //Whether any button is polled rather than read by interrupt - so a nap (see power.cpp) must not outlast a press
+  #ifdef INPUT_INTERRUPTS
+    for(byte i=0; i<4; i++) if(inputPins[i] && !(inputIntMask&(1<<i))) return true;
+    return false;
+  #elif defined(INPUT_BUTTONS)
+    return true;
+  #else
+    return false; //IMU tilts are held positions, and the rotary encoder counts by interrupt
+  #endif
+}
+
 bool readBtn(byte btn){
   //Reads momentary button and/or IMU position, as equipped
   //Returns true if one or both are "pressed"
@@ -109,8 +282,7 @@ bool readBtn(byte btn){
   #endif
   #ifdef INPUT_IMU
     switch(btn){
-      //Assumes Arduino is oriented with components facing back of clock, and USB port facing up
-      //TODO support other orientations
+      //imuPitch/imuRoll are in terms of the clock, per IMU_FRONT/IMU_TOP - see above
       case CTRL_SEL: imuPressed = imuPitch>0; break; //clock tilted dial up
       case CTRL_ALT: imuPressed = imuPitch<0; break; //clock tilted dial down
       case CTRL_DN:  imuPressed = imuRoll<0; break; //clock tilted left
@@ -121,13 +293,46 @@ bool readBtn(byte btn){
   return (btnPressed || imuPressed);
 }
 
+void inputEvt(byte ctrl, byte evt, byte evtLast, byte velocity){ //"private"
+  //Passes a control event to ctrlEvt in main code - recording it, if INPUT_TRACE is enabled (see trace.cpp)
+  #ifdef INPUT_TRACE
+  traceBegin();
+  #endif
+  ctrlEvt(ctrl,evt,evtLast,velocity);
+  #ifdef INPUT_TRACE
+  traceEnd(ctrl,evt,evtLast,velocity,0);
+  #endif
+}
+
+byte inputVel(unsigned long x, unsigned long full){ //"private"
+  //Velocity (0-255) for x out of full, on a curve that starts gently and gets steep - for acceleration while setting
+  if(x>=full) return 255;
+  return (255*((x*64)/full)*((x*64)/full))>>12;
+}
+
 unsigned long holdLast;
 void checkBtn(byte btn){
   //Polls for changes in momentary buttons (or IMU positioning), LOW = pressed.
-  //When a button event has occurred, will call ctrlEvt in main code.
-  //Only called by checkInputs() and only for inputs configured as button and/or IMU.
-  bool bnow = readBtn(btn);
-  unsigned long now = millis();
+  //Only called by checkInputs() and only for inputs configured as button and/or IMU, and not read by interrupt.
+  btnEvt(btn,readBtn(btn),millis(),false);
+}
+void btnEvt(byte btn, bool bnow, unsigned long now, bool edge){
+  //Follows button btn to state bnow (true = pressed) as of now. When a button event has occurred, will call ctrlEvt in main code.
+  //If edge, now is when the button was actually pressed or released (see inputSample()), rather than just when we looked -
+  //so a release will first pass any hold thresholds that were reached while the loop was busy.
+  //Besides the press/hold/release events, recognizes two gestures (except with IMU, where tilts are not separate buttons):
+  //a chord - a second button pressed while one is held - sends evt 7 for the second button, with the held one as evtLast,
+  //and spends the held one (as inputStop() does); and a double press - a press soon after a short press of the same button -
+  //sends evt 6 after the usual press, if neither was stopped by inputStop().
+  #ifndef INPUT_IMU
+    if(inputChord){
+      if(btn==inputChord){ if(!bnow) inputChord = 0; return; } //chord button: nothing more until it's released
+    } else if(inputCur!=0 && inputCur!=btn && bnow){
+      inputChord = btn; inputCurHeld = 10; inputTapBtn = 0;
+      inputEvt(btn,7,inputCur); //hey, the button was pressed while inputCur was held
+      return;
+    }
+  #endif
   //If the button has just been pressed, and no other buttons are in use...
   if(inputCur==0 && bnow) {
     // Serial.print(F("Btn "));
@@ -135,36 +340,40 @@ void checkBtn(byte btn){
     // Serial.println(F(" pressed"));
     inputCur = btn; inputCurHeld = 0; inputLast = now; inputLastTODMins = rtcGetTOD();
     //Serial.println(); Serial.println(F("ich now 0 per press"));
-    ctrlEvt(btn,1,inputCurHeld); //hey, the button has been pressed
+    inputEvt(btn,1,inputCurHeld); //hey, the button has been pressed
+    #ifndef INPUT_IMU
+      if(inputTapBtn==btn && (unsigned long)(now-inputTapLast)<=INPUT_DOUBLE_DUR && inputCurHeld<10) inputEvt(btn,6,inputCurHeld); //hey, it was pressed twice
+      else inputTapBtn = 0;
+    #endif
     //Serial.print(F("ich now ")); Serial.print(inputCurHeld,DEC); Serial.println(F(" after press > ctrlEvt"));
   }
-  //If the button is being held...
-  if(inputCur==btn && bnow) {
+  //If the button is being held (or was, until now)...
+  if(inputCur==btn && (bnow || edge)) {
     //If the button has passed a hold duration threshold... (ctrlEvt will only act on these for Sel/Alt)
     if((unsigned long)(now-inputLast)>=CTRL_HOLD_SUPERLONG_DUR && inputCurHeld < 5){
-      ctrlEvt(btn,5,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 5;
+      inputEvt(btn,5,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 5;
       //Serial.print(F("ich now ")); Serial.print(inputCurHeld,DEC); Serial.println(F(" after 5 hold > ctrlEvt"));
     }
     else if((unsigned long)(now-inputLast)>=CTRL_HOLD_VERYLONG_DUR && inputCurHeld < 4){
-      ctrlEvt(btn,4,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 4;
+      inputEvt(btn,4,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 4;
       //Serial.print(F("ich now ")); Serial.print(inputCurHeld,DEC); Serial.println(F(" after 4 hold > ctrlEvt"));
     }
     else if((unsigned long)(now-inputLast)>=CTRL_HOLD_LONG_DUR && inputCurHeld < 3){
-      ctrlEvt(btn,3,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 3;
+      inputEvt(btn,3,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 3;
       //Serial.print(F("ich now ")); Serial.print(inputCurHeld,DEC); Serial.println(F(" after 3 hold > ctrlEvt"));
     }
     else if((unsigned long)(now-inputLast)>=CTRL_HOLD_SHORT_DUR && inputCurHeld < 2) {
       //Serial.print(F("ich was ")); Serial.println(inputCurHeld,DEC);
-      ctrlEvt(btn,2,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 2;
+      inputEvt(btn,2,inputCurHeld); if(inputCurHeld<10) inputCurHeld = 2;
       //Serial.print(F("ich now ")); Serial.print(inputCurHeld,DEC); Serial.println(F(" after 2 hold > ctrlEvt"));
       holdLast = now; //starts the repeated presses code going
     }
-    //While Up/Dn are being held, send repeated presses to ctrlEvt
+    //While Up/Dn are being held, send repeated presses to ctrlEvt - faster after a long hold, then with increasing velocity
     #if defined(INPUT_UPDN_BUTTONS) || defined(INPUT_IMU)
-      if((btn==CTRL_UP || btn==CTRL_DN) && inputCurHeld >= 2){
-        if((unsigned long)(now-holdLast)>=(inputCurHeld>=3?HOLDSET_FAST_RATE:HOLDSET_SLOW_RATE)){ //could make it nonlinear?
+      if((btn==CTRL_UP || btn==CTRL_DN) && inputCurHeld >= 2 && inputCurHeld < 10 && bnow){
+        if((unsigned long)(now-holdLast)>=(inputCurHeld>=3?HOLDSET_FAST_RATE:HOLDSET_SLOW_RATE)){
           holdLast = now;
-          ctrlEvt(btn,1,inputCurHeld);
+          inputEvt(btn,1,inputCurHeld,(inputCurHeld>=3? inputVel(now-inputLast-CTRL_HOLD_LONG_DUR,HOLDSET_RAMP): 0));
         }
       }
     #endif
@@ -172,8 +381,12 @@ void checkBtn(byte btn){
   //If the button has just been released...
   if(inputCur==btn && !bnow) {
     inputCur = 0;
+    //For double presses, note a short press - unless it was the second of a double, so a third press starts over,
+    //or it was stopped, e.g. saving a value, so pressing again right after doesn't count
+    if(inputTapBtn!=btn && inputCurHeld<10 && (unsigned long)(now-inputLast)<CTRL_HOLD_SHORT_DUR){ inputTapBtn = btn; inputTapLast = now; }
+    else inputTapBtn = 0;
     //Only act if the button hasn't been stopped
-    if(inputCurHeld<10) ctrlEvt(btn,0,inputCurHeld); //hey, the button was released after inputCurHeld
+    if(inputCurHeld<10) inputEvt(btn,0,inputCurHeld); //hey, the button was released after inputCurHeld
     //Serial.print(F("ich now ")); Serial.print(inputCurHeld,DEC); Serial.println(F(" then 0 after release > ctrlEvt"));
     inputCurHeld = 0;
   }
@@ -184,7 +397,7 @@ void inputStop(){
   //Serial.println(F("ich now 10 per inputStop"));
 }
 
-bool rotVel = 0; //high velocity setting (x10 rather than x1)
+byte rotVel = 0; //velocity setting (0-255, see inputVel)
 #ifdef INPUT_UPDN_ROTARY
 unsigned long rotLastStep = 0; //timestamp of last completed step (detent)
 int rotLastVal = 0;
@@ -196,11 +409,14 @@ void checkRot(){
     if(rotCurVal>=4 || rotCurVal<=-4){ //we've completed a step of 4 states (this library doesn't seem to drop states much, so this is reasonably reliable)
       unsigned long now = millis();
       inputLast = now; inputLastTODMins = rtcGetTOD();
-      if((unsigned long)(now-rotLastStep)<=ROT_VEL_START) rotVel = 1; //kick into high velocity setting (x10)
-      else if((unsigned long)(now-rotLastStep)>=ROT_VEL_STOP) rotVel = 0; //fall into low velocity setting (x1)
+      //Velocity rises from 0 at ROT_VEL_STOP ms per step to full at ROT_VEL_START. It takes a faster pace at once, but a
+      //slower one only gradually, so a flick of the knob carries through the detents at the end of it.
+      unsigned long stepDur = (now-rotLastStep)/(abs(rotCurVal)/4); //several steps since last time, if we were busy
+      byte vel = (stepDur>=ROT_VEL_STOP? 0: inputVel(ROT_VEL_STOP-stepDur,ROT_VEL_STOP-ROT_VEL_START));
+      rotVel = (vel>=rotVel? vel: (rotVel+vel)/2);
       rotLastStep = now;
-      while(rotCurVal>=4) { rotCurVal-=4; ctrlEvt(CTRL_UP,1,inputCurHeld,rotVel); }
-      while(rotCurVal<=-4) { rotCurVal+=4; ctrlEvt(CTRL_DN,1,inputCurHeld,rotVel); }
+      while(rotCurVal>=4) { rotCurVal-=4; inputEvt(CTRL_UP,1,inputCurHeld,rotVel); }
+      while(rotCurVal<=-4) { rotCurVal+=4; inputEvt(CTRL_DN,1,inputCurHeld,rotVel); }
       rot.write(rotCurVal);
     }
   }
@@ -212,11 +428,28 @@ void checkInputs(){
   #ifdef INPUT_IMU
     readIMU(); //captures IMU state for checkBtn/readBtn to look at
   #endif
+  #ifdef INPUT_INTERRUPTS
+    //Hand queued edges to btnEvt() in order, at the times they happened, then let any buttons still held reach their hold thresholds
+    noInterrupts(); inputSample(); interrupts(); //catch any change the interrupts didn't queue (e.g. a bounce that settled within INPUT_DEBOUNCE)
+    unsigned long nowMs = millis(); unsigned long nowUs = micros();
+    byte head = inputQueueHead; //any edges queued after this are later than nowUs - leave them for next time
+    while(inputQueueTail!=head){
+      volatile InputEdge *e = &inputQueue[inputQueueTail];
+      inputBtnState[e->i] = e->pressed;
+      btnEvt(inputPins[e->i],e->pressed,nowMs-(unsigned long)(nowUs-e->t)/1000,true);
+      inputQueueTail = (inputQueueTail+1)&(INPUT_QUEUE_SIZE-1); //only now can inputSample() reuse the slot
+    }
+    for(byte i=0; i<4; i++){
+      if(!inputPins[i]) continue;
+      if(inputIntMask&(1<<i)) btnEvt(inputPins[i],inputBtnState[i],millis(),false);
+      else checkBtn(inputPins[i]);
+    }
+  #else
   //checkBtn calls readBtn which will read button and/or IMU as equipped
   //We just need to only call checkBtn if one or the other is equipped
   #if defined(INPUT_BUTTONS) || defined(INPUT_IMU)
     checkBtn(CTRL_SEL);
-    if(CTRL_ALT>0){ //preprocessor directives don't seem to work for this when e.g. "A7"
+    if(hasAlt){ //see traits.h - CTRL_ALT may be e.g. A7, which #if can't see
       checkBtn(CTRL_ALT);
     }
     #if defined(INPUT_UPDN_BUTTONS) || defined(INPUT_IMU)
@@ -224,6 +457,7 @@ void checkInputs(){
       checkBtn(CTRL_DN);
     #endif
   #endif
+  #endif //INPUT_INTERRUPTS
   #ifdef INPUT_UPDN_ROTARY
     checkRot();
   #endif
@@ -18,11 +18,21 @@
 #endif
 
 //#ifdef INPUT_IMU
+void imuWriteReg(byte reg, byte val);
+bool imuReadRegs(byte reg, byte *buf, byte len);
+void initIMU();
 void readIMU();
 //#endif
 bool initInputs();
+bool inputAttach(byte pin);
+void inputSample();
+bool inputPending();
+bool inputPolled();
 bool readBtn(byte btn);
+void inputEvt(byte ctrl, byte evt, byte evtLast, byte velocity=0);
+byte inputVel(unsigned long x, unsigned long full);
 void checkBtn(byte btn);
+void btnEvt(byte btn, bool bnow, unsigned long now, bool edge);
 void inputStop();
 //#ifdef INPUT_UPDN_ROTARY
 void checkRot();
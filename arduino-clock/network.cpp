@@ -15,17 +15,35 @@
 #include "rtcMillis.h"
 //Needs to be able to save to persistent storage
 #include "storage.h"
+//Parses requests to the admin page
+#include "http.h"
+//The admin page itself
+#include "adminPage.h"
+//Firmware updates, if enabled
+#include "ota.h"
+//Weather forecast, if enabled
+#include "weather.h"
+//Control event traces, if enabled
+#include "trace.h"
+//Output pin traces, if enabled
+#include "pintrace.h"
+//Custom signal tunes
+#include "pattern.h"
+//Low-power idle residency, for metrics
+#include "power.h"
 
 //Volatile vars that back up the wifi creds in EEPROM
 // 55-86 Wi-Fi SSID (32 bytes)
 // 87-150 Wi-Fi WPA passphrase/key or WEP key (64 bytes)
 // 151 Wi-Fi WEP key index (1 byte)
-//If the EEPROM ssid/pass are a full 32/64 chars, there won't be room for the termination character '\0', we'll add that when reading
-//TODO consider making these char arrays - but the memory usage on SAMD isn't bad as-is
-String wssid = "";
-String wpass = ""; //wpa pass or wep key
+//Fixed buffers rather than String, so editing them over the clock's life doesn't fragment the heap.
+//If the EEPROM ssid/pass are a full 32/64 chars, there's no termination character '\0' - the buffers have room to add one.
+char wssid[33] = "";
+char wpass[65] = ""; //wpa pass or wep key
 byte wki = 0; //wep key index - 0 if using wpa
 
+int ramFreeLow = 0x7FFF; //least free RAM seen - see checkRAM()
+
 unsigned int localPort = 2390; // local port to listen for UDP packets
 #define NTP_PACKET_SIZE 48 // NTP time stamp is in the first 48 bytes of the message
 byte packetBuffer[ NTP_PACKET_SIZE]; //buffer to hold incoming and outgoing packets
@@ -34,9 +52,32 @@ WiFiUDP Udp; // A UDP instance to let us send and receive packets over UDP
 WiFiServer server(80);
 
 #define ADMIN_TIMEOUT 3600000 //120000; //two minutes
+#define ADMIN_SET_MAX 48 //most settings accepted in one request - more than there are
 #define NTP_TIMEOUT 1000 //how long to wait for a request to finish - the longer it takes, the less reliable the result is
 #define NTP_MINFREQ 5000 //how long to enforce a wait between request starts (NIST requires at least 4sec between requests or will ban the client)
 #define NTPOK_THRESHOLD 3600000 //if no sync within 60 minutes, the time is considered stale
+#define WIFI_POLL_FREQ 250 //how often to check on the Wi-Fi module's connection status
+#define WIFI_CONNECT_TIMEOUT 20000 //how long to give an association attempt before calling it failed
+#define WIFI_RETRY_MIN 15000 //after a failed or dropped connection, wait this long before trying again...
+#define WIFI_RETRY_MAX 900000 //...doubling the wait with each failure, up to this (15 minutes)
+#define WIFI_AP_TIMEOUT 10000 //how long to give the module to start the access point before asking again
+
+//Wi-Fi connection state, advanced by checkWiFi() on every cycle, so the clock keeps running while the module connects
+#define WIFI_OFF 0 //no credentials, or disconnected on purpose
+#define WIFI_CONNECTING 1 //association started, waiting for the module to report back
+#define WIFI_CONNECTED 2 //server and UDP are up
+#define WIFI_RETRY 3 //attempt failed or connection lost, waiting out wifiRetryDelay
+#define WIFI_AP 4 //offering access point - no retries
+#define WIFI_AP_STARTING 5 //access point requested, waiting for the module to report it's listening
+byte wifiState = WIFI_OFF;
+unsigned long wifiStateStart = 0; //when wifiState last changed
+unsigned long wifiPollLast = 0;
+unsigned long wifiRetryDelay = WIFI_RETRY_MIN;
+bool wifiAdminPending = false; //admin was requested while connecting - start it once the attempt resolves
+bool adminWiFiChanged = false; //set by adminSet() - reconnect once the client has its response
+bool adminStorageChanged = false; //set by adminSet() - so adminSetAll() only commits if needed
+unsigned long wifiConnects = 0; //since boot, for metrics
+unsigned long wifiDrops = 0;
 
 bool networkSupported(){ return true; }
 
@@ -47,17 +88,23 @@ void initNetwork(){
   //else if(WiFi.firmwareVersion()<WIFI_FIRMWARE_LATEST_VERSION) Serial.println(F("Please upgrade the firmware"));
   //Get wifi credentials out of EEPROM - see wssid/wpass definitions above
   //Read until a termination character is reached
-  for(byte i=0; i<32; i++){ if(readEEPROM(55+i,false)=='\0') break; wssid.concat((char)(readEEPROM(55+i,false))); } //Read in the SSID
-  for(byte i=0; i<64; i++){ if(readEEPROM(87+i,false)=='\0') break; wpass.concat((char)(readEEPROM(87+i,false))); } //Read in the pass
+  for(byte i=0; i<32; i++){ wssid[i] = readEEPROM(55+i,false); if(wssid[i]=='\0') break; } wssid[32] = '\0'; //Read in the SSID
+  for(byte i=0; i<64; i++){ wpass[i] = readEEPROM(87+i,false); if(wpass[i]=='\0') break; } wpass[64] = '\0'; //Read in the pass
   wki = readEEPROM(151,false); //Read in the wki
   //Serial.print(F("wssid=")); Serial.println(wssid);
   //Serial.print(F("wpass=")); Serial.println(wpass);
   //Serial.print(F("wki=")); Serial.println(wki);
+  WiFi.setTimeout(0); //make WiFi.begin()/beginAP() return as soon as the module has the creds, rather than waiting to connect - checkWiFi() follows up
   networkStartWiFi();
 }
 void cycleNetwork(){
+  checkRAM();
+  checkWiFi();
   checkClients();
   checkNTP();
+  #if ENABLE_DATE_WEATHER
+  cycleWeather();
+  #endif
   checkForWiFiStatusChange();
 }
 
@@ -83,45 +130,94 @@ void checkForWiFiStatusChange(){
 }
 
 void networkStartWiFi(){
+  //Starts an association attempt and returns right away - checkWiFi() will pick up the result
   WiFi.end(); //if AP is going, stop it
-  if(wssid==F("")) return; //don't try to connect if there's no creds
+  wifiRetryDelay = WIFI_RETRY_MIN; //fresh start, e.g. new creds
+  wifiBegin();
+} //end fn startWiFi
+
+void wifiBegin(){ //"private"
+  if(!wssid[0]){ wifiState = WIFI_OFF; return; } //don't try to connect if there's no creds
   checkForWiFiStatusChange(); //just for serial logging
-  //Serial.print(millis(),DEC); Serial.println(F("blank display per start wifi"));
-  blankDisplay(0,5,false); //I'm guessing if it hangs, nixies won't be able to display anyway
   //Serial.println(); Serial.print(millis()); Serial.print(F(" Attempting to connect to SSID: ")); Serial.println(wssid);
-  if(wki) WiFi.begin(wssid.c_str(), wki, wpass.c_str()); //WEP - hangs while connecting
-  else WiFi.begin(wssid.c_str(), wpass.c_str()); //WPA - hangs while connecting
-  if(WiFi.status()==WL_CONNECTED){ //did it work?
-    // Serial.print(millis()); Serial.println(F(" Connected!"));
-    // Serial.print(F("SSID: ")); Serial.println(WiFi.SSID());
-    // Serial.print(F("Signal strength (RSSI):")); Serial.print(WiFi.RSSI()); Serial.println(F(" dBm"));
-    // Serial.print(F("Access the admin page by browsing to http://")); Serial.println(WiFi.localIP());
-    server.begin(); Udp.begin(localPort); cueNTP(); //TODO a way to do this again if it doesn't sync the first time. Need to do asynchronously?
-  }
-  //else Serial.println(F(" Wasn't able to connect."));
-  updateDisplay();
+  if(wki) WiFi.begin(wssid, wki, wpass); //WEP - returns immediately per setTimeout(0) in initNetwork()
+  else WiFi.begin(wssid, wpass); //WPA
+  wifiState = WIFI_CONNECTING; wifiStateStart = millis();
+}
+
+void checkWiFi(){
+  //Called on every cycle to follow the connection along: finish connecting, notice drops, and retry with backoff
+  if(wifiState==WIFI_OFF || wifiState==WIFI_AP) return;
+  unsigned long now = millis();
+  if((unsigned long)(now-wifiPollLast)<WIFI_POLL_FREQ) return; //status is a round trip to the module, so don't ask every loop
+  wifiPollLast = now;
+  switch(wifiState){
+    case WIFI_CONNECTING:
+      if(WiFi.status()==WL_CONNECTED){ //did it work?
+        // Serial.print(millis()); Serial.println(F(" Connected!"));
+        // Serial.print(F("SSID: ")); Serial.println(WiFi.SSID());
+        // Serial.print(F("Signal strength (RSSI):")); Serial.print(WiFi.RSSI()); Serial.println(F(" dBm"));
+        // Serial.print(F("Access the admin page by browsing to http://")); Serial.println(WiFi.localIP());
+        wifiState = WIFI_CONNECTED; wifiStateStart = now; wifiConnects++;
+        wifiRetryDelay = WIFI_RETRY_MIN;
+        server.begin(); Udp.begin(localPort); cueNTP();
+        if(wifiAdminPending) networkStartAdmin(); //will display the IP
+      } else if(WiFi.status()==WL_CONNECT_FAILED || (unsigned long)(now-wifiStateStart)>=WIFI_CONNECT_TIMEOUT){
+        //Serial.print(millis()); Serial.println(F(" Wasn't able to connect."));
+        WiFi.end(); //stop the module from trying on its own, so we control the retry timing
+        wifiState = WIFI_RETRY; wifiStateStart = now;
+        if(wifiAdminPending) networkStartAdmin(); //will set up AP instead, which cancels the retry
+      }
+      break;
+    case WIFI_AP_STARTING:
+      if(WiFi.status()==WL_AP_LISTENING){
+        //Serial.print(F("SSID: ")); Serial.println(WiFi.SSID());
+        //by default the local IP address of will be 192.168.4.1 - override with WiFi.config(IPAddress(10, 0, 0, 1));
+        WiFi.config(IPAddress(7,7,7,7));
+        //Serial.print(F("Access the admin page by browsing to http://")); Serial.println(WiFi.localIP());
+        server.begin();
+        wifiState = WIFI_AP; wifiStateStart = now; //AP stays up until networkStopAdmin()
+      } else if((unsigned long)(now-wifiStateStart)>=WIFI_AP_TIMEOUT){
+        //Serial.println(F(" Wasn't able to create access point."));
+        networkStartAP(); //try again
+      }
+      break;
+    case WIFI_CONNECTED:
+      if(WiFi.status()!=WL_CONNECTED){ //dropped
+        //Serial.print(millis()); Serial.println(F(" Connection lost."));
+        wifiState = WIFI_RETRY; wifiStateStart = now; wifiDrops++;
+      }
+      break;
+    case WIFI_RETRY:
+      if((unsigned long)(now-wifiStateStart)>=wifiRetryDelay){
+        wifiRetryDelay = (wifiRetryDelay*2>WIFI_RETRY_MAX? WIFI_RETRY_MAX: wifiRetryDelay*2);
+        wifiBegin();
+      }
+      break;
+    default: break;
+  }
   checkForWiFiStatusChange(); //just for serial logging
-} //end fn startWiFi
+} //end fn checkWiFi
+
+bool wifiConnected(){
+  return wifiState==WIFI_CONNECTED;
+}
 
 void networkStartAP(){
   WiFi.end(); //if wifi is going, stop it
   checkForWiFiStatusChange(); //just for serial logging
   //Serial.println(); Serial.print(millis()); Serial.println(F(" Creating access point"));
-  if(WiFi.beginAP("Clock")==WL_AP_LISTENING){ //Change "beginAP" if you want to create an WEP network
-    //Serial.print(F("SSID: ")); Serial.println(WiFi.SSID());
-    //by default the local IP address of will be 192.168.4.1 - override with WiFi.config(IPAddress(10, 0, 0, 1));
-    WiFi.config(IPAddress(7,7,7,7));
-    //Serial.print(F("Access the admin page by browsing to http://")); Serial.println(WiFi.localIP());
-    //server.begin() was formerly here
-    server.begin();
-  }
-  //else Serial.println(F(" Wasn't able to create access point."));
+  //Per setTimeout(0) in initNetwork(), beginAP() returns before the module is listening, so its result says nothing -
+  //checkWiFi() finishes the setup once the module reports WL_AP_LISTENING
+  WiFi.beginAP("Clock"); //Change "beginAP" if you want to create an WEP network
+  wifiState = WIFI_AP_STARTING; wifiStateStart = millis(); wifiAdminPending = false;
   checkForWiFiStatusChange(); //just for serial logging
 } //end fn startAP
 
 void networkDisconnectWiFi(){
   //Serial.println(F("Disconnecting WiFi - will try to connect at next NTP sync time"));
   WiFi.end();
+  wifiState = WIFI_OFF;
 }
 
 bool ntpCued = false;
@@ -130,6 +226,9 @@ bool ntpGoing = 0;
 unsigned long ntpSyncLast = 0; //zero is a special value meaning it has never been used
 unsigned long ntpTime = 0; //When this is nonzero, it means we have captured a time and are waiting to set the clock until the next full second, in order to achieve subsecond setting precision (or close to - it'll be behind by up to the loop time, since we aren't simply using delay() in order to keep the nixie display going). TODO account for future epochs which could result in a valid 0 value
 unsigned  int ntpMils = 0;
+unsigned long ntpSyncCount = 0; //since boot, for metrics
+unsigned int ntpRTTLast = 0; //round trip of the last sync, ms
+long ntpOffsetLast = 0; //how far off the clock was when last set by NTP, sec (per the RTC's resolution) - positive if it was fast
 
 unsigned long ntpSyncAgo(){
   if(!ntpSyncLast || ntpTime) return 86400000; //if we haven't synced before, or are waiting for a set to apply TODO epoch issue
@@ -143,15 +242,15 @@ unsigned long ntpSyncAgo(){
 }
 
 void cueNTP(){
-  // We don't want to let other code startNTP() directly since it's normally asynchronous, and that other code may delay the time until we can check the result. Exception is forced call from admin page, which calls startNTP() synchronously.
+  // We don't want to let other code startNTP() directly since it's normally asynchronous, and that other code may delay the time until we can check the result. Exception is forced call from admin page, which calls startNTP() to get an error code, then waits on the result (see adminRespond()).
   if(readEEPROM(9,false)) ntpCued = true;
 }
 
-int startNTP(bool synchronous){ //Called at intervals to check for ntp time
-  //synchronous is for forced call from admin page, so we can return an error code, or 0 on successful sync
-  if(wssid==F("")) return -1; //don't try to connect if there's no creds
-  if(WiFi.status()!=WL_CONNECTED && WiFi.status()!=WL_AP_CONNECTED && WiFi.status()!=WL_AP_LISTENING) networkStartWiFi(); //in case the wifi dropped. Don't try if currently offering an access point.
-  if(WiFi.status()!=WL_CONNECTED) return -2;
+int startNTP(){ //Called at intervals to check for ntp time
+  //Returns 0 if a request was sent, or a negative error code (for forced call from admin page)
+  if(!wssid[0]) return -1; //don't try to connect if there's no creds
+  if(wifiState==WIFI_OFF || wifiState==WIFI_RETRY) wifiBegin(); //in case the wifi dropped, try now rather than waiting out the backoff. Don't try if currently offering an access point. This returns right away, so we'll report not connected; the sync is cued again upon connecting.
+  if(wifiState!=WIFI_CONNECTED) return -2;
   if(ntpGoing || ntpTime) return -3; //if request going, or waiting to set to apply TODO epoch issue
   if((unsigned long)(millis()-ntpStartLast) < NTP_MINFREQ) return -4; //if a previous request is going, do not start another until at least NTP_MINFREQ later
   //Serial.print(millis(),DEC); Serial.println(F("NTP starting"));
@@ -177,18 +276,12 @@ int startNTP(bool synchronous){ //Called at intervals to check for ntp time
   Udp.beginPacket(timeServer, 123); //NTP requests are to port 123
   Udp.write(packetBuffer, NTP_PACKET_SIZE);
   Udp.endPacket();
-  if(synchronous){
-    bool success = false;
-    while(!success && (unsigned long)(millis()-ntpStartLast)<NTP_TIMEOUT){
-      success = checkNTP(); //will return true when we successfully got a time to sync to
-    }
-    return (success? 0: -5);
-  }
-  checkNTP(); //asynchronous - may as well go ahead and check in case it comes back quickly enough
+  checkNTP(); //may as well go ahead and check in case it comes back quickly enough
+  return 0; //started
 } //end fn startNTP
 
 bool checkNTP(){ //Called on every cycle to see if there is an ntp response to handle
-  //Return whether we had a successful sync - used for forced call from admin page, via synchronous startNTP()
+  //Return whether we had a successful sync
   if(ntpGoing){
     //If we are waiting for a packet that hasn't arrived, wait for the next cycle, or time out
     if(!Udp.parsePacket()){
@@ -198,6 +291,7 @@ bool checkNTP(){ //Called on every cycle to see if there is an ntp response to h
     // We've received a packet, read the data from it
     ntpSyncLast = millis(); if(!ntpSyncLast) ntpSyncLast = -1; //never let it be zero
     unsigned int requestTime = ntpSyncLast-ntpStartLast;
+    ntpRTTLast = requestTime;
     Udp.read(packetBuffer, NTP_PACKET_SIZE); // read the packet into the buffer
   
     //https://forum.arduino.cc/index.php?topic=526792.0
@@ -233,7 +327,7 @@ bool checkNTP(){ //Called on every cycle to see if there is an ntp response to h
   }
   if(!ntpGoing){
     //If we are waiting to start, do it (asynchronously)
-    if(ntpCued){ startNTP(false); ntpCued=false; return false; }
+    if(ntpCued){ startNTP(); ntpCued=false; return false; }
     //If we are not waiting to set, do nothing
     if(!ntpTime) return false;
     //If we are waiting to set, but it's not time, wait for the next cycle
@@ -286,6 +380,11 @@ bool checkNTP(){ //Called on every cycle to see if there is an ntp response to h
       } else hm += 60;
     }
   
+    //note how far off the clock was (within half a day either way) before we correct it
+    ntpOffsetLast = (long)rtcGetHour()*3600+rtcGetMinute()*60+rtcGetSecond() - ((long)hm*60+s);
+    if(ntpOffsetLast>43200) ntpOffsetLast -= 86400; else if(ntpOffsetLast<-43200) ntpOffsetLast += 86400;
+    ntpSyncCount++;
+    
     //finally set the rtc
     rtcSetDate(y, m, d, dayOfWeek(y,m,d));
     rtcSetTime(hm/60,hm%60,s);
@@ -315,7 +414,9 @@ unsigned long adminInputLast = 0; //for noticing when the admin page hasn't been
 
 void networkStartAdmin(){
   adminInputLast = millis();
-  if(WiFi.status()!=WL_CONNECTED){
+  if(wifiState==WIFI_CONNECTING){ wifiAdminPending = true; return; } //checkWiFi() will call back once we know whether to show IP or start AP
+  wifiAdminPending = false;
+  if(wifiState!=WIFI_CONNECTED){
     networkStartAP();
     tempDisplay(7777); //display to user
     //Serial.println(F("Admin started at 7.7.7.7"));
@@ -330,581 +431,698 @@ void networkStartAdmin(){
 void networkStopAdmin(){
   //Serial.println(F("stopping admin"));
   adminInputLast = 0; //TODO use a different flag from adminInputLast
-  if(WiFi.status()!=WL_CONNECTED) networkStartWiFi();
+  if(wifiState==WIFI_AP || wifiState==WIFI_AP_STARTING) networkStartWiFi();
 }
 
 //unsigned long debugLast = 0;
-void checkClients(){
-  // if((unsigned long)(millis()-debugLast)>=1000) { debugLast = millis();
-  //   Serial.print("Hello ");
-  //   Serial.println(WiFi.status());
-  // }
-  //if(WiFi.status()!=WL_CONNECTED && WiFi.status()!=WL_AP_CONNECTED) return;
-  if(adminInputLast && (unsigned long)(millis()-adminInputLast)>=ADMIN_TIMEOUT) networkStopAdmin();
-  WiFiClient client = server.available();
-  if(client) {
-    if(adminInputLast==0) {
-      client.flush(); client.stop();
-      //Serial.print(F("Got a client but ditched it because last admin input was over ")); Serial.print(ADMIN_TIMEOUT); Serial.println(F("ms ago."));
-      return;
+bool sendAdminPage(HttpOut &out, HttpRequest *r){
+  //The page itself is static, gzipped in flash (see adminPage.h), so it can go out in a few large writes, and browsers
+  //can cache it - they'll revalidate with If-None-Match and get a 304 unless the firmware (and so the ETag) has changed.
+  //The values it displays come from sendAdminSettings().
+  //This writes the headers; returns whether the page itself should follow them.
+  if(!strcmp(r->ifNoneMatch,ADMIN_PAGE_ETAG)){
+    out.print(F("HTTP/1.1 304 Not Modified\r\nETag: " ADMIN_PAGE_ETAG "\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n"));
+    return false;
+  }
+  out.print(F("HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\nContent-Encoding: gzip\r\nContent-Length: "));
+  out.print(ADMIN_PAGE_LEN,DEC);
+  out.print(F("\r\nETag: " ADMIN_PAGE_ETAG "\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n"));
+  return true;
+}
+
+void sendAdminSettingValue(Print &out, char type, byte loc){ //"private"
+  //e.g. ,"b16":2 - same type/loc key as the page posts back
+  out.print(F(",\"")); out.print(type); out.print(loc,DEC); out.print(F("\":"));
+  out.print(readEEPROM(loc,type=='i'),DEC);
+}
+
+void sendAdminFlag(Print &out, const __FlashStringHelper *name, bool on){ //"private"
+  //e.g. ,"date":1 - left out if not on
+  if(on){ out.print(F(",\"")); out.print(name); out.print(F("\":1")); }
+}
+bool optApplies(byte loc){ //"private"
+  //Whether the settings menu entry at loc applies to this clock (or SHOW_IRRELEVANT_OPTIONS) - see opts.h
+  int opt = findOpt(loc);
+  return (opt>=0 && getOpt(opt).applies);
+}
+
+void sendAdminSettings(HttpOut &out){
+  //GET /settings - everything the admin page needs to fill itself in, as JSON: current values ("v", keyed by control id,
+  //which can be PATCHed back - see adminSet()), flags ("f") for which sections apply to this clock's hardware/config
+  //(per the settings schema and traits.h, as the settings menu goes by), and some read-only state.
+  out.begin(200,F("application/json"));
+  
+  out.print(F("{\"ver\":["));
+  for(byte i=0; i<4; i++){ if(i) out.print(','); out.print(getVersionPart(i),DEC); }
+  out.print(F("],\"timeout\":")); out.print(ADMIN_TIMEOUT,DEC);
+  if(hasSwitch){ out.print(F(",\"swdur\":")); out.print(SWITCH_DUR/60,DEC); }
+  out.print(F(",\"alarms\":")); out.print(ALARMS,DEC);
+  out.print(F(",\"alarmloc\":")); out.print(ALARM_LOC,DEC);
+  out.print(F(",\"state\":{\"up\":")); out.print(millis()/1000,DEC); //seconds - wraps after 49 days
+  out.print(F(",\"sec\":")); out.print(rtcGetSecond(),DEC);
+  out.print(F(",\"wifi\":")); out.print(wifiState,DEC); //see WIFI_ states
+  out.print(F(",\"rssi\":")); out.print(wifiState==WIFI_CONNECTED? WiFi.RSSI(): 0,DEC);
+  out.print(F(",\"heap\":")); out.print(heapPeak(),DEC); //bytes - see checkRAM()
+  out.print(F(",\"ram\":")); out.print(freeRAM(),DEC);
+  out.print(F(",\"ramlow\":")); out.print(ramFreeLow,DEC);
+  out.print('}');
+  out.print(F(",\"ntpago\":"));
+  if(ntpSyncLast) out.print((millis()-ntpSyncLast)/1000,DEC);
+  else out.print(ntpStartLast? F("-2"): F("-1")); //time set manually since last sync, or never synced
+  
+  out.print(F(",\"f\":{\"net\":1")); //network is a given, since this is being served
+  //Sections with settings in the menu go by those settings' schema (opts.h); the rest by the config or traits.h
+  sendAdminFlag(out,F("date"),optApplies(17)); //date format
+  sendAdminFlag(out,F("daycount"),SHOW_IRRELEVANT_OPTIONS || ENABLE_DATE_COUNTER);
+  sendAdminFlag(out,F("nixie"),optApplies(20)); //digit fade
+  sendAdminFlag(out,F("backlight"),optApplies(26)); //backlight behavior
+  sendAdminFlag(out,F("temp"),optApplies(45)); //temperature format
+  sendAdminFlag(out,F("alarm"),optApplies(24)); //snooze
+  sendAdminFlag(out,F("autoskip"),optApplies(23)); //alarm days
+  sendAdminFlag(out,F("sigsel"),SHOW_IRRELEVANT_OPTIONS || signalTypes>1);
+  sendAdminFlag(out,F("piezo"),SHOW_IRRELEVANT_OPTIONS || hasPiezo);
+  sendAdminFlag(out,F("fib"),optApplies(50)); //fibonacci mode
+  sendAdminFlag(out,F("timer"),SHOW_IRRELEVANT_OPTIONS || ENABLE_TIMER_FN);
+  sendAdminFlag(out,F("chime"),optApplies(21)); //strike
+  sendAdminFlag(out,F("chimesig"),optApplies(44)); //strike signal
+  sendAdminFlag(out,F("shutoff"),optApplies(27)); //night shutoff - away shutoff requires it
+  sendAdminFlag(out,F("night"),optApplies(27));
+  sendAdminFlag(out,F("away"),optApplies(32)); //away shutoff
+  sendAdminFlag(out,F("workweek"),optApplies(34)); //first day of workweek
+  sendAdminFlag(out,F("wwhdr"),optApplies(34) && !optApplies(32)); //alternative header if only workweek is needed
+  sendAdminFlag(out,F("riseset"),optApplies(10)); //latitude - riseset shows geography
+  //Which signal options to offer, regardless of SHOW_IRRELEVANT_OPTIONS
+  sendAdminFlag(out,F("piezopin"),signalOK(0));
+  sendAdminFlag(out,F("switchpin"),signalOK(1));
+  sendAdminFlag(out,F("pulsepin"),signalOK(2));
+  #ifdef OTA_KEY
+  out.print(F(",\"ota\":1"));
+  #endif
+  out.print('}');
+  
+  out.print(F(",\"v\":{\"wssid\":")); httpPrintJSON(out,wssid);
+  out.print(F(",\"wpass\":")); httpPrintJSON(out,wpass);
+  out.print(F(",\"wki\":")); out.print(wki,DEC);
+  out.print(F(",\"ntpip\":\""));
+  for(byte i=0; i<4; i++){ if(i) out.print('.'); out.print(readEEPROM(51+i,false),DEC); }
+  out.print(F("\",\"curtod\":")); out.print(rtcGetHour()*60+rtcGetMinute(),DEC);
+  out.print(F(",\"curdatey\":")); out.print(rtcGetYear(),DEC);
+  out.print(F(",\"curdatem\":")); out.print(rtcGetMonth(),DEC);
+  out.print(F(",\"curdated\":")); out.print(rtcGetDate(),DEC);
+  out.print(F(",\"alm\":")); out.print(getAlarmState(),DEC);
+  out.print(F(",\"almtime\":")); out.print(readEEPROM(0,true),DEC);
+  out.print(F(",\"runout\":")); out.print((getTimerState()>>2)&3,DEC); //00 stop, 01 repeat, 10 chrono, 11 chrono short signal
+  out.print(F(",\"nighttod\":")); out.print(readEEPROM(28,true),DEC);
+  out.print(F(",\"morntod\":")); out.print(readEEPROM(30,true),DEC);
+  out.print(F(",\"worktod\":")); out.print(readEEPROM(35,true),DEC);
+  out.print(F(",\"hometod\":")); out.print(readEEPROM(37,true),DEC);
+  //Settings menu, plus those set elsewhere: alarm 0's custom days, day counter, NTP sync, the other alarms
+  for(byte opt=0; opt<getOptCount(); opt++){
+    OptDef o = getOpt(opt);
+    if(o.applies) sendAdminSettingValue(out,(o.size==2?'i':'b'),o.loc); //the page hides those not sent
+  }
+  sendAdminSettingValue(out,'b',3);
+  for(byte loc=4; loc<=6; loc++) sendAdminSettingValue(out,'b',loc);
+  sendAdminSettingValue(out,'b',9);
+  for(byte a=1; a<ALARMS; a++) for(byte field=0; field<ALARM_SIZE; field++)
+    if(field!=AL_TIME+1) sendAdminSettingValue(out,(field==AL_TIME?'i':'b'),alarmLoc(a,field));
+  out.print(F("}}"));
+  out.end();
+}
+
+const __FlashStringHelper* adminSet(char *key, char *val, bool apply){
+  //Checks a value from the admin page or API, e.g. key "b16" val "2" (the same keys as sendAdminSettings() uses),
+  //and if apply, saves it. Storage writes are left uncommitted for adminSetAll(). Returns NULL if ok, or an error.
+  char *end;
+  long num = strtol(val,&end,10);
+  bool isNum = (end!=val && *end=='\0'); //plain integer - most keys require this
+  
+  if(!strcmp(key,"wssid") || !strcmp(key,"wpass")){
+    //Persistent storage - see wssid/wpass definitions above
+    bool isPass = (key[1]=='p');
+    byte loc = (isPass? 87: 55), len = (isPass? 64: 32);
+    if(strlen(val)>len) return (isPass? F("too long (max 64)"): F("too long (max 32)"));
+    if(!apply) return NULL;
+    strcpy((isPass? wpass: wssid),val);
+    byte vlen = strlen(val);
+    for(byte i=0; i<len; i++) adminStorageChanged |= writeEEPROM(loc+i,(i<vlen? val[i]: 0),false,false);
+    adminWiFiChanged = true;
+    return NULL;
+  }
+  if(!strcmp(key,"ntpip")){ //e.g. 192.168.1.255
+    byte ntpip[4];
+    if(!httpParseIP(val,ntpip)) return F("invalid format");
+    if(apply) for(byte i=0; i<4; i++) adminStorageChanged |= writeEEPROM(51+i,ntpip[i],false,false);
+    return NULL;
+  }
+  
+  //The rest are numeric. Find the range and (if applicable) storage loc.
+  if(!isNum) return F("not a number");
+  int loc = -1; bool isInt = false;
+  long mn = 0, mx = 1439; //time of day in minutes, by default
+  if(!strcmp(key,"wki")) mx = 4;
+  else if(!strcmp(key,"curtod")) {}
+  else if(!strcmp(key,"curdatey")){ mn = 2000; mx = 9999; }
+  else if(!strcmp(key,"curdatem")){ mn = 1; mx = 12; } //TODO what about month exceed
+  else if(!strcmp(key,"curdated")){ mn = 1; mx = 31; }
+  else if(!strcmp(key,"alm")) mx = 2; //two settings (alarm on, alarm skip) with one control. Compare to switchAlarmState()
+  else if(!strcmp(key,"runout")) mx = 3;
+  else if(!strcmp(key,"almtime")){ loc = 0; isInt = true; }
+  else if(!strcmp(key,"nighttod")){ loc = 28; isInt = true; }
+  else if(!strcmp(key,"morntod")){ loc = 30; isInt = true; }
+  else if(!strcmp(key,"worktod")){ loc = 35; isInt = true; }
+  else if(!strcmp(key,"hometod")){ loc = 37; isInt = true; }
+  else if((key[0]=='b' || key[0]=='i') && key[1]>='0' && key[1]<='9'){
+    //standard eeprom saves by type/loc, e.g. b17=2 or i28=1320
+    loc = strtol(key+1,&end,10);
+    isInt = (key[0]=='i'); //or b for byte
+    if(*end!='\0') return F("unknown setting");
+    int opt = findOpt(loc);
+    if(opt>=0){ //settings menu - per its schema (opts.h)
+      OptDef o = getOpt(opt);
+      if(isInt!=(o.size==2)) return F("unknown setting"); //wrong type
+      if(!o.applies) return F("not available on this clock");
+      mn = o.min; mx = o.max;
+    }
+    else if(loc>=ALARM_LOC && loc<ALARM_LOC+(ALARMS-1)*ALARM_SIZE){ //the other alarms - per their schema (opts.h)
+      byte field = (loc-ALARM_LOC)%ALARM_SIZE;
+      OptDef o = getAlarmOpt(field);
+      if(field==AL_TIME+1 || isInt!=(o.size==2)) return F("unknown setting");
+      mn = o.min; mx = o.max;
     }
+    else if(!isInt && loc==3){ mn = 1; mx = 127; } //the rest are set outside the menu
+    else if(!isInt && loc==4) mx = 2;
+    else if(!isInt && loc==5){ mn = 1; mx = 12; }
+    else if(!isInt && loc==6){ mn = 1; mx = 31; }
+    else if(!isInt && loc==9) mx = 1;
+    else return F("unknown setting");
+  }
+  else return F("unknown setting");
+  if(num<mn || num>mx) return F("out of range");
+  if(!apply) return NULL;
+  
+  if(loc>=0) adminStorageChanged |= writeEEPROM(loc,num,isInt,false);
+  if(!strcmp(key,"wki")){ wki = num; adminStorageChanged |= writeEEPROM(151,wki,false,false); adminWiFiChanged = true; }
+  else if(!strcmp(key,"curtod")){ rtcSetTime(num/60,num%60,0); ntpSyncLast = 0; goToFn(FN_TOD); }
+  else if(!strcmp(key,"curdatey")){ rtcSetDate(num, rtcGetMonth(), rtcGetDate(), dayOfWeek(num, rtcGetMonth(), rtcGetDate())); ntpSyncLast = 0; goToFn(FN_CAL,254); }
+  else if(!strcmp(key,"curdatem")){ rtcSetDate(rtcGetYear(), num, rtcGetDate(), dayOfWeek(rtcGetYear(), num, rtcGetDate())); goToFn(FN_CAL,254); }
+  else if(!strcmp(key,"curdated")){ rtcSetDate(rtcGetYear(), rtcGetMonth(), num, dayOfWeek(rtcGetYear(), rtcGetMonth(), num)); goToFn(FN_CAL,254); }
+  else if(!strcmp(key,"alm")){ setAlarmState(num); goToFn(FN_ALARM); }
+  else if(!strcmp(key,"almtime")) goToFn(FN_ALARM);
+  else if(!strcmp(key,"runout")){
+    setTimerState(3,num/2); //chrono bit
+    setTimerState(2,num%2); //restart bit
+  }
+  else switch(loc){ //do special stuff for some of the standard ones
+    case 4: case 5: case 6: //day counter
+      //in lieu of actually switching to FN_CAL, so that only this value is seen - compare to ino
+      if(readEEPROM(4,false)) tempDisplay(dateComp(rtcGetYear(),rtcGetMonth(),rtcGetDate(), readEEPROM(5,false),readEEPROM(6,false),readEEPROM(4,false)-1));
+      findFnAndPageNumbers(); //to include or exclude the day counter from the calendar function
+      break;
+    case 14: //utc offset
+      cueNTP(); break;
+    case 17: //date format
+      goToFn(FN_CAL,254); break;
+    case 22: //auto dst
+      isDSTByHour(rtcGetYear(),rtcGetMonth(),rtcGetDate(),rtcGetHour(),true); break;
+    case 39: case 47: //alarm pitch/pattern
+      goToFn(FN_ALARM); break;
+    case 40: case 48: //timer pitch/pattern
+      goToFn(FN_TIMER); break;
+    case 41: case 49: //strike pitch/pattern
+      goToFn(FN_TOD); break;
+    default: break;
+  }
+  if(loc==39 || loc==40 || loc==41){ //play beeper pitch sample - compare to updateDisplay()
+    quickBeep(num);
+  }
+  if(loc==47 || loc==48 || loc==49){ //play beeper pattern sample - compare to updateDisplay()
+    quickBeepPattern((loc==49?FN_TOD:(loc==48?FN_TIMER:FN_ALARM)),num);
+  }
+  if(loc>=ALARM_LOC && loc<ALARM_LOC+(ALARMS-1)*ALARM_SIZE){ //likewise for the other alarms
+    byte field = (loc-ALARM_LOC)%ALARM_SIZE;
+    if(field==AL_PITCH) quickBeep(num);
+    if(field==AL_PATTERN) quickBeepPattern(FN_ALARM,num,(loc-ALARM_LOC)/ALARM_SIZE+1);
+  }
+  return NULL;
+}
+
+const __FlashStringHelper* adminSetAll(char **keys, char **vals, byte count, byte *bad){
+  //Checks all the given values before applying any, so a request is applied entirely or not at all,
+  //then commits storage once for the lot. Returns NULL if ok, or an error, with *bad the index of the offending key.
+  if(!count) return F("empty request");
+  for(byte i=0; i<count; i++){
+    const __FlashStringHelper *err = adminSet(keys[i],vals[i],false);
+    if(err){ *bad = i; return err; }
+  }
+  adminStorageChanged = false;
+  for(byte i=0; i<count; i++) adminSet(keys[i],vals[i],true);
+  if(adminStorageChanged) commitEEPROM();
+  updateDisplay();
+  return NULL;
+}
+
+void adminSyncResult(HttpOut &out, int ntpCode){ //"private"
+  //Response to POST syncnow, per startNTP() or the sync it started
+  out.begin(200,F("text/plain"));
+  switch(ntpCode){
+    case -1: out.print(F("Error: no Wi-Fi credentials.")); break;
+    case -2: out.print(F("Error: not connected to Wi-Fi.")); break;
+    case -3: out.print(F("Error: NTP response pending. Please try again shortly.")); break;
+    case -4: out.print(F("Error: too many sync requests in the last ")); out.print(NTP_MINFREQ/1000,DEC); out.print(F(" seconds. Please try again shortly.")); break;
+    case -5: out.print(F("Error: no NTP response received. Please confirm server.")); break;
+    case 0: out.print(F("synced")); break;
+    default: out.print(F("Error: unhandled NTP code")); break;
+  }
+  out.end();
+}
+
+bool adminPost(HttpOut &out, HttpRequest *r){
+  //Handles what was POSTed, e.g. b16=2, or wssid=Home&wpass=qwertyuiop&wki=0 from the Wi-Fi form.
+  //Response is "ok" (or "synced"), or an error message for the page to display.
+  //Returns false if this is a sync request that has started, in which case adminRespond() will call adminSyncResult() when done.
+  char *keys[ADMIN_SET_MAX], *vals[ADMIN_SET_MAX];
+  byte count = 0;
+  while(count<ADMIN_SET_MAX && httpFormNext(r,&keys[count],&vals[count])) count++;
+  if(count==1 && !strcmp(keys[0],"syncnow")){
+    int ntpCode = startNTP();
+    if(ntpCode==0) return false;
+    adminSyncResult(out,ntpCode);
+    return true;
+  }
+  byte bad = 0;
+  const __FlashStringHelper *err = adminSetAll(keys,vals,count,&bad);
+  out.begin(200,F("text/plain"));
+  if(err){ out.print(F("Error: ")); if(count){ out.print(keys[bad]); out.print(F(": ")); } out.print(err); }
+  else out.print(F("ok"));
+  out.end();
+  return true;
+}
+
+void adminPatch(HttpOut &out, HttpRequest *r){
+  //Handles what was PATCHed - a JSON object of any of the values from GET /settings, e.g. {"b16":2,"b17":3}
+  char *keys[ADMIN_SET_MAX], *vals[ADMIN_SET_MAX];
+  byte count = 0, bad = 0;
+  char more = 1;
+  while(count<ADMIN_SET_MAX && (more = httpJSONNext(r,&keys[count],&vals[count]))==1) count++;
+  if(more==1){ char *key, *val; more = httpJSONNext(r,&key,&val); } //at the limit - is that the end?
+  const __FlashStringHelper *err = (more<0? F("malformed JSON"): (more>0? F("too many settings"): adminSetAll(keys,vals,count,&bad)));
+  out.begin(err? 400: 200,F("application/json"));
+  if(err){
+    out.print(F("{\"error\":\""));
+    if(more==0 && count){ out.print(keys[bad]); out.print(F(": ")); } //keys are ours, so no need to escape
+    out.print(err); out.print(F("\"}"));
+  }
+  else out.print(F("{\"ok\":true}"));
+  out.end();
+}
+
+extern "C" char* sbrk(int incr);
+extern "C" char __end__; //start of the heap, per the linker script
+int freeRAM(){ //"private"
+  //Space between the top of the heap and the bottom of the stack
+  char top;
+  return &top - sbrk(0);
+}
+int heapPeak(){ //"private"
+  //How far the heap has ever reached - the heap only grows, as freed blocks are reused rather than given back.
+  //If this creeps up over weeks of uptime, something is leaking, or fragmenting it.
+  return sbrk(0) - &__end__;
+}
+void checkRAM(){ //"private"
+  //Tracks the least free RAM seen, for the admin page and metrics. Called on each network cycle.
+  int f = freeRAM();
+  if(f<ramFreeLow) ramFreeLow = f;
+}
+
+void sendMetric(HttpOut &out, const __FlashStringHelper *name, const __FlashStringHelper *type, long val, bool milli){ //"private"
+  //e.g. # TYPE clock_uptime_seconds gauge, then clock_uptime_seconds 1234. If milli, val is in thousandths, e.g. ms as seconds.
+  //Lines end in \n only, as Prometheus expects, so no println()
+  out.print(F("# TYPE clock_")); out.print(name); out.print(' '); out.print(type);
+  out.print(F("\nclock_")); out.print(name); out.print(' ');
+  if(milli){
+    if(val<0){ out.print('-'); val = -val; }
+    out.print(val/1000,DEC); out.print('.');
+    if(val%1000<100) out.print('0');
+    if(val%1000<10) out.print('0');
+    out.print(val%1000,DEC);
+  }
+  else out.print(val,DEC);
+  out.print('\n');
+}
+
+void sendMetrics(HttpOut &out){
+  //GET /metrics - counters for fleet monitoring, in Prometheus text format. Served even when admin isn't active, since it's read-only.
+  //Times are in seconds, per Prometheus convention. Counters (_total) are since boot.
+  out.begin(200,F("text/plain; version=0.0.4"));
+  sendMetric(out,F("uptime_seconds"),F("gauge"),getUptime());
+  sendMetric(out,F("loops_per_second"),F("gauge"),getLoopRate());
+  sendMetric(out,F("loop_stall_max_seconds"),F("gauge"),getLoopStallMax(),true); //longest loop in the last minute or two
+  sendMetric(out,F("free_ram_bytes"),F("gauge"),freeRAM());
+  sendMetric(out,F("free_ram_min_bytes"),F("gauge"),ramFreeLow);
+  sendMetric(out,F("heap_peak_bytes"),F("gauge"),heapPeak());
+  sendMetric(out,F("flash_commits_total"),F("counter"),getCommitCount());
+  sendMetric(out,F("storage_rejected_total"),F("counter"),getStorageRejects());
+  sendMetric(out,F("wifi_connects_total"),F("counter"),wifiConnects);
+  sendMetric(out,F("wifi_drops_total"),F("counter"),wifiDrops);
+  if(wifiState==WIFI_CONNECTED) sendMetric(out,F("wifi_rssi_dbm"),F("gauge"),WiFi.RSSI());
+  sendMetric(out,F("ntp_syncs_total"),F("counter"),ntpSyncCount);
+  if(ntpSyncCount){ //these are meaningless until the first sync
+    sendMetric(out,F("ntp_sync_age_seconds"),F("gauge"),ntpSyncAgo()/1000);
+    sendMetric(out,F("ntp_offset_seconds"),F("gauge"),ntpOffsetLast);
+    sendMetric(out,F("ntp_rtt_seconds"),F("gauge"),ntpRTTLast,true);
+  }
+  //Low-power idle residency (see power.cpp) - duty cycle is the loop's, as a fraction
+  sendMetric(out,F("power_sleep_seconds_total"),F("counter"),getPowerSleepSecs());
+  sendMetric(out,F("power_awake_seconds_total"),F("counter"),getPowerAwakeSecs());
+  sendMetric(out,F("power_duty_cycle"),F("gauge"),getPowerDuty(),true);
+  sendMetric(out,F("power_wakeups_total"),F("counter"),getPowerWakes());
+  sendMetric(out,F("power_wakeups_per_hour"),F("gauge"),getPowerWakeRate());
+  sendMetric(out,F("power_input_wakeups_total"),F("counter"),getPowerInputWakes());
+  out.print(F("# TYPE clock_signals_total counter\n"));
+  out.print(F("clock_signals_total{source=\"chime\"} ")); out.print(getSignalCount(FN_TOD),DEC); out.print('\n');
+  out.print(F("clock_signals_total{source=\"alarm\"} ")); out.print(getSignalCount(FN_ALARM),DEC); out.print('\n');
+  out.print(F("clock_signals_total{source=\"timer\"} ")); out.print(getSignalCount(FN_TIMER),DEC); out.print('\n');
+  out.end();
+}
+
+//Admin clients are served in sessions, a slice at a time on each cycle, so the clock keeps running while they're served.
+//Each one reads a request, waits its turn to build a response in adminOut, sends it, then waits for the client to close.
+#define ADMIN_SESSIONS 4 //clients served at once - a browser may open a few connections
+#define ADMIN_OUT_MAX 2048 //response buffer, used by one session at a time - enough for GET /settings
+#define NETWORK_RAM_BUDGET 8192 //most RAM the buffers here may take, of the Nano 33 IoT's 32K - checked at compile time below
+#define SESSION_SLICE 1024 //most bytes sent to a client per cycle
+#define SESSION_TIMEOUT 5000 //drop a client that takes longer than this to send its request
+#define SESSION_CLOSE_WAIT 2000 //after responding, give the client this long to hang up before we do
+//Session states
+#define SESSION_FREE 0
+#define SESSION_READ 1 //reading the request
+#define SESSION_READY 2 //request complete, waiting for adminOut
+#define SESSION_SYNC 3 //POST syncnow, waiting for the NTP sync it started
+#define SESSION_WRITE 4 //sending the response
+#define SESSION_LINGER 5 //response sent, waiting for the client to hang up
+#define SESSION_STREAM 6 //headers sent for GET /events - sending display changes until the client hangs up
+#define SESSION_UPLOAD 7 //POST /update - writing the body to flash as it arrives
+#define UPLOAD_SLICE 512 //most bytes read from the uploading client per cycle
+#define EVENTS_MAX 2 //most sessions that may stream at once, so there's always room for the settings page
+#define EVENTS_INTERVAL 100 //least time between events to a client, ms - caps it at 10/sec however fast the display changes
+#define EVENTS_KEEPALIVE 15000 //if nothing has changed in this long, send a comment, to find out if the client is still there
+#define MIRROR_SIZE 11 //display state sent to clients: 6 digits, dim, fn, fnPg, fnSetPg, signal
+const char mirrorKeys[] PROGMEM = "dim fn pg set sig"; //event keys for the mirror past the digits, in order
+struct AdminSession {
+  WiFiClient client;
+  byte state;
+  unsigned long stateStart; //for timeouts
+  HttpRequest req;
+  word outLen; //response length in adminOut (the headers, for the page)...
+  const byte *blob; //...followed by this much from flash (the page), if any
+  word blobLen;
+  word outPos; //progress through both
+  bool stream; //after sending, stream events instead of closing
+  byte mirror[MIRROR_SIZE]; //display state the stream client has last been sent
+  unsigned long sentLast; //when it was last sent anything
+  int status; //result of POST /update, for adminRespond()
+};
+AdminSession sessions[ADMIN_SESSIONS];
+byte adminOut[ADMIN_OUT_MAX];
+//Everything network.cpp holds is fixed-size, so its RAM use is known up front - if ADMIN_SESSIONS, ADMIN_OUT_MAX, or the
+//HTTP_*_MAX sizes (see http.h) are raised, make sure there's still room for the stack and the rest of the clock.
+static_assert(sizeof(sessions)+sizeof(adminOut)+sizeof(packetBuffer)+sizeof(wssid)+sizeof(wpass)<=NETWORK_RAM_BUDGET,
+  "network buffers exceed NETWORK_RAM_BUDGET");
+byte adminOutOwner = 255; //session whose response is in adminOut, or 255 if free
+byte otaSession = 255; //session doing POST /update, if any - only one at a time
+
+void getMirror(byte *m){ //"private"
+  //Snapshot of what the display is showing, for the event stream - see sendEvent()
+  for(byte i=0; i<6; i++) m[i] = getDisplayDigit(i);
+  m[6] = getDisplayDim(); m[7] = getFn(); m[8] = getFnPg(); m[9] = getFnSetPg();
+  m[10] = getSignalActive()+1; //0 if none
+}
+
+bool sendEvent(byte s){
+  //GET /events - sends session s whatever has changed on the display since its last event, as a Server-Sent Event, e.g.
+  //data: {"d":"1234 5"} when a digit changes ("d" is the digits left to right, space for blank). The first event has everything:
+  //data: {"n":6,"d":"123456","dim":2,"fn":0,"pg":0,"set":0,"sig":-1} - n is the number of digits, sig the signal source or -1.
+  //The admin page uses this to draw a copy of the display. Returns false if the client has gone away.
+  AdminSession *x = &sessions[s];
+  byte m[MIRROR_SIZE];
+  getMirror(m);
+  bool first = (x->mirror[0]==255);
+  char buf[96];
+  HttpOut out((byte*)buf,sizeof(buf)); //not using begin()/end() - this just gathers the event for a single write
+  out.print(F("data: {"));
+  if(first){ out.print(F("\"n\":")); out.print(DISPLAY_SIZE,DEC); }
+  if(first || memcmp(m,x->mirror,6)){
+    if(first) out.print(',');
+    out.print(F("\"d\":\""));
+    for(byte i=0; i<6; i++) out.print((char)(m[i]<10? '0'+m[i]: ' '));
+    out.print('"');
+  }
+  const char *key = mirrorKeys;
+  for(byte i=6; i<MIRROR_SIZE; i++, key++){ //key++ past the space
+    const char *c = key;
+    while(pgm_read_byte(key) && pgm_read_byte(key)!=' ') key++;
+    if(!first && m[i]==x->mirror[i]) continue;
+    if(out.length()>7) out.print(','); //past data: {
+    out.print('"'); for(; c<key; c++) out.print((char)pgm_read_byte(c)); out.print(F("\":"));
+    out.print((i==10? (int)m[i]-1: (int)m[i]),DEC);
+  }
+  if(out.length()<=7){ //nothing changed
+    if((unsigned long)(millis()-x->sentLast)<EVENTS_KEEPALIVE) return true;
+    x->sentLast = millis();
+    return x->client.write((const byte*)":\n\n",3)>0;
+  }
+  out.print(F("}\n\n"));
+  memcpy(x->mirror,m,MIRROR_SIZE);
+  x->sentLast = millis();
+  return x->client.write((byte*)buf,out.length())>0;
+}
+
+void adminSessionState(byte s, byte state){ //"private"
+  sessions[s].state = state;
+  sessions[s].stateStart = millis();
+}
+void adminSessionClose(byte s){ //"private"
+  sessions[s].client.stop();
+  sessions[s].state = SESSION_FREE;
+  if(adminOutOwner==s) adminOutOwner = 255;
+  #ifdef OTA_KEY
+  if(otaSession==s){ //the client has its response (or has gone away)
+    otaSession = 255;
+    if(otaStaged()) otaApply(); //restarts into the new firmware
+    else otaAbort();
+  }
+  #endif
+}
+
+#ifdef OTA_KEY
+bool adminUploadStart(byte s, const byte *buf, int len){ //"private"
+  //POST /update, with a new sketch (the .bin) as the body, Authorization: Bearer <OTA_KEY per config>, and its CRC-32
+  //as X-CRC32: <hex> - e.g. curl --data-binary @arduino-clock.bin -H "Authorization: Bearer $KEY" -H "X-CRC32: $(crc32 arduino-clock.bin)"
+  //If it can go ahead, starts writing it to flash, with buf as the first part of it, and returns true.
+  //Returns false if it's not an update (413) or can't go ahead (status per session).
+  AdminSession *x = &sessions[s];
+  HttpRequest *r = &x->req;
+  if(r->method!=HTTP_POST || strcmp(r->path,"/update")) return false;
+  if(!otaKeyOk(r->auth)) x->status = 401;
+  else if(!r->hasCRC) x->status = 400;
+  else if(otaSession!=255) x->status = 409;
+  else if(!otaBegin(r->contentLength)) x->status = 413;
+  else {
+    otaSession = s;
+    otaWrite(buf,len);
+    return true;
+  }
+  return false;
+}
+#endif
+
+bool adminRespond(byte s){
+  //Builds the response to session s's request in adminOut, and sets the session to send it.
+  //Returns false if it isn't ready to respond yet (waiting on a sync).
+  AdminSession *x = &sessions[s];
+  HttpRequest *r = &x->req;
+  HttpOut out(adminOut,ADMIN_OUT_MAX);
+  x->blob = NULL; x->blobLen = 0; x->stream = false;
+  bool upload = (r->state==HTTP_ST_STREAM); //a body we didn't buffer - only POST /update, which doesn't require admin either
+  bool metrics = (r->state==HTTP_ST_DONE && r->method==HTTP_GET && !strcmp(r->path,"/metrics")); //doesn't require or extend admin
+  bool events = (r->state==HTTP_ST_DONE && r->method==HTTP_GET && !strcmp(r->path,"/events")); //likewise
+  #ifdef INPUT_TRACE
+  bool trace = (r->state==HTTP_ST_DONE && r->method==HTTP_GET && !strcmp(r->path,"/trace")); //likewise
+  #else
+  bool trace = false;
+  #endif
+  #ifdef PIN_TRACE
+  bool pintrace = (r->state==HTTP_ST_DONE && r->method==HTTP_GET && !strcmp(r->path,"/pintrace")); //likewise
+  #else
+  bool pintrace = false;
+  #endif
+  if(upload){
+    if(!x->status) x->status = 413; //not an update, or updates aren't enabled
+    out.begin(x->status,F("text/plain"));
+    if(x->status==200) out.print(F("Update received. Restarting."));
+    else if(x->status==400) out.print(F("Missing or mismatched X-CRC32. Firmware not changed."));
+    else out.print(httpReason(x->status));
+    out.end();
+  }
+  else if(metrics) sendMetrics(out);
+  #ifdef INPUT_TRACE
+  else if(trace){ out.begin(200,F("application/octet-stream")); traceDump(out); out.end(); }
+  #endif
+  #ifdef PIN_TRACE
+  else if(pintrace){ out.begin(200,F("application/octet-stream")); pinTraceDump(out); out.end(); }
+  #endif
+  else if(events){
+    byte streams = 0;
+    for(byte i=0; i<ADMIN_SESSIONS; i++) if(sessions[i].state!=SESSION_FREE && sessions[i].stream) streams++;
+    if(streams>=EVENTS_MAX){ out.begin(503,F("text/plain")); out.print(httpReason(503)); out.end(); }
     else {
-      //Serial.print(F("Last admin input was ")); Serial.print(millis()-adminInputLast); Serial.print(F("ms ago which is under the limit of ")); Serial.print(ADMIN_TIMEOUT); Serial.println(F("ms."));
+      //No Content-Length - the stream goes until the client hangs up
+      out.print(F("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\nretry: 5000\n\n"));
+      x->stream = true;
+      x->mirror[0] = 255; //so the first event will have everything
     }
-    
-    adminInputLast = millis();
-    
-    String currentLine = ""; //we'll read the data from the client one line at a time
-    int requestType = 0;
-    bool newlineSeen = false;
-
-    if(client.connected()){
-      while(client.available()){ //if there's bytes to read from the client
-        char c = client.read();
-        //Serial.write(c); //DEBUG
-        
-        if(c=='\n') newlineSeen = true;
-        else {
-          if(newlineSeen){ currentLine = ""; newlineSeen = false; } //if we see a newline and then something else: clear current line
-          currentLine += c;
-        }
-
-        //Find the request type and path from the first line.
-        if(!requestType){
-          if(currentLine=="GET / ") { requestType = 1; break; } //Read no more. We'll render out the page.
-          if(currentLine=="POST / ") requestType = 2; //We'll keep reading til the last line.
-          if(c=='\n') break; //End of first line without matching the above: invalid request, return nothing.
-        }
-        
-      } //end whie client available
-    } //end if client connected
-    
-    if(requestType){
-      // HTTP headers always start with a response code (e.g. HTTP/1.1 200 OK)
-      // and a content-type so the client knows what's coming, then a blank line:
-      client.println("HTTP/1.1 200 OK");
-      client.println("Content-type:text/html");
-      client.println("Access-Control-Allow-Origin:*");
-      client.println();
-      if(requestType==1){ //get
-        
-        //Re hiding irrelevant settings/options, see also fnOptScroll in main code
-        
-        client.print(F("<!DOCTYPE html><html><head><title>Clock Settings</title><style>body { background-color: #eee; color: #222; font-family: system-ui, -apple-system, sans-serif; font-size: 18px; line-height: 1.3em; margin: 1.5em; position: absolute; } a { color: #33a; } ul { padding-left: 9em; text-indent: -9em; list-style: none; margin-bottom: 4em; } ul li { margin-bottom: 0.8em; } ul li * { text-indent: 0; padding: 0; } ul li label:first-child { display: inline-block; width: 8em; text-align: right; padding-right: 1em; font-weight: bold; } ul li.nolabel { margin-left: 9em; } ul li h3 { display: inline-block; margin: 1em 0 0; } input[type='text'],input[type='number'],input[type='submit'],select { border: 1px solid #999; margin: 0.2em 0; padding: 0.1em 0.3em; font-size: 1em; font-family: system-ui, -apple-system, sans-serif; } @media only screen and (max-width: 550px) { ul { padding-left: 0; text-indent: 0; } ul li label:first-child { display: block; width: auto; text-align: left; padding: 0; } ul li.nolabel { margin-left: 0; }} .saving { color: #66d; } .ok { color: #3a3; } .error { color: #c53; } .explain { font-size: 0.85em; line-height: 1.3em; color: #666; } @media (prefers-color-scheme: dark) { body { background-color: #222; color: #ddd; } a { color: white; } #result { background-color: #373; color: white; } input[type='text'],input[type='number'],select { background-color: black; color: #ddd; } .explain { color: #999; } }</style><meta charset='utf-8'><meta name='viewport' content='width=device-width, initial-scale=1'></head><body><h2 style='margin-top: 0;'>Clock Settings</h2><p id='loading'>Loading&hellip;<br/><br/>If page doesn't appear in a few seconds, <a href=\"#\" onclick=\"location.reload(); return false;\">refresh</a>.</p><div id='content' style='display: none;'><ul>"));
-        
-        client.print(F("<li><h3>General</h3></li>"));
-        
-        client.print(F("<li><label>Version</label>")); //TODO upload new built version?
-          client.print(getVersionPart(0),DEC);
-          client.print(F("."));
-          client.print(getVersionPart(1),DEC);
-          client.print(F("."));
-          client.print(getVersionPart(2),DEC);
-          if(getVersionPart(3)) //don't link directly to anything, just the project
-            client.print(F("-dev (<a href='https://github.com/clockspot/arduino-clock' target='_blank'>details</a>)"));
-          else { //link directly to the release of this version
-            client.print(F(" (<a href='https://github.com/clockspot/arduino-clock/releases/tag/v")); //TODO needs fix after rename
-            client.print(getVersionPart(0),DEC);
-            client.print(F("."));
-            client.print(getVersionPart(1),DEC);
-            client.print(F("."));
-            client.print(getVersionPart(2),DEC);
-            client.print(F("' target='_blank'>details</a>)"));
-          }
-          client.print(F("</li>"));
-        
-        //Wi-Fi, NTP, and UTC offset are always relevant given network
-        client.print(F("<li><label>Wi-Fi</label><form id='wform' style='display: inline;' onsubmit='save(this); return false;'><select id='wtype' onchange='wformchg()'><option value=''>None</option><option value='wpa'>WPA</option><option value='wep'>WEP</option></select><span id='wa'><br/><input type='text' id='wssid' name='wssid' placeholder='SSID (Network Name)' autocomplete='off' onchange='wformchg()' onkeyup='wformchg()' value='")); String wssid2 = wssid; wssid2.replace("'","&#39;"); client.print(wssid2); client.print(F("' /><br/><input type='text' id='wpass' name='wpass' placeholder='Password/Key' autocomplete='off' onchange='wformchg()' onkeyup='wformchg()' value='")); String wpass2 = wpass; wpass2.replace("'","&#39;"); client.print(wpass2); client.print(F("' /></span><span id='wb'><br/><label for='wki'>Key Index</label> <select id='wki' onchange='wformchg()'>")); for(char i=0; i<=4; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("' ")); client.print(wki==i?F("selected"):F("")); client.print(F(">")); if(i==0) client.print(F("Select")); else client.print(i,DEC); client.print(F("</option>")); } client.print(F("</select></span><br/><input id='wformsubmit' type='submit' value='Save' style='display: none;' /></form></li>"));
-        
-        client.print(F("<li><label>NTP sync</label><select id='b9' onchange='if(this.value==0){ document.getElementById(\"ntpsyncdeets\").style.display=\"none\"; document.getElementById(\"ntpserverli\").style.display=\"none\"; } else { document.getElementById(\"ntpsyncdeets\").style.display=\"inline\"; document.getElementById(\"ntpserverli\").style.display=\"block\"; } save(this)'>")); for(char i=0; i<=1; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(9,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Off")); break;
-          case 1: client.print(F("On (every hour at minute 59)")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/>"));
-          client.print(F("<span id='ntpsyncdeets' style='display: ")); if(readEEPROM(9,false)==0) client.print(F("none")); else client.print(F("inline")); client.print(F(";'><span id='lastsync'>"));
-          if(ntpSyncLast){
-            client.print(F("Last sync as of page load time: "));
-            unsigned long ntpSyncDiff = (millis()-ntpSyncLast)/1000;
-            if(ntpSyncDiff<60){ client.print(ntpSyncDiff,DEC); client.print(F(" second(s) ago")); }
-            else if(ntpSyncDiff<3600){ client.print(ntpSyncDiff/60,DEC); client.print(F(" minute(s) ago")); }
-            else if(ntpSyncDiff<86400){ client.print(ntpSyncDiff/3600,DEC); client.print(F(" hour(s) ago")); }
-            else { client.print(F(" over 24 hours ago")); }
-          } else {
-            if(ntpStartLast) client.print(F("No sync since time was set manually"));
-            else client.print(F("Never synced"));
-          }
-          client.print(F("<br/></span><a id='syncnow' value='' href='#' onclick='document.getElementById(\"lastsync\").innerHTML=\"\"; save(this); return false;'>Sync&nbsp;now</a><br/></span><span class='explain'>Requires Wi-Fi. If using this, be sure to set your <a href='#utcoffset'>UTC offset</a> and <a href='#autodst'>auto DST</a> below.</span></li>"));
-          
-        client.print(F("<li id='ntpserverli' style='display: ")); if(readEEPROM(9,false)==0) client.print(F("none")); else client.print(F("block")); client.print(F(";'><label>NTP server</label><input type='text' id='ntpip' onchange='promptsave(\"ntpip\")' onkeyup='promptsave(\"ntpip\")' onblur='unpromptsave(\"ntpip\"); save(this)' value='")); client.print(readEEPROM(51,false),DEC); client.print(F(".")); client.print(readEEPROM(52,false),DEC); client.print(F(".")); client.print(readEEPROM(53,false),DEC); client.print(F(".")); client.print(readEEPROM(54,false),DEC); client.print(F("' />")); client.print(F(" <a id='ntpipsave' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'><a href='https://en.wikipedia.org/wiki/IPv4#Addressing' target='_blank'>IPv4</a> address, e.g. one of <a href='https://tf.nist.gov/tf-cgi/servers.cgi' target='_blank'>NIST's time servers</a></span></li>"));
-        
-        client.print(F("<li><label>Current time</label><input type='number' id='curtodh' onchange='promptsave(\"curtod\")' onkeyup='promptsave(\"curtod\")' onblur='unpromptsave(\"curtod\"); savetod(\"curtod\")' min='0' max='23' step='1' value='")); client.print(rtcGetHour(),DEC); client.print(F("' />&nbsp;:&nbsp;<input type='number' id='curtodm' onchange='promptsave(\"curtod\")' onkeyup='promptsave(\"curtod\")' onblur='unpromptsave(\"curtod\"); savetod(\"curtod\")' min='0' max='59' step='1' value='")); client.print(rtcGetMinute(),DEC); client.print(F("' /><input type='hidden' id='curtod' /> <a id='curtodsave' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>24-hour format. Seconds will reset to 0 when saved.</span></li>"));
-        
-        client.print(F("<li><label>Time format</label><select id='b16' onchange='save(this)'>")); for(char i=1; i<=2; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(16,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 1: client.print(F("12-hour")); break;
-          case 2: client.print(F("24-hour")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>For current time display only. Alarm and setting times are always shown in 24-hour.</span></li>"));
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_DATE_FN
-        client.print(F("<li><label>Current date</label><label for='curdatey'>Year&nbsp;</label><input type='number' id='curdatey' onchange='promptsave(\"curdatey\")' onkeyup='promptsave(\"curdatey\")' onblur='unpromptsave(\"curdatey\"); save(this)' min='2000' max='9999' step='1' value='")); client.print(rtcGetYear(),DEC); client.print(F("' />")); client.print(F(" <a id='curdateysave' href='#' onclick='return false' style='display: none;'>save</a>"));
-        client.print(F("<br/><label for='curdatem'>Month&nbsp;</label><input type='number' id='curdatem' onchange='promptsave(\"curdatem\")' onkeyup='promptsave(\"curdatem\")' onblur='unpromptsave(\"curdatem\"); save(this)' min='1' max='12' step='1' value='")); client.print(rtcGetMonth(),DEC); client.print(F("' />")); client.print(F(" <a id='curdatemsave' href='#' onclick='return false' style='display: none;'>save</a>"));
-        client.print(F("<br/><label for='curdated'>Date&nbsp;</label><input type='number' id='curdated' onchange='promptsave(\"curdated\")' onkeyup='promptsave(\"curdated\")' onblur='unpromptsave(\"curdated\"); save(this)' min='1' max='31' step='1' value='")); client.print(rtcGetDate(),DEC); client.print(F("' />")); client.print(F(" <a id='curdatedsave' href='#' onclick='return false' style='display: none;'>save</a></li>"));
-        
-        client.print(F("<li><label>Date format</label><select id='b17' onchange='save(this)'>")); for(char i=1; i<=5; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(17,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 1: client.print(F("month/date/weekday")); break;
-          case 2: client.print(F("date/month/weekday")); break;
-          case 3: client.print(F("month/date/year")); break;
-          case 4: client.print(F("date/month/year")); break;
-          case 5: client.print(F("year/month/date")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>The weekday is displayed as a number from 0 (Sunday) to 6 (Saturday). Four-digit displays will show only the first two values in each of these options.</span></li>"));
-
-        //TODO Day count enabled BITMASK
-        //Function preset ???????
-        //TODO leap second support?
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_DATE_COUNTER
-        client.print(F("<li><label>Day counter</label><select id='b4' onchange='if(this.value==0) document.getElementById(\"daycounterdeets\").style.display=\"none\"; else document.getElementById(\"daycounterdeets\").style.display=\"inline\"; save(this)'>")); for(char i=0; i<=2; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(4,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Off")); break;
-          case 1: client.print(F("Count days until...")); break;
-          case 2: client.print(F("Count days since...")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select>"));
-          client.print(F("<br/><span id='daycounterdeets' style='display: ")); if(readEEPROM(4,false)==0) client.print(F("none")); else client.print(F("inline"));
-          client.print(F(";'><span></span><label for='b5'>Month&nbsp;</label><input type='number' id='b5' onchange='promptsave(\"b5\")' onkeyup='promptsave(\"b5\")' onblur='unpromptsave(\"b5\"); save(this)' min='1' max='12' step='1' value='")); client.print(readEEPROM(5,false),DEC); client.print(F("' />")); client.print(F(" <a id='b5save' href='#' onclick='return false' style='display: none;'>save</a>")); //Extra span is there to prevent "first" styling on the month label
-          client.print(F("<br/><label for='b6'>Date&nbsp;</label><input type='number' id='b6' onchange='promptsave(\"b6\")' onkeyup='promptsave(\"b6\")' onblur='unpromptsave(\"b6\"); save(this)' min='1' max='31' step='1' value='")); client.print(readEEPROM(6,false),DEC); client.print(F("' />")); client.print(F(" <a id='b6save' href='#' onclick='return false' style='display: none;'>save</a><br/></span><span class='explain'>Appears after date. Repeats annually.</span></li>"));
-        #endif
-
-        client.print(F("<li><label>Display date during time?</label><select id='b18' onchange='save(this)'>")); for(char i=0; i<=3; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(18,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Never")); break;
-          case 1: client.print(F("Date instead of seconds")); break;
-          case 2: client.print(F("Full date at :30 seconds (instant)")); break;
-          case 3: client.print(F("Full date at :30 seconds (scrolling)")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif //date section
-          
-        client.print(F("<li><label>Leading zeros</label><select id='b19' onchange='save(this)'>")); for(char i=0; i<=1; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(19,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("No (1:23)")); break;
-          case 1: client.print(F("Yes (01:23)")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        
-        #if SHOW_IRRELEVANT_OPTIONS || defined(DISPLAY_NIXIE)
-        client.print(F("<li><label>Digit fade</label><input type='number' id='b20' onchange='promptsave(\"b20\")' onkeyup='promptsave(\"b20\")' onblur='unpromptsave(\"b20\"); save(this)' min='0' max='20' step='1' value='")); client.print(readEEPROM(20,false),DEC); client.print(F("' />")); client.print(F(" <a id='b20save' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>Nixie tube digit fade effect, in hundredths of a second (up to 20)</span></li>"));
-        #endif //nixie
-          
-        client.print(F("<li><label>Auto DST</label><a name='autodst' href='#'></a><select id='b22' onchange='save(this)'>")); for(char i=0; i<=6; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(22,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Off")); break;
-          case 1: client.print(F("March–November (US/CA)")); break;
-          case 2: client.print(F("March–October (UK/EU)")); break;
-          case 3: client.print(F("April–October (MX)")); break;
-          case 4: client.print(F("September–April (NZ)")); break;
-          case 5: client.print(F("October–April (AU)")); break;
-          case 6: client.print(F("October–February (BZ)")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>Automatically sets clock forward/backward at 2am on the relevant Sunday (see <a href='https://github.com/clockspot/arduino-clock/blob/master/INSTRUCTIONS.md' target='_blank'>instructions</a> for details). If you observe Daylight Saving Time but your locale's rules are not represented here, leave this set to Off and set the clock forward manually (and add an hour to the <a href='#utcoffset'>UTC offset</a> if using sunrise/sunset).</span></li>"));
-
-        #if SHOW_IRRELEVANT_OPTIONS || BACKLIGHT_PIN>=0
-        client.print(F("<li><label>Backlight behavior</label><a name='backlight' href='#'></a><select id='b26' onchange='save(this)'>")); for(char i=0; i<=4; i++){ if(i==4 && SWITCH_PIN<0) continue; client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(26,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Always off")); break;
-          case 1: client.print(F("Always on")); break;
-          case 2: client.print(F("On until night/away shutoff")); break;
-          case 3: client.print(F("On when alarm/timer signals")); break;
-          case 4: client.print(F("On with switch signal")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif //backlight pin
-
-          //TODO nixie only TODO option for never
-        #if SHOW_IRRELEVANT_OPTIONS || defined(DISPLAY_NIXIE)
-        client.print(F("<li><label>Anti-cathode poisoning</label><a name='antipoison' href='#'></a><select id='b46' onchange='save(this)'>")); for(char i=0; i<=2; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(46,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Once a day")); break;
-          case 1: client.print(F("Every hour")); break;
-          case 2: client.print(F("Every minute")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>Briefly cycles all digits to prevent <a href='http://www.tube-tester.com/sites/nixie/different/cathode%20poisoning/cathode-poisoning.htm' target='_blank'>cathode poisoning</a>. Will not trigger during night/away shutoff. Daily option happens at midnight or, if enabled, when night shutoff starts.</span></li>"));
-        #endif //nixie
-
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_TEMP_FN //TODO good for weather also
-        client.print(F("<li><label>Temperature scale</label><select id='b45' onchange='save(this)'>")); for(char i=0; i<=1; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(46,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("°C")); break;
-          case 1: client.print(F("°F")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif //temp
-        
-        #if SHOW_IRRELEVANT_OPTIONS || (ENABLE_ALARM_FN && ((PIEZO_PIN>=0)+(SWITCH_PIN>=0)+(PULSE_PIN>=0))>0)
-        client.print(F("<li><h3>Alarm</h3></li>"));
-        
-        client.print(F("<li><label>Alarm is&hellip;</label><select id='alm' onchange='save(this)'>")); for(char i=0; i<=2; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(getAlarmState()==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Off (0)")); break;
-          case 1: client.print(F("On, but skip next (01)")); break;
-          case 2: client.print(F("On (1)")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        
-        client.print(F("<li><label>Alarm time</label><input type='number' id='almtimeh' onchange='promptsave(\"almtime\")' onkeyup='promptsave(\"almtime\")' onblur='unpromptsave(\"almtime\"); savetod(\"almtime\")' min='0' max='23' step='1' value='")); client.print(readEEPROM(0,true)/60,DEC); client.print(F("' />&nbsp;:&nbsp;<input type='number' id='almtimem' onchange='promptsave(\"almtime\")' onkeyup='promptsave(\"almtime\")' onblur='unpromptsave(\"almtime\"); savetod(\"almtime\")' min='0' max='59' step='1' value='")); client.print(readEEPROM(0,true)%60,DEC); client.print(F("' /><input type='hidden' id='almtime' /> <a id='almtimesave' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>24-hour format.</span></li>"));
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_ALARM_AUTOSKIP
-        client.print(F("<li><label>Auto-skip</label><select id='b23' onchange='save(this)'>")); for(char i=0; i<=2; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(23,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Never (alarm every day)")); break;
-          case 1: client.print(F("Weekends")); break;
-          case 2: client.print(F("Work week")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>If using this, be sure to set <a href='#workweek'>work week</a> below.</span></li>"));
-        #endif
-
-        #if SHOW_IRRELEVANT_OPTIONS || ((PIEZO_PIN>=0)+(SWITCH_PIN>=0)+(PULSE_PIN>=0))>1
-        client.print(F("<li><label>Signal</label><select id='b42' onchange='save(this)'>")); for(char i=0; i<=2; i++){ if((i==0 && PIEZO_PIN<0) || (i==1 && SWITCH_PIN<0) || (i==2 && PULSE_PIN<0)) continue; client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(42,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Beeper")); break;
-          case 1: client.print(F("Switch")); break;
-          case 2: client.print(F("Pulse")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select>"));
-          #if SWITCH_PIN>=0
-            client.print(F("<br><span class='explain'>Switch signal will automatically switch off after ")); client.print(SWITCH_DUR/60,DEC); client.print(F(" minutes.</span>"));
-          #endif
-          client.print(F("</li>"));
-        #endif
-        
-        #if SHOW_IRRELEVANT_OPTIONS || (PIEZO_PIN>=0)
-        client.print(F("<li><label>Pitch</label><select id='b39' onchange='save(this)'>")); for(char i=49; i<=88; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(39,false)==i) client.print(F(" selected")); client.print(F(">")); switch((i-40)%12){
-          case 0: client.print(F("C")); break;
-          case 1: client.print(F("D&#9837;")); break;
-          case 2: client.print(F("D")); break;
-          case 3: client.print(F("E&#9837;")); break;
-          case 4: client.print(F("E")); break;
-          case 5: client.print(F("F")); break;
-          case 6: client.print(F("G&#9837;")); break;
-          case 7: client.print(F("G")); break;
-          case 8: client.print(F("A&#9837;")); break;
-          case 9: client.print(F("A")); break;
-          case 10: client.print(F("B&#9837;")); break;
-          case 11: client.print(F("B")); break;
-          default: break; } client.print(((i-40)/12)+4,DEC); client.print(F("</option>")); } client.print(F("</select></li>"));
-          
-        client.print(F("<li><label>Pattern</label><select id='b47' onchange='save(this)'>")); for(char i=0; i<=5; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(47,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Long")); break;
-          case 1: client.print(F("Short")); break;
-          case 2: client.print(F("Double")); break;
-          case 3: client.print(F("Triple")); break;
-          case 4: client.print(F("Quad")); break;
-          case 5: client.print(F("Cuckoo")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif
-        
-        client.print(F("<li><label>Snooze</label><input type='number' id='b24' onchange='promptsave(\"b24\")' onkeyup='promptsave(\"b24\")' onblur='unpromptsave(\"b24\"); save(this)' min='0' max='60' step='1' value='")); client.print(readEEPROM(24,false),DEC); client.print(F("' />")); client.print(F(" <a id='b24save' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>In minutes. Zero disables snooze.</span></li>"));
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ((PIEZO_PIN>=0 || PULSE_PIN>=0) && ENABLE_ALARM_FIBONACCI)
-        client.print(F("<li><label>Fibonacci mode</label><select id='b50' onchange='save(this)'>")); for(char i=0; i<=1; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(50,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Off")); break;
-          case 1: client.print(F("On")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br><span class='explain'>To wake you more gradually, the alarm will start about 27 minutes early, by beeping at increasingly shorter intervals per the Fibonacci sequence (610 seconds, then 337, then 233...). In this mode, snooze does not take effect; any button press will silence the alarm for the day, even if the set alarm time hasn’t been reached yet."));
-          #if (SWITCH_PIN>=0)
-            client.print(F(" Has no effect when alarm is set to use switch signal."));
-          #endif
-          client.print(F("</span></li>"));
-        #endif
-          
-        #endif //alarm section
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_TIMER_FN
-        client.print(F("<li><h3>Chrono/Timer</h3></li>"));
-        
-        client.print(F("<li><label>Timer runout</label><select id='runout' onchange='save(this)'>")); for(char i=0; i<=3; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(((getTimerState()>>2)&3)==i) client.print(F(" selected")); client.print(F(">")); switch(i){ //00 stop, 01 repeat, 10 chrono, 11 chrono short signal
-          case 0: client.print(F("Stop, long signal")); break;
-          case 1: client.print(F("Repeat, short signal")); break;
-          case 2: client.print(F("Start chrono, long signal")); break;
-          case 3: client.print(F("Start chrono, short signal")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br><span class='explain'>What the timer will do when it runs out. This can be set directly on the clock as well: while the timer is running, Down will cycle through these options (1-4 beeps respectively). The repeat option makes a great interval timer!</span></li>")); //TODO switch etc
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ((PIEZO_PIN>=0)+(SWITCH_PIN>=0)+(PULSE_PIN>=0))>1
-        client.print(F("<li><label>Signal</label><select id='b43' onchange='save(this)'>")); for(char i=0; i<=2; i++){ if((i==0 && PIEZO_PIN<0) || (i==1 && SWITCH_PIN<0) || (i==2 && PULSE_PIN<0)) continue; client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(43,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Beeper")); break;
-          case 1: client.print(F("Switch")); break;
-          case 2: client.print(F("Pulse")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select>"));
-          #if SWITCH_PIN>=0
-            client.print(F("<br><span class='explain'>Switch signal will switch on while timer is running, like a <a href='https://en.wikipedia.org/wiki/Time_switch' target='_blank'>sleep timer</a>.</span>"));
-          #endif
-          client.print(F("</li>"));
-        #endif
-        
-        #if SHOW_IRRELEVANT_OPTIONS || (PIEZO_PIN>=0)
-        client.print(F("<li><label>Pitch</label><select id='b40' onchange='save(this)'>")); for(char i=49; i<=88; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(40,false)==i) client.print(F(" selected")); client.print(F(">")); switch((i-40)%12){
-          case 0: client.print(F("C")); break;
-          case 1: client.print(F("D&#9837;")); break;
-          case 2: client.print(F("D")); break;
-          case 3: client.print(F("E&#9837;")); break;
-          case 4: client.print(F("E")); break;
-          case 5: client.print(F("F")); break;
-          case 6: client.print(F("G&#9837;")); break;
-          case 7: client.print(F("G")); break;
-          case 8: client.print(F("A&#9837;")); break;
-          case 9: client.print(F("A")); break;
-          case 10: client.print(F("B&#9837;")); break;
-          case 11: client.print(F("B")); break;
-          default: break; } client.print(((i-40)/12)+4,DEC); client.print(F("</option>")); } client.print(F("</select></li>"));
-        
-        client.print(F("<li><label>Pattern</label><select id='b48' onchange='save(this)'>")); for(char i=0; i<=5; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(48,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Long")); break;
-          case 1: client.print(F("Short")); break;
-          case 2: client.print(F("Double")); break;
-          case 3: client.print(F("Triple")); break;
-          case 4: client.print(F("Quad")); break;
-          case 5: client.print(F("Cuckoo")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif
-          
-        #endif //timer/chrono section
-        
-        #if SHOW_IRRELEVANT_OPTIONS || (ENABLE_TIME_CHIME && (PIEZO_PIN>=0 || PULSE_PIN>=0))
-        client.print(F("<li><h3>Chime</h3></li>"));
-        
-        client.print(F("<li><label>Chime</label><select id='b21' onchange='save(this)'>")); for(char i=0; i<=4; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(21,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Off")); break;
-          case 1: client.print(F("Single pulse")); break;
-          case 2: client.print(F("Six pips")); break;
-          case 3: client.print(F("Strike the hour")); break;
-          case 4: client.print(F("Ship's bell")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>Will not sound during night/away shutoff (except when off starts at top of hour). <a href='https://en.wikipedia.org/wiki/Greenwich_Time_Signal' target='_blank'>Six pips refers to this.</a></span></li>"));
-        
-        #if SHOW_IRRELEVANT_OPTIONS || (PIEZO_PIN>=0 && PULSE_PIN>=0)
-        client.print(F("<li><label>Signal</label><select id='b44' onchange='save(this)'>")); for(char i=0; i<=2; i++){ if(i==1) continue; client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(44,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Beeper")); break;
-          //no chime support for switch signal
-          case 2: client.print(F("Pulse")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif
-        
-        #if SHOW_IRRELEVANT_OPTIONS || (PIEZO_PIN>=0)  
-        client.print(F("<li><label>Pitch</label><select id='b41' onchange='save(this)'>")); for(char i=49; i<=88; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(41,false)==i) client.print(F(" selected")); client.print(F(">")); switch((i-40)%12){
-          case 0: client.print(F("C")); break;
-          case 1: client.print(F("D&#9837;")); break;
-          case 2: client.print(F("D")); break;
-          case 3: client.print(F("E&#9837;")); break;
-          case 4: client.print(F("E")); break;
-          case 5: client.print(F("F")); break;
-          case 6: client.print(F("G&#9837;")); break;
-          case 7: client.print(F("G")); break;
-          case 8: client.print(F("A&#9837;")); break;
-          case 9: client.print(F("A")); break;
-          case 10: client.print(F("B&#9837;")); break;
-          case 11: client.print(F("B")); break;
-          default: break; } client.print(((i-40)/12)+4,DEC); client.print(F("</option>")); } client.print(F("</select></li>"));
-          
-        client.print(F("<li><label>Pattern</label><select id='b49' onchange='save(this)'>")); for(char i=0; i<=5; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(49,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Long")); break;
-          case 1: client.print(F("Short")); break;
-          case 2: client.print(F("Double")); break;
-          case 3: client.print(F("Triple")); break;
-          case 4: client.print(F("Quad")); break;
-          case 5: client.print(F("Cuckoo")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif
-          
-        #endif //chime section
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_SHUTOFF_NIGHT || ENABLE_SHUTOFF_AWAY
-        client.print(F("<li><h3>Shutoff</h3></li>"));
-        #endif
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_SHUTOFF_NIGHT
-        client.print(F("<li><label>Night shutoff</label><select id='b27' onchange='save(this)'>")); for(char i=0; i<=2; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(27,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("None")); break;
-          case 1: client.print(F("Dim")); break;
-          case 2: client.print(F("Shut off")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>To save display life and/or preserve your sleep, dim or shut off display nightly when you're not around or sleeping. When off, you can press Select to illuminate the display briefly.</span></li>"));
-        
-        client.print(F("<li><label>Night start</label><input type='number' id='nighttodh' onchange='promptsave(\"nighttod\")' onkeyup='promptsave(\"nighttod\")' onblur='unpromptsave(\"nighttod\"); savetod(\"nighttod\")' min='0' max='23' step='1' value='")); client.print(readEEPROM(28,true)/60,DEC); client.print(F("' />&nbsp;:&nbsp;<input type='number' id='nighttodm' onchange='promptsave(\"nighttod\")' onkeyup='promptsave(\"nighttod\")' onblur='unpromptsave(\"nighttod\"); savetod(\"nighttod\")' min='0' max='59' step='1' value='")); client.print(readEEPROM(28,true)%60,DEC); client.print(F("' /><input type='hidden' id='nighttod' /> <a id='nighttodsave' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>24-hour format.</span></li>"));
-        
-        client.print(F("<li><label>Night end</label><input type='number' id='morntodh' onchange='promptsave(\"morntod\")' onkeyup='promptsave(\"morntod\")' onblur='unpromptsave(\"morntod\"); savetod(\"morntod\")' min='0' max='23' step='1' value='")); client.print(readEEPROM(30,true)/60,DEC); client.print(F("' />&nbsp;:&nbsp;<input type='number' id='morntodm' onchange='promptsave(\"morntod\")' onkeyup='promptsave(\"morntod\")' onblur='unpromptsave(\"morntod\"); savetod(\"morntod\")' min='0' max='59' step='1' value='")); client.print(readEEPROM(30,true)%60,DEC); client.print(F("' /><input type='hidden' id='morntod' /> <a id='morntodsave' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>24-hour format. Set to 0:00 to use the alarm time.</span></li>"));
-        #endif //night shutoff
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_SHUTOFF_AWAY
-        client.print(F("<li><label>Away shutoff</label><select id='b32' onchange='save(this)'>")); for(char i=0; i<=2; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(32,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("None")); break;
-          case 1: client.print(F("Weekends (clock at work)")); break;
-          case 2: client.print(F("Workday (clock at home)")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>To further save display life, shut off display during daytime hours when you're not around. This feature is designed to accommodate your weekly work schedule.</span></li>"));
-        #endif
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_SHUTOFF_AWAY || (ENABLE_ALARM_FN && ENABLE_ALARM_AUTOSKIP)
-          #if !SHOW_IRRELEVANT_OPTIONS && !ENABLE_SHUTOFF_AWAY //Alternative header if only workweek is needed
-          client.print(F("<li><h3>Workweek</h3></li>"));
-          #endif
-        client.print(F("<li><label>First day of workweek</label><a name='workweek' href='#'></a><select id='b33' onchange='save(this)'>")); for(char i=0; i<=6; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(33,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Sunday")); break;
-          case 1: client.print(F("Monday")); break;
-          case 2: client.print(F("Tuesday")); break;
-          case 3: client.print(F("Wednesday")); break;
-          case 4: client.print(F("Thursday")); break;
-          case 5: client.print(F("Friday")); break;
-          case 6: client.print(F("Saturday")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        
-        client.print(F("<li><label>Last day of workweek</label><select id='b34' onchange='save(this)'>")); for(char i=0; i<=6; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(34,false)==i) client.print(F(" selected")); client.print(F(">")); switch(i){
-          case 0: client.print(F("Sunday")); break;
-          case 1: client.print(F("Monday")); break;
-          case 2: client.print(F("Tuesday")); break;
-          case 3: client.print(F("Wednesday")); break;
-          case 4: client.print(F("Thursday")); break;
-          case 5: client.print(F("Friday")); break;
-          case 6: client.print(F("Saturday")); break;
-          default: break; } client.print(F("</option>")); } client.print(F("</select></li>"));
-        #endif
-        
-        #if SHOW_IRRELEVANT_OPTIONS || ENABLE_SHUTOFF_AWAY
-        client.print(F("<li><label>Workday start</label><input type='number' id='worktodh' onchange='promptsave(\"worktod\")' onkeyup='promptsave(\"worktod\")' onblur='unpromptsave(\"worktod\"); savetod(\"worktod\")' min='0' max='23' step='1' value='")); client.print(readEEPROM(35,true)/60,DEC); client.print(F("' />&nbsp;:&nbsp;<input type='number' id='worktodm' onchange='promptsave(\"worktod\")' onkeyup='promptsave(\"worktod\")' onblur='unpromptsave(\"worktod\"); savetod(\"worktod\")' min='0' max='59' step='1' value='")); client.print(readEEPROM(35,true)%60,DEC); client.print(F("' /><input type='hidden' id='worktod' /> <a id='worktodsave' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>24-hour format.</span></li>"));
-      
-        client.print(F("<li><label>Workday end</label><input type='number' id='hometodh' onchange='promptsave(\"hometod\")' onkeyup='promptsave(\"hometod\")' onblur='unpromptsave(\"hometod\"); savetod(\"hometod\")' min='0' max='23' step='1' value='")); client.print(readEEPROM(37,true)/60,DEC); client.print(F("' />&nbsp;:&nbsp;<input type='number' id='hometodm' onchange='promptsave(\"hometod\")' onkeyup='promptsave(\"hometod\")' onblur='unpromptsave(\"hometod\"); savetod(\"hometod\")' min='0' max='59' step='1' value='")); client.print(readEEPROM(37,true)%60,DEC); client.print(F("' /><input type='hidden' id='hometod' /> <a id='hometodsave' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>24-hour format. Set to 0:00 to use the alarm time.</span></li>"));  
-        #endif //away shutoff
-        
-        client.print(F("<li><h3>Geography</h3></li>"));
-        
-        #if SHOW_IRRELEVANT_OPTIONS || (ENABLE_DATE_FN && ENABLE_DATE_RISESET)
-        client.print(F("<li><p><a href='https://support.google.com/maps/answer/18539?co=GENIE.Platform%3DDesktop&hl=en' target='_blank'>How to find your latitude and longitude</a></p></li>"));
-
-        client.print(F("<li><label>Latitude</label><input type='number' id='i10raw' onchange='promptsave(\"i10\")' onkeyup='promptsave(\"i10\")' onblur='unpromptsave(\"i10\"); savecoord(\"i10\")' min='-90' max='90' step='0.1' value='")); client.print(readEEPROM(10,true)/10,DEC); client.print(F(".")); client.print(abs(readEEPROM(10,true))%10,DEC); client.print(F("' /><input type='hidden' id='i10' /> <a id='i10save' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>Your latitude, to the nearest tenth of a degree. Negative values are south.</span></li>"));
-
-        client.print(F("<li><label>Longitude</label><input type='number' id='i12raw' onchange='promptsave(\"i12\")' onkeyup='promptsave(\"i12\")' onblur='unpromptsave(\"i12\"); savecoord(\"i12\")' min='-180' max='180' step='0.1' value='")); client.print(readEEPROM(12,true)/10,DEC); client.print(F(".")); client.print(abs(readEEPROM(12,true))%10,DEC); client.print(F("' /><input type='hidden' id='i12' /> <a id='i12save' href='#' onclick='return false' style='display: none;'>save</a><br/><span class='explain'>Your longitude, to the nearest tenth of a degree. Negative values are west.</span></li>"));
-        #endif //date rise set
-        
-        //Wi-Fi, NTP, and UTC offset are always relevant given network
-        client.print(F("<li><label>UTC offset</label><a name='utcoffset' href='#'></a><select id='b14' onchange='save(this)'>")); for(char i=52; i<=156; i++){ client.print(F("<option value='")); client.print(i,DEC); client.print(F("'")); if(readEEPROM(14,false)==i) client.print(F(" selected")); client.print(F(">"));
-        char offseth = abs(i-100)/4;
-        char offsetm = (abs(i-100)%4)*15;
-        if(i<100) client.print(F("–")); else client.print(F("+"));
-        client.print(offseth,DEC);
-        client.print(F(":"));
-        if(offsetm<10) client.print(F("0"));
-        client.print(offsetm,DEC);
-        client.print(F("</option>")); } client.print(F("</select><br/><span class='explain'>Your time zone's offset from UTC (non-DST). If you observe DST but set the clock manually rather than using the <a href='#autodst'>auto DST</a> feature, you must add an hour to the UTC offset during DST, or the sunrise/sunset times will be an hour early.</span></li>"));
-        
-        //After replacing the below from formdev.php, replace " with \"
-        client.print(F("</ul></div><script type='text/javascript'>function e(id){ return document.getElementById(id); } function promptsave(ctrl){ document.getElementById(ctrl+\"save\").style.display=\"inline\"; } function unpromptsave(ctrl){ document.getElementById(ctrl+\"save\").style.display=\"none\"; } function savecoord(ctrlset){ ctrl = document.getElementById(ctrlset); if(ctrl.disabled) return; ctrl.value = parseInt(parseFloat(document.getElementById(ctrlset+\"raw\").value)*10); save(ctrl); } function savetod(ctrlset){ ctrl = document.getElementById(ctrlset); if(ctrl.disabled) return; ctrl.value = (parseInt(document.getElementById(ctrlset+\"h\").value)*60) + parseInt(document.getElementById(ctrlset+\"m\").value); save(ctrl); } function save(ctrl){ if(ctrl.disabled) return; ctrl.disabled = true; let ind = ctrl.nextSibling; if(ind && ind.tagName==='SPAN') ind.parentNode.removeChild(ind); ind = document.createElement('span'); ind.innerHTML = '&nbsp;<span class=\"saving\">'+(ctrl.id=='syncnow'?'Syncing':'Saving')+'&hellip;</span>'; ctrl.parentNode.insertBefore(ind,ctrl.nextSibling); let xhr = new XMLHttpRequest(); xhr.onreadystatechange = function(){ if(xhr.readyState==4){ ctrl.disabled = false; console.log(xhr); if(xhr.status==200 && (xhr.responseText=='ok'||xhr.responseText=='synced')){ if(ctrl.id=='wform'){ e('content').innerHTML = '<p class=\"ok\">Wi-Fi changes applied.</p><p>' + (e('wssid').value? 'Now attempting to connect to <strong>'+htmlEntities(e('wssid').value)+'</strong>.</p><p>If successful, the clock will display its IP address. To access this settings page again, connect to <strong>'+htmlEntities(e('wssid').value)+'</strong> and visit that IP address. (If you miss it, hold Select for 5 seconds to see it again.)</p><p>If not successful, the clock will display <strong>7777</strong>. ': '') + 'To access this settings page again, (re)connect to Wi-Fi network <strong>Clock</strong> and visit <a href=\"http://7.7.7.7\">7.7.7.7</a>.</p>'; clearTimeout(timer); } else { ind.innerHTML = '&nbsp;<span class=\"ok\">'+(xhr.responseText=='synced'?'Synced':'Saved')+'</span>'; setTimeout(function(){ if(ind.parentNode) ind.parentNode.removeChild(ind); },1500); } } else ind.innerHTML = '&nbsp;<span class=\"error\">'+(xhr.responseText?xhr.responseText:'Error')+'</span>'; timer = setTimeout(timedOut, ")); client.print(ADMIN_TIMEOUT,DEC); client.print(F("); } }; clearTimeout(timer); xhr.open('POST', './', true); xhr.setRequestHeader('Content-Type', 'application/x-www-form-urlencoded'); if(ctrl.id=='wform'){ switch(e('wtype').value){ case '': e('wssid').value = ''; e('wpass').value = ''; case 'wpa': e('wki').value = '0'; case 'wep': default: break; } xhr.send('wssid='+e('wssid').value+'&wpass='+e('wpass').value+'&wki='+e('wki').value); } else { xhr.send(ctrl.id+'='+ctrl.value); } } function wformchg(initial){ if(initial) e('wtype').value = (e('wssid').value? (e('wki').value!=0? 'wep': 'wpa'): ''); e('wa').style.display = (e('wtype').value==''?'none':'inline'); e('wb').style.display = (e('wtype').value=='wep'?'inline':'none'); if(!initial) e('wformsubmit').style.display = 'inline'; } function timedOut(){ e('content').innerHTML = 'Clock settings page has timed out. Please hold Alt to reactivate it, then <a href=\"#\" onclick=\"location.reload(); return false;\">refresh</a>.'; } function htmlEntities(str){ return String(str).replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;').replace(/\"/g, '&quot;'); } wformchg(true); let timer = setTimeout(timedOut, ")); client.print(ADMIN_TIMEOUT,DEC); client.print(F("); document.getElementById('loading').remove(); document.getElementById('content').style.display = 'block';</script></body></html>"));
-        //client.print(F(""));
-      } //end get
-      else { //requestType==2 - handle what was POSTed
-        bool clientReturn = false; //Mark true when sending an error. If none, "ok" is sent at end. If nothing sent (crash), client displays generic error.
-        //client.print(currentLine);
-        //syncfreq=hr
-        //syncfreq=min
-        if(currentLine.startsWith(F("wssid="))){ //wifi change
-          //e.g. wssid=Network Name&wpass=qwertyuiop&wki=1
-          //TODO since the values are not html-entitied (due to the difficulty of de-entiting here), this will fail if the ssid contains "&wpass=" or pass contains "&wki="
-          int startPos = 6;
-          int endPos = currentLine.indexOf(F("&wpass="),startPos);
-          wssid = currentLine.substring(startPos,endPos);
-          startPos = endPos+7;
-          endPos = currentLine.indexOf(F("&wki="),startPos);
-          wpass = currentLine.substring(startPos,endPos);
-          startPos = endPos+5;
-          wki = currentLine.substring(startPos).toInt();
-          //Persistent storage - see wssid/wpass definitions above
-          for(byte i=0; i<97; i++) writeEEPROM(55+i,0,false,false); //Clear out the old values (32+64+1)
-          for(byte i=0; i<wssid.length(); i++) { if(i<55+32) writeEEPROM(55+i,wssid[i],false,false); } //Write in the SSID
-          for(byte i=0; i<wpass.length(); i++) { if(i<87+64) writeEEPROM(87+i,wpass[i],false,false); } //Write in the pass
-          writeEEPROM(151,wki,false,false); //Write in the wki
-          commitEEPROM(); //commit all the above
-          requestType = 3; //triggers an admin restart after the client is closed, below
-        } else if(currentLine.startsWith(F("ntpip"))){
-          //e.g. ntpip=192.168.1.255
-          byte ntpip[4]; byte startPos = 6; bool parseOK = true;
-          for(byte i=0; i<4; i++){
-            byte endPos = currentLine.indexOf(F("."),startPos);
-            int octet = (endPos>-1? currentLine.substring(startPos,endPos).toInt(): currentLine.substring(startPos).toInt());
-            ntpip[i] = octet; startPos = endPos+1;
-            if(ntpip[i]!=octet){ parseOK = false; break; }
-          }
-          if(!parseOK) { clientReturn = true; client.print(F("Error: invalid format")); }
-          else for(byte i=0; i<4; i++) writeEEPROM(51+i,ntpip[i],false);
-          //Serial.print(F("IP should be ")); Serial.print(ntpip[0],DEC); Serial.print(F(".")); Serial.print(ntpip[1],DEC); Serial.print(F(".")); Serial.print(ntpip[2],DEC); Serial.print(F(".")); Serial.println(ntpip[3],DEC);
-          //Serial.print(F("IP saved as ")); Serial.print(readEEPROM(51,false),DEC); Serial.print(F(".")); Serial.print(readEEPROM(52,false),DEC); Serial.print(F(".")); Serial.print(readEEPROM(53,false),DEC); Serial.print(F(".")); Serial.println(readEEPROM(54,false),DEC);
-        } else if(currentLine.startsWith(F("syncnow"))){
-          //TODO this doesn't seem to return properly if the wifi was changed after the clock was booted - it syncs, but just hangs
-          int ntpCode = startNTP(true);
-          switch(ntpCode){
-            case -1: client.print(F("Error: no Wi-Fi credentials.")); break;
-            case -2: client.print(F("Error: not connected to Wi-Fi.")); break;
-            case -3: client.print(F("Error: NTP response pending. Please try again shortly.")); break; //should never see this one on the web since it's synchronous and the client blocks
-            case -4: client.print(F("Error: too many sync requests in the last ")); client.print(NTP_MINFREQ/1000,DEC); client.print(F(" seconds. Please try again shortly.")); break;
-            case -5: client.print(F("Error: no NTP response received. Please confirm server.")); break;
-            case 0: client.print(F("synced")); break;
-            default: client.print(F("Error: unhandled NTP code")); break;
-          }
-          clientReturn = true;
-        } else if(currentLine.startsWith(F("curtod"))){
-          int tod = currentLine.substring(7).toInt();
-          rtcSetTime(tod/60,tod%60,0);
-          ntpSyncLast = 0;
-          goToFn(FN_TOD);
-        } else if(currentLine.startsWith(F("curdatey"))){
-          rtcSetDate(currentLine.substring(9).toInt(), rtcGetMonth(), rtcGetDate(), dayOfWeek(currentLine.substring(9).toInt(), rtcGetMonth(), rtcGetDate())); //TODO what about month exceed
-          ntpSyncLast = 0;
-          goToFn(FN_CAL,254);
-        } else if(currentLine.startsWith(F("curdatem"))){
-          rtcSetDate(rtcGetYear(), currentLine.substring(9).toInt(), rtcGetDate(), dayOfWeek(rtcGetYear(), currentLine.substring(9).toInt(), rtcGetDate())); //TODO what about month exceed
-          goToFn(FN_CAL,254);
-        } else if(currentLine.startsWith(F("curdated"))){
-          rtcSetDate(rtcGetYear(), rtcGetMonth(), currentLine.substring(9).toInt(), dayOfWeek(rtcGetYear(), rtcGetMonth(), currentLine.substring(9).toInt())); //TODO what about month exceed
-          goToFn(FN_CAL,254);
-        } else if(currentLine.startsWith(F("almtime"))){
-          writeEEPROM(0,currentLine.substring(7).toInt(),true);
-          goToFn(FN_ALARM);
-        } else if(currentLine.startsWith(F("alm"))){ //two settings (alarm on, alarm skip) with one control. Compare to switchAlarmState()
-          setAlarmState(currentLine.substring(4).toInt());
-          goToFn(FN_ALARM);
-        } else if(currentLine.startsWith(F("runout"))){
-          char runout = currentLine.substring(7).toInt();
-          setTimerState(3,runout/2); //chrono bit
-          setTimerState(2,runout%2); //restart bit
-        } else if(currentLine.startsWith(F("nighttod"))){
-          writeEEPROM(28,currentLine.substring(9).toInt(),true);
-        } else if(currentLine.startsWith(F("morntod"))){
-          writeEEPROM(30,currentLine.substring(8).toInt(),true);
-        } else if(currentLine.startsWith(F("worktod"))){
-          writeEEPROM(35,currentLine.substring(8).toInt(),true);
-        } else if(currentLine.startsWith(F("hometod"))){
-          writeEEPROM(37,currentLine.substring(8).toInt(),true);
-        } else {
-          //standard eeprom saves by type/loc
-          bool isInt = currentLine.startsWith(F("i")); //or b for byte
-          int eqPos = currentLine.indexOf(F("="));
-          int key = currentLine.substring(1,eqPos).toInt();
-          int val = currentLine.substring(eqPos+1).toInt();
-          writeEEPROM(key,val,isInt);
-          //do special stuff for some of them
-          switch(key){
-            case 4: case 5: case 6: //day counter
-              //in lieu of actually switching to FN_CAL, so that only this value is seen - compare to ino
-              if(readEEPROM(4,false)) tempDisplay(dateComp(rtcGetYear(),rtcGetMonth(),rtcGetDate(), readEEPROM(5,false),readEEPROM(6,false),readEEPROM(4,false)-1));
-              findFnAndPageNumbers(); //to include or exclude the day counter from the calendar function
-              break;
-            case 14: //utc offset
-              cueNTP(); break;
-            case 17: //date format
-              goToFn(FN_CAL,254); break;
-            case 22: //auto dst
-              isDSTByHour(rtcGetYear(),rtcGetMonth(),rtcGetDate(),rtcGetHour(),true); break;
-            case 39: case 47: //alarm pitch/pattern
-              goToFn(FN_ALARM); break;
-            case 40: case 48: //timer pitch/pattern
-              goToFn(FN_TIMER); break;
-            case 41: case 49: //strike pitch/pattern
-              goToFn(FN_TOD); break;
-            default: break;
-          }
-          if(key==39 || key==40 || key==41){ //play beeper pitch sample - compare to updateDisplay()
-            quickBeep(val);
-          }
-          if(key==47 || key==48 || key==49){ //play beeper pattern sample - compare to updateDisplay()
-            quickBeepPattern((key==49?FN_TOD:(key==48?FN_TIMER:FN_ALARM)),val);
-          }
-        }
-        updateDisplay();
-        if(!clientReturn) client.print(F("ok"));
-      } //end post
-    } //end if requestType
-    
-    client.stop();
-    //Serial.println("");
-    //Serial.println("client disconnected");
-    delay(500); //for client to get the message TODO why is this necessary
-    
-    if(requestType==3) { //wifi was changed - restart the admin
-      networkStartWiFi(); //try to connect to wifi with new settings
-      networkStartAdmin(); //will set up AP if wifi isn't connected
+  }
+  else if(!adminInputLast){ out.begin(403,F("text/plain")); out.print(F("Settings page is not active. Please start it from the clock.")); out.end(); }
+  else if(x->state==SESSION_SYNC){
+    if(ntpGoing) return false;
+    //Did a packet arrive for the request we made?
+    adminSyncResult(out,(ntpSyncLast && (unsigned long)(ntpSyncLast-ntpStartLast)<NTP_TIMEOUT? 0: -5));
+  }
+  else if(r->state==HTTP_ST_ERROR){ out.begin(r->error,F("text/plain")); out.print(httpReason(r->error)); out.end(); }
+  else if(r->method==HTTP_GET && !strcmp(r->path,"/")){ if(sendAdminPage(out,r)){ x->blob = adminPage; x->blobLen = ADMIN_PAGE_LEN; } }
+  else if(r->method==HTTP_GET && !strcmp(r->path,"/settings")) sendAdminSettings(out);
+  else if(r->method==HTTP_POST && !strcmp(r->path,"/")){
+    if(!adminPost(out,r)){ adminSessionState(s,SESSION_SYNC); return false; }
+  }
+  else if(r->method==HTTP_PATCH && !strcmp(r->path,"/settings")) adminPatch(out,r);
+  else if(r->method==HTTP_GET && !strcmp(r->path,"/tunes")){ out.begin(200,F("application/octet-stream")); patternDumpTunes(out); out.end(); }
+  else if(r->method==HTTP_POST && !strcmp(r->path,"/tunes")){
+    int n = patternSaveTunes((const byte*)r->body,r->bodyLen);
+    out.begin(n<0? (n==-2? 413: 400): 200,F("text/plain"));
+    if(n<0) out.print(n==-2? F("Too many tunes, or too long."): F("Not valid tunes."));
+    else { out.print(F("Saved ")); out.print(n); out.print(F(" tunes.")); }
+    out.end();
+  }
+  else { out.begin(404,F("text/plain")); out.print(httpReason(404)); out.end(); }
+  if(adminInputLast && !metrics && !events && !trace && !pintrace && !upload) adminInputLast = millis(); //admin is in use
+  x->outLen = out.length();
+  if(out.overflowed()){ //shouldn't happen, but just in case
+    HttpOut err(adminOut,ADMIN_OUT_MAX);
+    err.begin(500,F("text/plain")); err.end();
+    x->outLen = err.length(); x->blob = NULL; x->blobLen = 0;
+  }
+  x->outPos = 0;
+  adminOutOwner = s;
+  adminSessionState(s,SESSION_WRITE);
+  return true;
+}
+
+void checkAdminSession(byte s){
+  //Advances session s by one slice, per its state
+  AdminSession *x = &sessions[s];
+  if(x->state==SESSION_READ){
+    byte buf[128]; //no more than OTA_PENDING_MAX, as what's left after the headers may be the start of an update
+    int len = x->client.read(buf,sizeof(buf));
+    int used = (len>0? httpFeedBuf(&x->req,buf,len): 0);
+    #ifdef OTA_KEY
+    if(x->req.state==HTTP_ST_STREAM && adminUploadStart(s,buf+used,len-used)){ adminSessionState(s,SESSION_UPLOAD); return; }
+    #endif
+    if(x->req.state>=HTTP_ST_DONE) adminSessionState(s,SESSION_READY); //complete, or malformed - either way, respond
+    else if(!x->client.connected() || (unsigned long)(millis()-x->stateStart)>=SESSION_TIMEOUT) { adminSessionClose(s); return; }
+  }
+  #ifdef OTA_KEY
+  if(x->state==SESSION_UPLOAD){
+    //Write what's arrived to flash - this is the only time we take more than a small slice of the loop
+    if(!otaReady()){ x->stateStart = millis(); return; } //still erasing flash for it - the client can wait
+    byte buf[UPLOAD_SLICE];
+    int len = x->client.read(buf,sizeof(buf));
+    if(len>0){ otaWrite(buf,len); x->stateStart = millis(); } //time out only if it stops sending
+    if(otaReceived()>=(unsigned long)x->req.contentLength){
+      x->status = (otaEnd(x->req.crc)? 200: 400);
+      adminSessionState(s,SESSION_READY);
     }
+    else if(!x->client.connected() || (unsigned long)(millis()-x->stateStart)>=SESSION_TIMEOUT){ adminSessionClose(s); return; } //aborts the update
+    else return;
+  }
+  #endif
+  if(x->state==SESSION_READY || x->state==SESSION_SYNC){
+    if(adminOutOwner!=255) return; //another session's response is in the buffer - wait our turn
+    if(!adminRespond(s)) return;
+  }
+  if(x->state==SESSION_WRITE){
+    word total = x->outLen+x->blobLen;
+    if(x->outPos<total){
+      const byte *src; word n;
+      if(x->outPos<x->outLen){ src = adminOut+x->outPos; n = x->outLen-x->outPos; }
+      else { src = x->blob+(x->outPos-x->outLen); n = total-x->outPos; }
+      if(n>SESSION_SLICE) n = SESSION_SLICE;
+      size_t sent = x->client.write(src,n);
+      if(!sent){ adminSessionClose(s); return; } //client has gone away
+      x->outPos += sent;
+    }
+    if(x->outPos>=x->outLen && adminOutOwner==s) adminOutOwner = 255; //done with the buffer - rest (if any) is from flash
+    if(x->outPos>=total){ adminSessionState(s,(x->stream? SESSION_STREAM: SESSION_LINGER)); x->sentLast = millis(); }
+    return; //give the client a cycle before we check on it
+  }
+  if(x->state==SESSION_STREAM){
+    //Only check in every EVENTS_INTERVAL, so a connected browser costs the loop next to nothing
+    if((unsigned long)(millis()-x->stateStart)<EVENTS_INTERVAL) return;
+    adminSessionState(s,SESSION_STREAM); //restarts the interval
+    if(!x->client.connected() || !sendEvent(s)) adminSessionClose(s);
+    return;
   }
+  if(x->state==SESSION_LINGER){
+    //Closing as soon as the response is written can cut it off, so we wait for the client to hang up (per Connection: close)
+    byte buf[64];
+    x->client.read(buf,sizeof(buf)); //discard anything else it sends
+    if(!x->client.connected() || (unsigned long)(millis()-x->stateStart)>=SESSION_CLOSE_WAIT) adminSessionClose(s);
+  }
+}
+
+void checkClients(){
+  if(adminInputLast && (unsigned long)(millis()-adminInputLast)>=ADMIN_TIMEOUT) networkStopAdmin();
+  
+  //New client? server.available() returns any client with data to read, which may be one we already have
+  WiFiClient client = server.available();
+  if(client){
+    bool have = false;
+    for(byte s=0; s<ADMIN_SESSIONS; s++) if(sessions[s].state!=SESSION_FREE && sessions[s].client==client) have = true;
+    if(!have) for(byte s=0; s<ADMIN_SESSIONS; s++){
+      //Even if admin isn't active, we'll take the request - for /metrics, or to say so (see adminRespond())
+      if(sessions[s].state!=SESSION_FREE) continue;
+      sessions[s].client = client;
+      sessions[s].stream = false; sessions[s].status = 0;
+      httpReset(&sessions[s].req);
+      adminSessionState(s,SESSION_READ);
+      break;
+    } //if no free session, it'll come up again next time
+  }
+  
+  bool busy = false;
+  for(byte s=0; s<ADMIN_SESSIONS; s++){
+    if(sessions[s].state==SESSION_FREE) continue;
+    checkAdminSession(s);
+    if(sessions[s].state!=SESSION_FREE && sessions[s].state!=SESSION_STREAM) busy = true; //streams don't end on their own
+  }
+  
+  if(adminWiFiChanged && !busy) { //wifi was changed, and the response has been sent - restart the admin
+    adminWiFiChanged = false;
+    for(byte s=0; s<ADMIN_SESSIONS; s++) if(sessions[s].state==SESSION_STREAM) adminSessionClose(s); //they'll reconnect
+    networkStartWiFi(); //try to connect to wifi with new settings
+    networkStartAdmin(); //once the attempt resolves, will display IP, or set up AP if wifi isn't connected
+  }
+}
+
+bool networkBusy(){
+  //Whether anything is under way that needs the loop at full speed - connecting, admin or clients, NTP, weather.
+  //If not, the loop can nap between cycles while the display is off (see power.cpp); the Wi-Fi module buffers for us.
+  if(wifiState==WIFI_CONNECTING || wifiState==WIFI_AP_STARTING || adminInputLast || ntpGoing) return true;
+  for(byte s=0; s<ADMIN_SESSIONS; s++) if(sessions[s].state!=SESSION_FREE) return true;
+  #if ENABLE_DATE_WEATHER
+  if(weatherBusy()) return true;
+  #endif
+  return false;
 }
 
 #else
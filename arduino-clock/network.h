@@ -1,20 +1,47 @@
 #ifndef NETWORK_H
 #define NETWORK_H
 
+struct HttpRequest; //see http.h
+class HttpOut;
+
 bool networkSupported();
 void checkForWiFiStatusChange();
 void networkStartWiFi();
+void wifiBegin();
+void checkWiFi();
+bool wifiConnected();
 void networkStartAP();
 void networkDisconnectWiFi();
 unsigned long ntpSyncAgo();
 void cueNTP();
-int startNTP(bool synchronous);
+int startNTP();
 bool checkNTP();
 void clearNTPSyncLast();
 void networkStartAdmin();
 void networkStopAdmin();
+bool sendAdminPage(HttpOut &out, HttpRequest *r);
+void sendAdminSettingValue(Print &out, char type, byte loc);
+void sendAdminSettings(HttpOut &out);
+const __FlashStringHelper* adminSet(char *key, char *val, bool apply);
+const __FlashStringHelper* adminSetAll(char **keys, char **vals, byte count, byte *bad);
+int freeRAM();
+int heapPeak();
+void checkRAM();
+void sendMetric(HttpOut &out, const __FlashStringHelper *name, const __FlashStringHelper *type, long val, bool milli=false);
+void sendMetrics(HttpOut &out);
+void adminSyncResult(HttpOut &out, int ntpCode);
+bool adminPost(HttpOut &out, HttpRequest *r);
+void adminPatch(HttpOut &out, HttpRequest *r);
+void getMirror(byte *m);
+bool sendEvent(byte s);
+void adminSessionState(byte s, byte state);
+void adminSessionClose(byte s);
+bool adminUploadStart(byte s, const byte *buf, int len);
+bool adminRespond(byte s);
+void checkAdminSession(byte s);
 void checkClients();
 void initNetwork();
 void cycleNetwork();
+bool networkBusy();
 
 #endif //NETWORK_H
\ No newline at end of file
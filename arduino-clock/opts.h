@@ -0,0 +1,86 @@
+#ifndef OPTS_H
+#define OPTS_H
+
+//Settings menu schema - one entry per setting, in menu order, kept in flash. The menu (ctrlEvt(), fnOptScroll(),
+//doSet(), updateDisplay()), EEPROM init, and the admin page (sendAdminSettings()/adminSet() in network.cpp) all go by it,
+//via getOpt() and findOpt(). Included by the main sketch only.
+//Setting numbers/order can be changed (though try to avoid for user convenience);
+//but locs should be maintained so AVR EEPROM doesn't need reset after an upgrade (SAMD does it anyway).
+//Whether each one applies is worked out from the config at compile time (see traits.h) - if not, it's skipped in the
+//menu and left off the admin page, unless SHOW_IRRELEVANT_OPTIONS. See also the EEPROM map in the main sketch.
+
+//Signal patterns: the built-ins, and the custom tunes if they can be uploaded (see pattern.h)
+constexpr byte patternMax = PATTERN_BUILTINS-1+(hasNetwork? PATTERN_TUNES: 0);
+
+#define OPT(num,loc,fmt,def,mn,mx,applies) {num,loc,fmt,(mx>255?2:1),(SHOW_IRRELEVANT_OPTIONS || (applies)),def,mn,mx}
+constexpr OptDef opts[] PROGMEM = {
+  //  num loc format       default  min   max  applies
+  //General
+  OPT( 1, 16, FMT_NUM,        2,    1,    2, true), //time format
+  OPT( 2, 17, FMT_NUM,        1,    1,    5, ENABLE_DATE_FN), //date format
+  OPT( 3, 18, FMT_NUM,        0,    0,    3, ENABLE_DATE_FN), //display date during time
+  OPT( 4, 19, FMT_NUM,        0,    0,    1, true), //leading zeros
+  OPT( 5, 20, FMT_NUM,        5,    0,   20, hasNixie), //digit fade
+  OPT( 6, 22, FMT_NUM,        0,    0,    6, true), //auto DST
+  OPT( 7, 26, FMT_NUM,        1,    0,    4, hasBacklight), //backlight behavior
+  OPT( 8, 46, FMT_NUM,        0,    0,    2, hasNixie), //anti-cathode poisoning
+  OPT( 9, 45, FMT_NUM,        0,    0,    1, ENABLE_TEMP_FN || ENABLE_DATE_WEATHER), //temperature format
+  //Alarm
+  OPT(10, 23, FMT_NUM,        0,    0,    3, hasAlarm && ENABLE_ALARM_AUTOSKIP), //alarm days
+  OPT(11, 42, FMT_SIGNAL,     0,    0,    2, ENABLE_ALARM_FN && signalTypes>=2), //alarm signal
+  OPT(12, 39, FMT_PITCH,     76,   49,   88, ENABLE_ALARM_FN && hasPiezo), //alarm pitch
+  OPT(13, 47, FMT_PATTERN,    4,    0, patternMax, ENABLE_ALARM_FN && hasPiezo), //alarm pattern
+  OPT(14, 24, FMT_NUM,        9,    0,   60, hasAlarm), //snooze
+  OPT(15, 50, FMT_NUM,        0,    0,    1, hasFibonacci), //fibonacci mode
+  //Timer
+  OPT(21, 43, FMT_SIGNAL,     0,    0,    2, ENABLE_TIMER_FN && signalTypes>=2), //timer signal
+  OPT(22, 40, FMT_PITCH,     76,   49,   88, ENABLE_TIMER_FN && hasPiezo), //timer pitch
+  OPT(23, 48, FMT_PATTERN,    2,    0, patternMax, ENABLE_TIMER_FN && hasPiezo), //timer pattern
+  //Strike
+  OPT(30, 21, FMT_NUM,        0,    0,    4, hasChime), //strike
+  OPT(31, 44, FMT_SIGNAL,     0,    0,    2, hasChime && hasPiezo && hasPulse), //strike signal
+  OPT(32, 41, FMT_PITCH,     68,   49,   88, ENABLE_TIME_CHIME && hasPiezo), //strike pitch
+  OPT(33, 49, FMT_PATTERN,    5,    0, patternMax, ENABLE_TIME_CHIME && hasPiezo), //strike pattern
+  //Night and away shutoff
+  OPT(40, 27, FMT_NUM,        0,    0,    2, ENABLE_SHUTOFF_NIGHT), //night shutoff
+  OPT(41, 28, FMT_TOD,     1320,    0, 1439, ENABLE_SHUTOFF_NIGHT), //night start
+  OPT(42, 30, FMT_TOD,      360,    0, 1439, ENABLE_SHUTOFF_NIGHT), //night end
+  OPT(43, 32, FMT_NUM,        0,    0,    2, ENABLE_SHUTOFF_AWAY), //away shutoff
+  OPT(44, 33, FMT_NUM,        1,    0,    6, ENABLE_SHUTOFF_AWAY || (ENABLE_ALARM_FN && ENABLE_ALARM_AUTOSKIP)), //first day of workweek
+  OPT(45, 34, FMT_NUM,        5,    0,    6, ENABLE_SHUTOFF_AWAY || (ENABLE_ALARM_FN && ENABLE_ALARM_AUTOSKIP)), //last day of workweek
+  OPT(46, 35, FMT_TOD,      480,    0, 1439, ENABLE_SHUTOFF_AWAY), //work starts
+  OPT(47, 37, FMT_TOD,     1080,    0, 1439, ENABLE_SHUTOFF_AWAY), //work ends
+  //Geography - not the UTC offset, as that's also used when setting the clock from the network
+  OPT(50, 10, FMT_COORD,      0, -900,  900, hasGeography), //latitude
+  OPT(51, 12, FMT_COORD,      0,-1800, 1800, hasGeography), //longitude
+  OPT(52, 14, FMT_UTC,      100,   52,  156, true) //UTC offset
+};
+
+//Alarm record fields (AL_) for alarms 1 and up, by offset - num is unused, and loc is the offset within the record.
+//Alarm 0's are settings above, or in the EEPROM map in the main sketch (see alarmLoc()).
+constexpr OptDef alarmOpts[ALARM_SIZE] PROGMEM = {
+  //  num loc          format       default  min   max  applies
+  OPT( 0, AL_TIME,     FMT_TOD,      420,    0, 1439, true), //time
+  OPT( 0, AL_TIME+1,   FMT_NUM,        0,    0,    0, false), //(time, low byte)
+  OPT( 0, AL_ON,       FMT_NUM,        0,    0,    1, true), //on
+  OPT( 0, AL_DAYS,     FMT_NUM,      127,    1,  127, true), //days
+  OPT( 0, AL_SIGNAL,   FMT_SIGNAL,     0,    0,    2, true), //signal
+  OPT( 0, AL_PITCH,    FMT_PITCH,     76,   49,   88, true), //pitch
+  OPT( 0, AL_PATTERN,  FMT_PATTERN,    4,    0, patternMax, true), //pattern
+  OPT( 0, AL_FIB,      FMT_NUM,        0,    0,    1, true) //fibonacci mode
+};
+static_assert(sizeof(alarmOpts)/sizeof(alarmOpts[0])==ALARM_SIZE, "one entry per alarm record byte");
+#undef OPT
+constexpr byte optCount = sizeof(opts)/sizeof(opts[0]);
+
+//Index of settings by loc, so findOpt() needn't search - built at compile time from the schema
+#define OPT_LOCS 51 //settings are stored below this loc
+constexpr byte optAt(byte loc, byte i=0){ return (i>=optCount? 255: (opts[i].loc==loc? i: optAt(loc,i+1))); }
+#define OPT_AT10(l) optAt(l),optAt(l+1),optAt(l+2),optAt(l+3),optAt(l+4),optAt(l+5),optAt(l+6),optAt(l+7),optAt(l+8),optAt(l+9)
+const byte optsByLoc[OPT_LOCS] PROGMEM = { OPT_AT10(0), OPT_AT10(10), OPT_AT10(20), OPT_AT10(30), OPT_AT10(40), optAt(50) };
+#undef OPT_AT10
+
+constexpr bool optsIndexed(byte i=0){ return (i>=optCount? true: (opts[i].loc<OPT_LOCS && optAt(opts[i].loc)==i && optsIndexed(i+1))); }
+static_assert(optsIndexed(), "each setting needs its own loc, below OPT_LOCS");
+
+#endif //OPTS_H
@@ -0,0 +1,152 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#ifndef __AVR__ //only used by network.cpp - see there
+#ifdef OTA_KEY //see config
+
+#include "ota.h"
+//ArduinoOTA library by Juraj Andrassy - stages a new sketch in the upper half of flash, and copies it over the running one
+#include <InternalStorage.h>
+
+// Over-the-air firmware update. network.cpp hands the body of POST /update to otaWrite() as it arrives, a chunk per
+// cycle, so the clock keeps running during the upload and the image is never held in RAM. It's written straight to
+// the staging area and checksummed along the way; only if the CRC-32 matches what the client sent does it become
+// staged, to be copied over the running sketch by otaApply() on the way to a restart. Anything else leaves the running
+// sketch untouched. Note this means the sketch must fit in half the flash.
+// The staging area has to be erased before it's written, which takes a few ms per row - a second or more for a whole
+// image. InternalStorage.open() would do it all at once, stopping the display and timekeeping, so on SAMD we erase it
+// ourselves, a row per cycle (see otaReady()), and write it the same way InternalStorage does; it's still what installs
+// the image. Elsewhere, we leave it all to InternalStorage.
+
+byte otaState = OTA_IDLE;
+unsigned long otaLen = 0; //expected image size
+unsigned long otaPos = 0; //bytes written so far
+unsigned long otaCRC = 0; //running CRC-32
+byte otaPending[OTA_PENDING_MAX]; //the start of the image, if it arrives before the staging area is erased
+word otaPendingLen = 0;
+
+#ifdef ARDUINO_ARCH_SAMD
+#ifndef OTA_STAGE_ADDR
+#define OTA_STAGE_ADDR (0x2000+InternalStorage.maxSize()) //where InternalStorage stages the image: past the bootloader (8K) and the running sketch's half
+#endif
+#define OTA_PAGE 64 //NVM page - written whole, once its last word is written
+#define OTA_ROW (OTA_PAGE*4) //NVM row - the unit of erase
+unsigned long otaErased = 0; //bytes of staging area erased so far
+union { uint32_t u32; byte u8[4]; } otaWord; //bytes waiting to be written as a word
+
+void otaFlashWait(){ //"private"
+  while(!NVMCTRL->INTFLAG.bit.READY);
+}
+void otaEraseRow(){ //"private"
+  NVMCTRL->ADDR.reg = (OTA_STAGE_ADDR+otaErased)/2; //in 16-bit words
+  NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_ER;
+  otaFlashWait();
+  otaErased += OTA_ROW;
+}
+void otaFlashByte(byte b, unsigned long pos){ //"private"
+  otaWord.u8[pos%4] = b;
+  if(pos%4==3){ ((volatile uint32_t*)(OTA_STAGE_ADDR))[pos/4] = otaWord.u32; otaFlashWait(); }
+}
+#endif
+
+unsigned long crc32Update(unsigned long crc, byte b){ //"private"
+  //One byte of CRC-32 as used by zlib/gzip (and so the crc32 command) - bitwise rather than a table, to save memory.
+  //Start with 0xFFFFFFFF and invert the result.
+  crc ^= b;
+  for(byte i=0; i<8; i++) crc = (crc>>1) ^ (0xEDB88320 & (0-(crc&1)));
+  return crc;
+}
+
+bool otaKeyOk(const char *auth){
+  //Checks the Authorization header value, which should be "Bearer " followed by OTA_KEY.
+  //Compares the whole thing regardless of where it differs, so the time taken doesn't give away how much was right.
+  const char *key = OTA_KEY;
+  if(strncmp(auth,"Bearer ",7)) return false;
+  auth += 7;
+  byte diff = (strlen(auth)!=strlen(key));
+  for(byte i=0; auth[i] && key[i]; i++) diff |= auth[i]^key[i];
+  return !diff && key[0];
+}
+
+bool otaBegin(unsigned long len){
+  //Starts a new image of len bytes, discarding any previous one. Returns false if it won't fit.
+  if(!len || (long)len>InternalStorage.maxSize()) return false;
+  otaLen = len; otaPos = 0; otaCRC = 0xFFFFFFFF; otaPendingLen = 0;
+  #ifdef ARDUINO_ARCH_SAMD
+  otaErased = 0;
+  otaState = OTA_ERASING; //see otaReady()
+  #else
+  if(!InternalStorage.open(len)) return false;
+  otaState = OTA_RECEIVING;
+  #endif
+  return true;
+}
+
+bool otaReady(){
+  //Called on every cycle while an image is coming in. Returns whether otaWrite() can take it yet - if the staging area
+  //is still being erased, erases the next row of it.
+  #ifdef ARDUINO_ARCH_SAMD
+  if(otaState==OTA_ERASING){
+    otaEraseRow();
+    if(otaErased<otaLen) return false;
+    otaState = OTA_RECEIVING;
+    otaWrite(otaPending,otaPendingLen);
+  }
+  #endif
+  return otaState==OTA_RECEIVING;
+}
+
+void otaWrite(const byte *buf, int len){
+  //Writes the next chunk of the image - anything past the expected size is ignored. Before otaReady(), only enough
+  //to fill otaPending is taken.
+  if(otaState==OTA_ERASING){
+    for(int i=0; i<len && otaPendingLen<OTA_PENDING_MAX; i++) otaPending[otaPendingLen++] = buf[i];
+    return;
+  }
+  if(otaState!=OTA_RECEIVING) return;
+  #ifdef ARDUINO_ARCH_SAMD
+  NVMCTRL->CTRLB.bit.MANW = 0; //write each page once it's full - in case storage has changed this since
+  #endif
+  for(int i=0; i<len && otaPos<otaLen; i++){
+    #ifdef ARDUINO_ARCH_SAMD
+    otaFlashByte(buf[i],otaPos);
+    #else
+    InternalStorage.write(buf[i]);
+    #endif
+    otaCRC = crc32Update(otaCRC,buf[i]);
+    otaPos++;
+  }
+}
+
+unsigned long otaReceived(){ return otaPos; }
+
+bool otaEnd(unsigned long crc){
+  //Image is complete - stage it if it's intact, per the client's CRC-32
+  if(otaState!=OTA_RECEIVING) return false;
+  #ifdef ARDUINO_ARCH_SAMD
+  for(unsigned long pos=otaPos; pos%OTA_PAGE; pos++) otaFlashByte(0xFF,pos); //fill out the last page, so it's written
+  #else
+  InternalStorage.close();
+  #endif
+  if(otaPos!=otaLen || (otaCRC^0xFFFFFFFF)!=crc){ otaAbort(); return false; }
+  otaState = OTA_STAGED;
+  return true;
+}
+
+void otaAbort(){
+  #ifndef ARDUINO_ARCH_SAMD
+  if(otaState==OTA_RECEIVING) InternalStorage.close();
+  InternalStorage.clear();
+  #endif
+  otaState = OTA_IDLE; //on SAMD, what's been written stays in the staging area, but can't be applied
+}
+
+bool otaStaged(){ return otaState==OTA_STAGED; }
+
+void otaApply(){
+  //Copies the staged image over the running sketch and restarts - doesn't return
+  if(otaState==OTA_STAGED) InternalStorage.apply();
+}
+
+#endif //OTA_KEY
+#endif //__AVR__
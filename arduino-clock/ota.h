@@ -0,0 +1,25 @@
+#ifndef OTA_H
+#define OTA_H
+
+//Over-the-air firmware update, fed by POST /update in network.cpp. See ota.cpp.
+
+//States
+#define OTA_IDLE 0
+#define OTA_RECEIVING 1 //image is being written to the staging area
+#define OTA_STAGED 2 //complete and verified - otaApply() will install it
+#define OTA_ERASING 3 //staging area is being erased, a row per cycle - see otaReady()
+
+#define OTA_PENDING_MAX 128 //start of the image that can arrive with the headers, before the staging area is ready for it
+
+unsigned long crc32Update(unsigned long crc, byte b);
+bool otaKeyOk(const char *auth);
+bool otaBegin(unsigned long len);
+bool otaReady();
+void otaWrite(const byte *buf, int len);
+unsigned long otaReceived();
+bool otaEnd(unsigned long crc);
+void otaAbort();
+bool otaStaged();
+void otaApply();
+
+#endif //OTA_H
@@ -0,0 +1,212 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#include "pattern.h"
+#include "piezo.h"
+#include "storage.h"
+#include "pintrace.h" //to note the measure, if PIN_TRACE
+
+// Signal patterns. Each pattern is a little program that plays one measure of a signal: notes relative to the signal
+// pitch, lengths and gaps in fractions of the measure, repeats, and arpeggiated chords (see ops in pattern.h).
+// The built-in patterns live in flash; up to PATTERN_TUNES custom tunes, uploaded via the admin page (POST /tunes),
+// live in spare EEPROM/flash past the settings, and are read from there as they play - so a tune costs no RAM.
+// cycleSignal() calls patternStep() to queue the measure to the piezo sequencer one note at a time, as there's room,
+// so a tune can have more notes than the sequencer's queue. Each note is held until the next one is found, since the
+// last note of a measure is followed by the rest of it.
+
+const byte patternBuiltin[] PROGMEM = {
+  PAT_LEN,120, PAT_NOTE, PAT_END, //0 long (one 1/2-second beep)
+  PAT_LEN,60, PAT_NOTE, PAT_END, //1 short (one 1/4-second beep)
+  PAT_LEN,30, PAT_GAP,30, PAT_NOTE, PAT_NOTE, PAT_END, //2 double (two 1/8-second beeps)
+  PAT_LEN,20, PAT_GAP,20, PAT_NOTE, PAT_NOTE, PAT_NOTE, PAT_END, //3 triple (three 1/12-second beeps)
+  PAT_LEN,15, PAT_GAP,15, PAT_NOTE, PAT_NOTE, PAT_NOTE, PAT_NOTE, PAT_END, //4 quad (four 1/16-second beeps)
+  PAT_LEN,30, PAT_GAP,30, PAT_NOTE, PAT_NOTE-4, PAT_END, //5 cuckoo (two 1/8-second beeps, down a major third)
+  PAT_LEN,24, PAT_NOTE, PAT_END, //the pips (100ms)...
+  PAT_LEN,120, PAT_NOTE, PAT_END //...except the last (500ms)
+};
+
+#define PAT_SRC_BUILTIN 0
+#define PAT_SRC_TUNES 1
+#define PAT_SRC_UPLOAD 2
+
+//The measure being played
+bool patGoing = false; //whether a measure is under way
+byte patSrc; //where its program is - PAT_SRC_
+word patPos; //next op
+word patMeasure; //ms
+byte patLen, patGap; //per PAT_LEN/PAT_GAP
+word patMark; byte patLoops = 255; //repeat start, and repeats left (255 if not repeating yet)
+byte patArp = 0; word patArpFirst; byte patArpNext; word patArpLeft; //chord: notes, where they are, which is next, ms left
+byte patPendOff; word patPendDur = 0, patPendGap, patPendStart; //the note held back, and when it starts in the measure
+
+const byte *patUpload; //for checking an upload before it's saved
+
+byte patternByte(byte src, word pos){ //"private"
+  if(src==PAT_SRC_TUNES) return readEEPROMDirect(PATTERN_TUNE_LOC+pos);
+  if(src==PAT_SRC_UPLOAD) return patUpload[pos];
+  return pgm_read_byte(&patternBuiltin[pos]);
+}
+
+word patternCheck(byte src, word pos, word end){ //"private"
+  //Returns the length of the program at pos, through its PAT_END, or 0 if it isn't valid or runs past end.
+  //An empty program (PAT_END alone) is valid; otherwise it must have a note, and no rest before it.
+  bool notes = false, mark = false; byte arp = 0;
+  for(word i=pos; i<end; i++){
+    byte op = patternByte(src,i);
+    if(arp){ if(op==PAT_END || op>=PAT_REST) return 0; arp--; continue; } //a chord has only notes
+    if(op==PAT_END) return (notes || i==pos? i+1-pos: 0);
+    if(op<PAT_REST) notes = true;
+    else if(op==PAT_REST){ if(!notes) return 0; }
+    else if(op<=PAT_MEASURE){
+      if(op==PAT_MEASURE && i!=pos) return 0;
+      if(++i>=end) return 0;
+      if(op!=PAT_GAP && !patternByte(src,i)) return 0;
+    }
+    else if(op<PAT_MARK){ arp = op-PAT_ARP; notes = true; }
+    else if(op==PAT_MARK) mark = true;
+    else if(op<0x60){ if(!mark) return 0; mark = false; }
+    else return 0; //not an op
+  }
+  return 0;
+}
+
+int patternFind(byte src, byte n, word end){ //"private"
+  //Returns where program n starts, or -1 if it's missing or empty (or it, or one before it, isn't valid)
+  word pos = 0;
+  for(byte i=0; i<=n; i++){
+    word len = patternCheck(src,pos,end);
+    if(!len) return -1;
+    if(i==n) return (len>1? pos: -1);
+    pos += len;
+  }
+  return -1;
+}
+
+int patternResolve(byte pattern, bool last, byte *src){ //"private"
+  //Finds the program for pattern - falling back to short if it's a tune that isn't there
+  int pos = -1;
+  if(pattern>=PATTERN_BUILTINS && pattern<PATTERN_BUILTINS+PATTERN_TUNES){
+    *src = PAT_SRC_TUNES; pos = patternFind(PAT_SRC_TUNES,pattern-PATTERN_BUILTINS,PATTERN_TUNE_SPACE);
+  }
+  if(pos<0){
+    *src = PAT_SRC_BUILTIN;
+    pos = patternFind(PAT_SRC_BUILTIN,(pattern==PATTERN_PIPS? (last? 7: 6): (pattern<PATTERN_BUILTINS? pattern: 1)),sizeof(patternBuiltin));
+  }
+  return pos;
+}
+
+word patternMeasure(byte pattern){
+  //How long a measure of pattern is, ms
+  byte src; int pos = patternResolve(pattern,false,&src);
+  return (patternByte(src,pos)==PAT_MEASURE? patternByte(src,pos+1)*50: 1000);
+}
+
+void patternReset(){
+  //Forgets the measure under way, e.g. when a signal stops
+  patGoing = false;
+}
+
+word patternHz(word hz, byte op){ //"private"
+  return (op==PAT_NOTE? hz: hz*pow(2,((int)op-PAT_NOTE)/12.0));
+}
+
+byte patternStep(byte pattern, word hz, bool last){
+  //Queues the next note of pattern's measure at hz (the signal pitch) - starting a new measure if there isn't one under way.
+  //If last, the measure ends with its last note, rather than the rest of the measure.
+  //Returns 0 if the sequencer has no room, 2 if that was the measure's last note, 1 otherwise.
+  if(!piezoRoom()) return 0;
+  if(!patGoing){
+    int pos = patternResolve(pattern,last,&patSrc);
+    patMeasure = 1000;
+    if(patternByte(patSrc,pos)==PAT_MEASURE){ patMeasure = patternByte(patSrc,pos+1)*50; pos += 2; }
+    #ifdef PIN_TRACE
+    pinTraceMeasure(patMeasure);
+    #endif
+    patPos = pos; patLen = 60; patGap = 0; patLoops = 255; patArp = 0; patPendOff = PAT_NOTE; patPendDur = 0;
+    patGoing = true;
+  }
+  while(true){
+    byte off; word dur, gap;
+    if(patArp){ //a slice of the next note of the chord
+      off = patternByte(patSrc,patArpFirst+patArpNext);
+      dur = (patArpLeft<PATTERN_ARP_MS? patArpLeft: PATTERN_ARP_MS);
+      patArpLeft -= dur;
+      patArpNext = (patArpNext+1)%patArp;
+      gap = (patArpLeft? 0: (unsigned long)patMeasure*patGap/240);
+      if(!patArpLeft) patArp = 0;
+    } else {
+      byte op = patternByte(patSrc,patPos++);
+      if(op==PAT_END){ //queue the held note, followed by the rest of the measure
+        unsigned long end = (unsigned long)patPendStart+patPendDur;
+        piezoQueue(patternHz(hz,patPendOff),patPendDur,(last || end>=patMeasure? 0: patMeasure-end),true);
+        patGoing = false;
+        return 2;
+      }
+      if(op<PAT_REST){
+        off = op;
+        dur = (unsigned long)patMeasure*patLen/240;
+        gap = (unsigned long)patMeasure*patGap/240;
+      }
+      else {
+        if(op==PAT_REST){ if(patPendDur) patPendGap += (unsigned long)patMeasure*(patLen+patGap)/240; }
+        else if(op<=PAT_MEASURE){ byte val = patternByte(patSrc,patPos++); if(op==PAT_LEN) patLen = val; else if(op==PAT_GAP) patGap = val; }
+        else if(op<PAT_MARK){
+          patArp = op-PAT_ARP; patArpFirst = patPos; patArpNext = 0;
+          patArpLeft = (unsigned long)patMeasure*patLen/240;
+          patPos += patArp;
+          if(!patArpLeft) patArp = 0;
+        }
+        else if(op==PAT_MARK){ patMark = patPos; patLoops = 255; }
+        else { //repeat
+          if(patLoops==255) patLoops = op-PAT_MARK;
+          if(patLoops){ patLoops--; patPos = patMark; }
+          else patLoops = 255;
+        }
+        continue;
+      }
+    }
+    if(!dur) continue;
+    //Now we know when the held note ends, queue it, and hold this one
+    bool queued = patPendDur;
+    if(queued) piezoQueue(patternHz(hz,patPendOff),patPendDur,patPendGap);
+    patPendStart = (queued? patPendStart+patPendDur+patPendGap: 0);
+    patPendOff = off; patPendDur = dur; patPendGap = gap;
+    if(queued) return 1;
+  }
+}
+
+int patternSaveTunes(const byte *buf, word len){
+  //Replaces the custom tunes with buf: up to PATTERN_TUNES programs, one after another (an empty one keeps its place).
+  //Returns how many, or -1 if they aren't valid, or -2 if there are too many or they're too long.
+  if(len>PATTERN_TUNE_SPACE) return -2;
+  patUpload = buf;
+  word pos = 0; byte n = 0;
+  while(pos<len){
+    if(n>=PATTERN_TUNES) return -2;
+    word tl = patternCheck(PAT_SRC_UPLOAD,pos,len);
+    if(!tl) return -1;
+    pos += tl; n++;
+  }
+  for(word i=0; i<len; i++) writeEEPROMDirect(PATTERN_TUNE_LOC+i,buf[i],false);
+  if(len<PATTERN_TUNE_SPACE) writeEEPROMDirect(PATTERN_TUNE_LOC+len,255,false); //no more
+  commitEEPROM();
+  patternReset(); //in case a tune is playing
+  return n;
+}
+
+void patternDumpTunes(Print &out){
+  //Writes out the custom tunes, as they'd be given to patternSaveTunes()
+  word pos = 0;
+  for(byte n=0; n<PATTERN_TUNES; n++){
+    word tl = patternCheck(PAT_SRC_TUNES,pos,PATTERN_TUNE_SPACE);
+    if(!tl) break;
+    for(word i=0; i<tl; i++) out.write(readEEPROMDirect(PATTERN_TUNE_LOC+pos+i));
+    pos += tl;
+  }
+}
+
+bool patternClearTunes(){
+  //Forgets the custom tunes, e.g. on a hard reset. Returns whether that changed anything.
+  patternReset();
+  return writeEEPROMDirect(PATTERN_TUNE_LOC,255,false);
+}
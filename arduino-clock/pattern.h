@@ -0,0 +1,31 @@
+#ifndef PATTERN_H
+#define PATTERN_H
+
+//Signal patterns - a measure of beeps, as a compact bytecode played by the piezo sequencer. See pattern.cpp.
+
+#define PATTERN_BUILTINS 6 //patterns 0-5 are built in...
+#define PATTERN_TUNES 4 //...and 6-9 are custom tunes, uploaded via the admin page
+#define PATTERN_PIPS 255 //the pips - see signalStart()
+#define PATTERN_TUNE_LOC 256 //custom tunes are kept in EEPROM/flash from here...
+#define PATTERN_TUNE_SPACE 256 //...for this many bytes - read directly, not via storageBytes (see storage.cpp)
+#define PATTERN_ARP_MS 40 //each note of a chord sounds for this long in turn
+
+//Bytecode ops. Durations are in 240ths of a measure, so halves through sixteenths (and triplets) come out even.
+#define PAT_END 0x00 //end of the measure - the last note is followed by the rest of it
+#define PAT_NOTE 0x20 //0x01-0x3F: a note, op-PAT_NOTE semitones from the signal pitch, for the current length then gap
+#define PAT_REST 0x40 //silence, for the current length and gap
+#define PAT_LEN 0x41 //+1 byte: note length, 1-255 (default 60, a quarter)
+#define PAT_GAP 0x42 //+1 byte: gap after each note, 0-255 (default 0)
+#define PAT_MEASURE 0x43 //+1 byte: measure length, in 50ms, 1-255 (default 1000ms) - first op only
+#define PAT_ARP 0x42 //0x44-0x4F: the next op-PAT_ARP (2-13) notes are a chord, sounded by turns for the current length
+#define PAT_MARK 0x50 //start of a repeat...
+//0x51-0x5F: ...which goes back to PAT_MARK op-PAT_MARK more times
+
+void patternReset();
+byte patternStep(byte pattern, word hz, bool last);
+word patternMeasure(byte pattern);
+int patternSaveTunes(const byte *buf, word len);
+void patternDumpTunes(Print &out);
+bool patternClearTunes();
+
+#endif //PATTERN_H
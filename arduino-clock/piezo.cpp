@@ -0,0 +1,190 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#include "piezo.h"
+#include "pintrace.h" //to record beeps, if PIN_TRACE
+
+// Piezo beeper sequencer. Rather than starting each beep with tone() whenever the loop gets around to it - which makes
+// beep onsets jitter by the length of the loop, or much worse during a Wi-Fi hang - cycleSignal() queues up whole
+// measures of beeps (pitch, duration, and the gap after), and a timer interrupt plays them back to back. The interrupt
+// toggles the pin at twice the pitch frequency while a beep sounds (as tone() does), counting half-periods to time it,
+// and ticks every PIEZO_REST_US while silent, so each onset lands within a tick of when it should. The durations are
+// worked out when queued, so the interrupt only has to count.
+// This takes the timer tone() would use (Timer2 on AVR, TC5 on SAMD), so tone() must not be used alongside it.
+
+#if !defined(__AVR__) && !defined(ARDUINO_ARCH_SAMD)
+#error "The piezo sequencer supports AVR and SAMD boards only"
+#endif
+
+volatile PiezoNote piezoNotes[PIEZO_QUEUE_SIZE];
+volatile byte piezoHead = 0; //next slot piezoQueue() will write
+volatile byte piezoTail = 0; //note playing, or next to play
+volatile byte piezoPhase = 0; //0=idle, 1=sounding, 2=resting
+volatile word piezoLeft = 0; //toggles or ticks left in this phase
+volatile byte piezoMarks = 0; //marked notes done, since piezoMeasuresDone() last looked
+
+#ifdef __AVR__
+//Timer2 in CTC mode, interrupting on compare match A. The pin is toggled by writing its bit to the PIN register.
+const word piezoPrescales[] = {1,8,32,64,128,256,1024}; //per CS2 bits 1-7
+#define PIEZO_REST_TOP (F_CPU/32/(1000000/PIEZO_REST_US)-1)
+#define PIEZO_REST_PRE 3 //prescale 32
+volatile byte *piezoPinReg;
+volatile byte *piezoOutReg;
+byte piezoPinMask;
+void piezoRate(word top, byte pre){ //"private"
+  TCCR2B = pre; OCR2A = top; TCNT2 = 0; //setting the prescaler starts the clock
+}
+void piezoRun(bool on){ //"private"
+  if(on) TIMSK2 |= _BV(OCIE2A); //clock is started by piezoRate()
+  else { TIMSK2 &= ~_BV(OCIE2A); TCCR2B = 0; }
+}
+#define piezoToggle() (*piezoPinReg = piezoPinMask)
+#define piezoLow() (*piezoOutReg &= ~piezoPinMask)
+unsigned long piezoFit(unsigned long rate, word *top, byte *pre){ //"private"
+  //Finds the timer settings nearest to rate (interrupts per second), and returns the rate they actually give
+  for(byte i=0; i<7; i++){
+    unsigned long t = F_CPU/piezoPrescales[i]/rate;
+    if(t>256 && i<6) continue;
+    *top = (t<1? 0: (t>256? 255: t-1)); *pre = i+1;
+    return F_CPU/piezoPrescales[i]/(*top+1);
+  }
+  return 0; //not reached
+}
+ISR(TIMER2_COMPA_vect){ piezoTick(); }
+
+#else //ARDUINO_ARCH_SAMD
+//TC5 in 16-bit match frequency mode, at the CPU clock / 16, interrupting on match 0.
+#define PIEZO_CLOCK (SystemCoreClock/16)
+#define PIEZO_REST_TOP (PIEZO_CLOCK/(1000000/PIEZO_REST_US)-1)
+#define PIEZO_REST_PRE 0
+PortGroup *piezoPort;
+uint32_t piezoPinMask;
+void piezoSync(){ //"private"
+  while(TC5->COUNT16.STATUS.bit.SYNCBUSY);
+}
+void piezoRate(word top, byte pre){ //"private"
+  TC5->COUNT16.CC[0].reg = top; piezoSync();
+  TC5->COUNT16.COUNT.reg = 0; piezoSync();
+}
+void piezoRun(bool on){ //"private"
+  if(on) TC5->COUNT16.CTRLA.reg |= TC_CTRLA_ENABLE;
+  else TC5->COUNT16.CTRLA.reg &= ~TC_CTRLA_ENABLE;
+  piezoSync();
+}
+#define piezoToggle() (piezoPort->OUTTGL.reg = piezoPinMask)
+#define piezoLow() (piezoPort->OUTCLR.reg = piezoPinMask)
+unsigned long piezoFit(unsigned long rate, word *top, byte *pre){ //"private"
+  unsigned long t = PIEZO_CLOCK/rate;
+  *top = (t<1? 0: (t>65536? 65535: t-1)); *pre = 0;
+  return PIEZO_CLOCK/(*top+1);
+}
+void TC5_Handler(){ TC5->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0; piezoTick(); }
+#endif
+
+void piezoInit(){
+  if(!hasPiezo) return;
+  #ifdef __AVR__
+    piezoPinReg = portInputRegister(digitalPinToPort(PIEZO_PIN));
+    piezoOutReg = portOutputRegister(digitalPinToPort(PIEZO_PIN));
+    piezoPinMask = digitalPinToBitMask(PIEZO_PIN);
+    TCCR2B = 0; TCCR2A = _BV(WGM21); //stopped, in CTC mode
+  #else
+    piezoPort = &PORT->Group[g_APinDescription[PIEZO_PIN].ulPort];
+    piezoPinMask = (1ul<<g_APinDescription[PIEZO_PIN].ulPin);
+    GCLK->CLKCTRL.reg = (uint16_t)(GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK0 | GCLK_CLKCTRL_ID_TC4_TC5);
+    while(GCLK->STATUS.bit.SYNCBUSY);
+    TC5->COUNT16.CTRLA.reg = TC_CTRLA_SWRST;
+    while(TC5->COUNT16.CTRLA.bit.SWRST);
+    TC5->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_WAVEGEN_MFRQ | TC_CTRLA_PRESCALER_DIV16;
+    piezoSync();
+    TC5->COUNT16.INTENSET.reg = TC_INTENSET_MC0;
+    NVIC_EnableIRQ(TC5_IRQn);
+  #endif
+}
+
+bool piezoQueue(word hz, word dur, word gap, bool mark){
+  //Queues a beep at hz for dur ms, followed by gap ms of silence; starts playing if idle.
+  //If mark, it counts toward piezoMeasuresDone() once it and its gap are done.
+  //Returns false if there's no room (see piezoRoom()).
+  if(!hasPiezo || !hz) return false;
+  byte next = (piezoHead+1)&(PIEZO_QUEUE_SIZE-1);
+  if(next==piezoTail) return false; //full
+  volatile PiezoNote *n = &piezoNotes[piezoHead];
+  word top; byte pre;
+  unsigned long rate = piezoFit(2UL*hz,&top,&pre); //toggles per second
+  n->top = top; n->pre = pre;
+  unsigned long sound = (unsigned long)dur*rate/1000; if(!sound) sound = 1; if(sound>65535) sound = 65535;
+  n->sound = sound;
+  //The rest makes up the difference between the beep as played (whole half-periods) and dur, so measures keep time
+  unsigned long soundUs = (sound*1000/rate)*1000 + ((sound*1000)%rate)*1000/rate;
+  long restUs = ((long)dur+gap)*1000 - (long)soundUs;
+  n->rest = (restUs<=0? 0: (restUs+PIEZO_REST_US/2)/PIEZO_REST_US);
+  n->mark = mark;
+  noInterrupts();
+  piezoHead = next; //only now can piezoTick() see it
+  if(!piezoPhase) piezoLoad();
+  interrupts();
+  return true;
+}
+
+byte piezoRoom(){
+  //How many more notes can be queued
+  return (piezoTail-piezoHead-1)&(PIEZO_QUEUE_SIZE-1);
+}
+
+bool piezoPlaying(){
+  return piezoPhase;
+}
+
+byte piezoMeasuresDone(){
+  //How many marked notes have finished since last call
+  noInterrupts(); byte m = piezoMarks; piezoMarks = 0; interrupts();
+  return m;
+}
+
+void piezoStop(){
+  //Silences the piezo and forgets the queue
+  if(!hasPiezo) return;
+  noInterrupts();
+  piezoRun(false); piezoLow();
+  #ifdef PIN_TRACE
+  pinTraceLocked(PIEZO_PIN,0);
+  #endif
+  piezoPhase = 0; piezoTail = piezoHead; piezoMarks = 0;
+  interrupts();
+}
+
+void piezoLoad(){ //"private"
+  //Starts the note at piezoTail, or stops the timer if there are none. Runs in the interrupt, or with interrupts off.
+  if(piezoTail==piezoHead){ piezoRun(false); piezoPhase = 0; return; }
+  volatile PiezoNote *n = &piezoNotes[piezoTail];
+  piezoRate(n->top,n->pre);
+  piezoLeft = n->sound;
+  if(!piezoPhase) piezoRun(true);
+  piezoPhase = 1;
+  #ifdef PIN_TRACE
+  pinTraceLocked(PIEZO_PIN,1); //onset - the toggles themselves are too fast to record
+  #endif
+}
+
+void piezoTick(){ //"private"
+  //Runs in the timer interrupt - plays the note at piezoTail, then its rest, then moves on
+  if(piezoPhase==1){ //sounding
+    piezoToggle();
+    if(--piezoLeft) return;
+    piezoLow();
+    #ifdef PIN_TRACE
+    pinTraceLocked(PIEZO_PIN,0);
+    #endif
+    piezoLeft = piezoNotes[piezoTail].rest;
+    piezoPhase = 2;
+    if(piezoLeft){ piezoRate(PIEZO_REST_TOP,PIEZO_REST_PRE); return; }
+  }
+  else if(piezoPhase==2){ //resting
+    if(--piezoLeft) return;
+  }
+  else return; //stray
+  if(piezoNotes[piezoTail].mark) piezoMarks++;
+  piezoTail = (piezoTail+1)&(PIEZO_QUEUE_SIZE-1); //only now can piezoQueue() reuse the slot
+  piezoLoad();
+}
@@ -0,0 +1,30 @@
+#ifndef PIEZO_H
+#define PIEZO_H
+
+//Piezo beeper sequencer - plays queued beeps from a timer interrupt, so their timing doesn't depend on the loop. See piezo.cpp.
+
+#ifdef __AVR__
+  #define PIEZO_QUEUE_SIZE 8 //beeps that can wait to be played - must be a power of 2
+#else
+  #define PIEZO_QUEUE_SIZE 16 //enough for a few measures, to ride out a stalled loop (e.g. a Wi-Fi reconnect)
+#endif
+#define PIEZO_REST_US 250 //timer tick while silent between beeps, µs
+
+struct PiezoNote {
+  word top; //timer compare value for the pitch
+  byte pre; //timer prescaler bits for the pitch (AVR only)
+  word sound; //pin toggles (half-periods) to play
+  word rest; //PIEZO_REST_US ticks of silence after
+  bool mark; //counts in piezoMeasuresDone() when done
+};
+
+void piezoInit();
+bool piezoQueue(word hz, word dur, word gap, bool mark=false);
+byte piezoRoom();
+bool piezoPlaying();
+byte piezoMeasuresDone();
+void piezoStop();
+void piezoLoad();
+void piezoTick();
+
+#endif //PIEZO_H
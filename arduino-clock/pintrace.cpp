@@ -0,0 +1,158 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#include "pintrace.h"
+
+// Output pin recorder, for seeing the nixie multiplex and the signal outputs without a logic analyzer. Writes made via
+// pinWrite()/pinAnalogWrite() - the anodes and cathode drivers (dispNixie.cpp), the switch, pulse and backlight outputs
+// (main code) - are recorded with the time (micros), but only when the pin's level actually changes. The piezo is
+// toggled by a timer interrupt at audio rates, too fast to record, so piezo.cpp records each beep as a whole instead:
+// 1 when it starts sounding, 0 when it stops. The latest PIN_TRACE changes are kept in a ring buffer. The multiplex
+// changes some 30 pins per frame, so it fills the buffer in a fraction of a second - to trace the signals over several
+// measures while the display is running, set PIN_TRACE_ROLES in config to record only those (e.g. PINTRACE_SIGNALS).
+// On Wi-Fi clocks, GET /pintrace returns them as a header followed by records, oldest first. Record layout, little-endian:
+//   0-3 micros, 4 pin, 5 value (0/1, or 0-255 for analogWrite)
+// The header gives the pin for each role (255 if none, or not recorded), so extras/pintrace/pintrace.py can tell them
+// apart, and the measure of the latest signal pattern (ms, little-endian), since patterns may set their own (see
+// PAT_MEASURE). It converts the trace to VCD (for GTKWave etc.), and works out tube duty cycles, frame rate, dead time,
+// and beep onset jitter.
+// On any clock, sending 't' over serial (at 115200) writes the trace out as VCD directly.
+
+void pinWrite(byte pin, byte val){
+  digitalWrite(pin,val);
+  #ifdef PIN_TRACE
+  pinTrace(pin,val);
+  #endif
+}
+void pinAnalogWrite(byte pin, byte val){
+  analogWrite(pin,val);
+  #ifdef PIN_TRACE
+  pinTrace(pin,val);
+  #endif
+}
+
+#ifdef PIN_TRACE //see config
+#if PIN_TRACE>250
+#error "PIN_TRACE can be at most 250"
+#endif
+#ifndef PIN_TRACE_ROLES
+#define PIN_TRACE_ROLES PINTRACE_ALL
+#endif
+
+//Pin for each role, per config - in the order of pinTraceNames
+#ifdef DISP_NIXIE
+const int8_t pinTraceRoles[PINTRACE_ROLES] = {ANODE_1,ANODE_2,ANODE_3,OUT_A1,OUT_A2,OUT_A3,OUT_A4,OUT_B1,OUT_B2,OUT_B3,OUT_B4,PIEZO_PIN,SWITCH_PIN,PULSE_PIN,BACKLIGHT_PIN};
+#else
+const int8_t pinTraceRoles[PINTRACE_ROLES] = {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,PIEZO_PIN,SWITCH_PIN,PULSE_PIN,BACKLIGHT_PIN};
+#endif
+const char pinTraceNames[] PROGMEM = "anode1 anode2 anode3 cathA1 cathA2 cathA3 cathA4 cathB1 cathB2 cathB3 cathB4 piezo switch pulse backlight";
+#define PINTRACE_WIDE 14 //role recorded as 0-255 - the rest are 0/1
+
+byte pinTraceBuf[PIN_TRACE*PINTRACE_RECORD];
+volatile byte pinTraceHead = 0; //next record to write
+volatile byte pinTraceCount = 0;
+byte pinTraceLast[PINTRACE_PINS]; //last value recorded per pin, to skip writes that don't change it
+unsigned long pinTracePins = 0; //pins below PINTRACE_PINS with a role in PIN_TRACE_ROLES, a bit each
+volatile bool pinTraceHeld = false; //while it's being written out
+word pinTraceMeasureMs = 1000; //measure of the latest signal pattern - see pinTraceMeasure()
+
+int8_t pinTraceRole(byte r){ //"private"
+  //Pin for role r, or -1 if none or it isn't in PIN_TRACE_ROLES
+  return (bitRead((unsigned long)PIN_TRACE_ROLES,r)? pinTraceRoles[r]: -1);
+}
+
+bool pinTraceWanted(byte pin){ //"private"
+  for(byte r=0; r<PINTRACE_ROLES; r++) if(pinTraceRole(r)==pin) return true; //never matches -1
+  return false;
+}
+
+void pinTraceInit(){
+  for(byte i=0; i<PINTRACE_PINS; i++){
+    pinTraceLast[i] = 255; //unknown - first write is always recorded
+    if(pinTraceWanted(i)) pinTracePins |= 1UL<<i;
+  }
+  Serial.begin(115200);
+}
+
+void pinTraceLocked(byte pin, byte val){
+  //Records a pin change. Interrupts must be off (or we're in one) - the piezo interrupt records too.
+  if(pinTraceHeld) return;
+  if(pin<PINTRACE_PINS){ if(!bitRead(pinTracePins,pin) || pinTraceLast[pin]==val) return; pinTraceLast[pin] = val; }
+  else if(!pinTraceWanted(pin)) return;
+  byte *p = pinTraceBuf+(pinTraceHead*PINTRACE_RECORD);
+  unsigned long us = micros();
+  for(byte i=0; i<4; i++){ p[i] = us&0xFF; us >>= 8; }
+  p[4] = pin; p[5] = val;
+  pinTraceHead = (pinTraceHead+1)%PIN_TRACE;
+  if(pinTraceCount<PIN_TRACE) pinTraceCount++;
+}
+void pinTrace(byte pin, byte val){
+  noInterrupts(); pinTraceLocked(pin,val); interrupts();
+}
+
+void pinTraceMeasure(word ms){
+  //Called by pattern.cpp at the start of each measure of a signal pattern, so the trace can say how long they are
+  pinTraceMeasureMs = ms;
+}
+
+word pinTraceLength(){
+  return PINTRACE_HEADER+(pinTraceCount*PINTRACE_RECORD);
+}
+
+const byte *pinTraceRecord(byte i){ //"private"
+  //The ith record, oldest first
+  byte first = (pinTraceCount<PIN_TRACE? 0: pinTraceHead);
+  return pinTraceBuf+(((first+i)%PIN_TRACE)*PINTRACE_RECORD);
+}
+
+unsigned long pinTraceTime(const byte *p){ //"private"
+  return (unsigned long)p[0] | ((unsigned long)p[1]<<8) | ((unsigned long)p[2]<<16) | ((unsigned long)p[3]<<24);
+}
+
+void pinTraceDump(Print &out){
+  pinTraceHeld = true;
+  out.write('P'); out.write('T'); out.write(PINTRACE_VERSION); out.write(PINTRACE_RECORD);
+  for(byte r=0; r<PINTRACE_ROLES; r++) out.write(pinTraceRole(r)<0? 255: pinTraceRole(r));
+  out.write(lowByte(pinTraceMeasureMs)); out.write(highByte(pinTraceMeasureMs));
+  for(byte i=0; i<pinTraceCount; i++) out.write(pinTraceRecord(i),PINTRACE_RECORD);
+  pinTraceHeld = false;
+}
+
+void pinTraceVCD(Print &out){
+  //Writes the trace as a Value Change Dump, one signal per role, with times in µs from the oldest record
+  pinTraceHeld = true;
+  out.print(F("$comment measure ")); out.print(pinTraceMeasureMs); out.print(F(" ms $end\n"));
+  out.print(F("$timescale 1us $end\n$scope module clock $end\n"));
+  const char *name = pinTraceNames;
+  for(byte r=0; r<PINTRACE_ROLES; r++){
+    if(pinTraceRole(r)>=0){
+      out.print(F("$var wire ")); out.print(r==PINTRACE_WIDE? 8: 1); out.print(' '); out.print((char)('!'+r)); out.print(' ');
+      for(const char *c=name; pgm_read_byte(c) && pgm_read_byte(c)!=' '; c++) out.print((char)pgm_read_byte(c));
+      out.print(F(" $end\n"));
+    }
+    while(pgm_read_byte(name) && pgm_read_byte(name)!=' ') name++;
+    name++; //past the space
+  }
+  out.print(F("$upscope $end\n$enddefinitions $end\n"));
+  unsigned long t0 = (pinTraceCount? pinTraceTime(pinTraceRecord(0)): 0);
+  bool first = true; unsigned long tLast = 0;
+  for(byte i=0; i<pinTraceCount; i++){
+    const byte *p = pinTraceRecord(i);
+    byte r = 0;
+    while(r<PINTRACE_ROLES && pinTraceRole(r)!=p[4]) r++;
+    if(r==PINTRACE_ROLES) continue; //not a pin we know
+    unsigned long us = (uint32_t)(pinTraceTime(p)-t0); //micros() wraps at 32 bits
+    if(first || us!=tLast){ out.print('#'); out.print(us); out.print('\n'); tLast = us; first = false; }
+    if(r==PINTRACE_WIDE){ out.print('b'); out.print(p[5],BIN); out.print(' '); }
+    else out.print(p[5]? '1': '0');
+    out.print((char)('!'+r)); out.print('\n');
+  }
+  pinTraceHeld = false;
+}
+
+void pinTraceCycle(){
+  //Called on every cycle - writes the trace out as VCD if asked to over serial
+  if(Serial.available() && Serial.read()=='t') pinTraceVCD(Serial);
+}
+
+#endif //PIN_TRACE
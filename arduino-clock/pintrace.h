@@ -0,0 +1,31 @@
+#ifndef PINTRACE_H
+#define PINTRACE_H
+
+//Output pin recorder, for checking display multiplexing and signal timing without a logic analyzer - if PIN_TRACE is
+//defined in config. See pintrace.cpp.
+
+#define PINTRACE_VERSION 2
+#define PINTRACE_ROLES 15 //anodes 1-3, cathodes A1-A4 and B1-B4, piezo, switch, pulse, backlight - see pinTraceRoles
+#define PINTRACE_HEADER (6+PINTRACE_ROLES) //'P', 'T', PINTRACE_VERSION, PINTRACE_RECORD, the pin for each role, measure (ms)
+//Roles to record, for PIN_TRACE_ROLES in config - a bit each, in the order of pinTraceRoles. Default all.
+#define PINTRACE_DISPLAY 0x07FF //anodes and cathodes - the nixie multiplex, which fills the trace fastest
+#define PINTRACE_SIGNALS 0x3800 //piezo, switch, pulse
+#define PINTRACE_BACKLIGHT 0x4000
+#define PINTRACE_ALL 0x7FFF
+#define PINTRACE_RECORD 6 //bytes per change - see pinTrace()
+#define PINTRACE_PINS 32 //pins below this are only recorded when they change
+
+//Use these in place of digitalWrite()/analogWrite() for outputs worth tracing - they're plain writes if not PIN_TRACE
+void pinWrite(byte pin, byte val);
+void pinAnalogWrite(byte pin, byte val);
+
+void pinTraceInit();
+void pinTrace(byte pin, byte val);
+void pinTraceLocked(byte pin, byte val);
+void pinTraceMeasure(word ms);
+word pinTraceLength();
+void pinTraceDump(Print &out);
+void pinTraceVCD(Print &out);
+void pinTraceCycle();
+
+#endif //PINTRACE_H
@@ -0,0 +1,159 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#include "power.h"
+#include "input.h"
+#ifdef __AVR__
+  #include <avr/sleep.h>
+  extern volatile unsigned long timer0_overflow_count, timer0_millis; //the millis() tick's, in the Arduino core (wiring.c)
+#endif
+
+// Low-power idle. While the display is off (night/away shutoff) and nothing else is going on (see getIdleNap()),
+// there's no need to run the loop flat out, polling the RTC and inputs thousands of times a second. Instead,
+// cyclePower() naps between loop cycles: it puts the MCU in its idle sleep mode, which stops the CPU but keeps the
+// clocks and peripherals running, so it wakes on any interrupt - a button pin change (see inputSample()), the piezo
+// timer, serial, and the millis() tick. It goes back to sleep until the nap is up, or a button edge is waiting for
+// checkInputs(). getIdleNap() ends the nap in time for the next tick when a timed event is due on it.
+// The millis() tick would wake it every ms, so for the nap, the tick is slowed to every POWER_TICK ms, and millis()
+// credited for the ms it skips, so the timekeeping that relies on it between RTC reads carries on:
+// - SAMD: SysTick's period is lengthened, and sysTickHook() (a hook in the core's SysTick handler) counts the extra ms.
+//   Changing the period keeps the ms in progress, so millis() is kept exactly, and micros() with it.
+// - AVR: Timer0 is prescaled by 1024 rather than 64, and cyclePower() counts the extra overflows. Switching the
+//   prescaler can shift millis() by a few µs per nap, which the drift correction against the RTC absorbs - so this is
+//   skipped with RTC_MILLIS, where millis() is the clock. Within each overflow, micros() runs 16x slow (up to 15ms
+//   behind, e.g. for a button edge), and PWM on Timer0's pins (5 and 6) slows down too.
+// The deeper modes (AVR power-down, SAMD standby) would stop these timers, and the configs have no RTC square wave
+// pin to wake us - so idle it is, for now.
+// Buttons that can't interrupt (e.g. analog-only A6/A7) are only read between naps, so while any are in use, naps
+// are kept to POWER_NAP_POLLED, short enough not to miss a press. The rotary encoder counts by interrupt, and IMU tilts
+// are held positions, so they're just read a nap late.
+// Residency is kept for the metrics endpoint (see sendMetrics() in network.cpp): time spent napping vs. awake while
+// the display is off, and how often the MCU woke for something other than the tick.
+
+#if defined(ARDUINO_ARCH_SAMD)
+  #define POWER_TICK 4 //ms per millis() tick while napping - any longer, and the core's micros() math overflows at 48MHz
+#elif defined(__AVR__) && !defined(RTC_MILLIS)
+  #define POWER_TICK 16 //ms per millis() tick while napping - per the Timer0 prescalers
+#else
+  #define POWER_TICK 1 //not slowed
+#endif
+
+unsigned long powerSleepSecs = 0; word powerSleepMs = 0; //time napping...
+unsigned long powerAwakeSecs = 0; word powerAwakeMs = 0; //...and awake between naps, while the display is off
+unsigned long powerWakes = 0; //times the MCU woke during a nap, other than for the millis() tick
+unsigned long powerInputWakes = 0; //naps cut short by a button
+unsigned long powerNapLast = 0; //when the last nap ended - 0 if we've been at full speed since
+word powerNap = 0; //how long the last loop cycle napped, ms
+
+#ifdef ARDUINO_ARCH_SAMD
+extern "C" void SysTick_DefaultHandler(void); //the core's millis() tick (delay.c)
+volatile byte powerTickMs = 1; //ms per SysTick period - see powerTick()
+extern "C" int sysTickHook(void){
+  //Called by the core on each SysTick, before it counts the ms - counts the rest of a lengthened period
+  for(byte i=1; i<powerTickMs; i++) SysTick_DefaultHandler();
+  return 0; //and carry on
+}
+void powerTick(byte ms){ //"private"
+  //Sets the SysTick period to ms. The ms already elapsed in the current period are counted now, and the period is
+  //restarted to end after the rest of the ms in progress, plus the new period - so millis() stays exact.
+  noInterrupts();
+  unsigned long cycles = SystemCoreClock/1000; //per ms
+  byte n = 0;
+  if(SCB->ICSR&SCB_ICSR_PENDSTSET_Msk){ SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk; n = powerTickMs; } //a period just ended
+  unsigned long elapsed = SysTick->LOAD-SysTick->VAL; //in the current period
+  for(n += elapsed/cycles; n; n--) SysTick_DefaultHandler();
+  SysTick->LOAD = cycles*ms-1-elapsed%cycles; SysTick->VAL = 0; //writing VAL reloads from LOAD...
+  (void)SysTick->VAL; SysTick->LOAD = cycles*ms-1; //...and once it has, this is the period from then on
+  powerTickMs = ms;
+  interrupts();
+}
+#elif POWER_TICK>1 //AVR
+bool powerTickSlow = false; //Timer0 is prescaled by 1024, so each overflow stands for 16
+unsigned long powerOverflows = 0; //timer0_overflow_count, as of the last powerCatchUp()
+long powerCreditUs = 0; //time millis() hasn't been credited with yet
+void powerCatchUp(){ //"private"
+  //With interrupts off: credits millis() (and micros()) with the overflows it's counted as one, but were 16
+  unsigned long now = timer0_overflow_count+(TIFR0&_BV(TOV0)? 1: 0); //including one whose interrupt is waiting
+  if(powerTickSlow){
+    unsigned long extra = (now-powerOverflows)*15;
+    timer0_overflow_count += extra; now += extra;
+    powerCreditUs += (long)(extra*clockCyclesToMicroseconds(64*256));
+  }
+  powerOverflows = now;
+  if(powerCreditUs>=1000){ timer0_millis += powerCreditUs/1000; powerCreditUs %= 1000; }
+}
+void powerTick(byte ms){ //"private"
+  //Sets Timer0's prescaler for a 1ms or 16ms millis() tick, crediting millis() for the difference in the count so far
+  noInterrupts();
+  powerCatchUp();
+  bool slow = (ms>1);
+  if(slow!=powerTickSlow){
+    //The count so far in this overflow's period will be taken as the other prescaler's - each count is 16 at 64
+    powerCreditUs += (slow? -15L: 15L)*TCNT0*(long)clockCyclesToMicroseconds(64);
+    TCCR0B = (TCCR0B&~(_BV(CS02)|_BV(CS01)|_BV(CS00))) | (slow? _BV(CS02)|_BV(CS00): _BV(CS01)|_BV(CS00));
+    powerTickSlow = slow;
+  }
+  interrupts();
+}
+#endif
+
+void powerSleep(){ //"private"
+  //Sleeps until the next interrupt - at the latest, the millis() tick
+  #ifdef __AVR__
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_mode();
+  #elif defined(ARDUINO_ARCH_SAMD)
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk; //idle, not standby
+    __DSB(); __WFI();
+  #endif
+}
+
+void powerAdd(unsigned long *secs, word *ms, unsigned long dur){ //"private"
+  //Adds dur ms to a residency counter, kept in secs and ms so it doesn't overflow with millis()
+  dur += *ms;
+  *secs += dur/1000; *ms = dur%1000;
+}
+
+void cyclePower(){
+  //Called on every loop: naps until the loop is next needed, if the display is off and nothing is going on
+  word nap = (POWER_NAP? getIdleNap(): 0);
+  powerNap = 0;
+  if(!nap){ powerNapLast = 0; return; }
+  if(nap>POWER_NAP_POLLED && inputPolled()) nap = POWER_NAP_POLLED;
+  unsigned long start = millis();
+  if(powerNapLast) powerAdd(&powerAwakeSecs,&powerAwakeMs,(unsigned long)(start-powerNapLast)); //the loop cycle since the last nap
+  #if POWER_TICK>1
+    if(nap>=POWER_TICK*2) powerTick(POWER_TICK); //worth slowing the tick - it may be a tick late waking
+  #endif
+  while((unsigned long)(millis()-start)<nap){
+    if(inputPending()){ powerInputWakes++; break; }
+    unsigned long before = millis();
+    powerSleep();
+    #if POWER_TICK>1 && defined(__AVR__)
+      noInterrupts(); powerCatchUp(); interrupts();
+    #endif
+    if(millis()==before) powerWakes++; //woken by something other than the tick
+  }
+  #if POWER_TICK>1
+    powerTick(1);
+  #endif
+  powerNapLast = millis(); if(!powerNapLast) powerNapLast = 1; //can't be zero
+  powerNap = powerNapLast-start;
+  powerAdd(&powerSleepSecs,&powerSleepMs,powerNap);
+}
+
+word getPowerNap(){ return powerNap; } //so the loop stats can leave it out (see checkLoopStats())
+unsigned long getPowerSleepSecs(){ return powerSleepSecs; }
+unsigned long getPowerAwakeSecs(){ return powerAwakeSecs; }
+word getPowerDuty(){
+  //Thousandths of the time the MCU has been awake while the display is off (as the loop, not counting interrupts)
+  float total = (powerSleepSecs+powerAwakeSecs)*1000.0+powerSleepMs+powerAwakeMs;
+  return (total? (powerAwakeSecs*1000.0+powerAwakeMs)*1000/total: 1000);
+}
+unsigned long getPowerWakes(){ return powerWakes; }
+unsigned long getPowerWakeRate(){
+  //MCU wakeups per hour while the display is off, other than for the millis() tick
+  unsigned long secs = powerSleepSecs+powerAwakeSecs;
+  return (secs? powerWakes*3600.0/secs: 0);
+}
+unsigned long getPowerInputWakes(){ return powerInputWakes; }
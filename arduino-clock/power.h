@@ -0,0 +1,24 @@
+#ifndef POWER_H
+#define POWER_H
+
+//Low-power idle - the loop naps between cycles while the display is off. See power.cpp.
+
+#ifndef POWER_NAP
+#define POWER_NAP 100 //ms - longest nap between loop cycles (see config) - 0 to always run at full speed
+#endif
+#ifndef POWER_NAP_POLLED
+#define POWER_NAP_POLLED 30 //ms - longest nap if any button is polled, rather than read by interrupt (see input.cpp)
+#endif
+
+void powerSleep();
+void powerAdd(unsigned long *secs, word *ms, unsigned long dur);
+void cyclePower();
+word getPowerNap();
+unsigned long getPowerSleepSecs();
+unsigned long getPowerAwakeSecs();
+word getPowerDuty();
+unsigned long getPowerWakes();
+unsigned long getPowerWakeRate();
+unsigned long getPowerInputWakes();
+
+#endif //POWER_H
@@ -19,9 +19,13 @@
   //#include <FlashStorage.h> //regular mode
 #endif
 
-#define STORAGE_SPACE 152 //number of bytes
+#define STORAGE_SPACE 176 //number of bytes - through the alarm records (see ALARM_LOC)
+static_assert(ALARM_LOC+(ALARMS-1)*ALARM_SIZE<=STORAGE_SPACE, "alarm records must fit in STORAGE_SPACE");
 byte storageBytes[STORAGE_SPACE]; //the volatile array of bytes
 #define COMMIT_TO_EEPROM 1 //1 for production
+unsigned long commitCount = 0; //flash commits since boot - each one wears the flash, so it's reported in metrics
+word storageChanges = 0; //values changed since boot (wrapping) - so other code can tell when settings have changed
+unsigned long storageRejects = 0; //reads/writes refused for being out of range - should stay 0; reported in metrics
 
 void initStorage(){
   //If this is SAMD, write starting values if unused
@@ -32,7 +36,7 @@ void initStorage(){
   if(!EEPROM.isValid() || EEPROM.read(16)==0 || EEPROM.read(16)==255){ //invalid eeprom, wipe it out
     for(byte i=0; i<STORAGE_SPACE; i++) EEPROM.update(i,0);
     if(COMMIT_TO_EEPROM){
-      EEPROM.commit();
+      EEPROM.commit(); commitCount++;
       //Serial.println(F("WARNING: FLASH EEPROM COMMIT per init"));
     }
   }
@@ -41,9 +45,18 @@ void initStorage(){
   for(byte i=0; i<STORAGE_SPACE; i++) storageBytes[i] = EEPROM.read(i);
 }
 
+bool storageInRange(int loc, bool isInt){ //"private"
+  //Whether loc (and loc+1, for an int) is within the volatile array - so a bad loc (e.g. from a malformed request) can't
+  //read or write past it
+  if(loc>=0 && loc+isInt<STORAGE_SPACE) return true;
+  storageRejects++;
+  return false;
+}
+
 int readEEPROM(int loc, bool isInt){
   //Read from the volatile array, either a byte or a signed int
   //Must read int as 16-bit, since on SAMD int is 32-bit and negatives aren't read correctly
+  if(!storageInRange(loc,isInt)) return 0;
   if(isInt) return (int16_t)(storageBytes[loc]<<8)+storageBytes[loc+1];
   else return storageBytes[loc];
 }
@@ -52,6 +65,7 @@ bool writeEEPROM(int loc, int val, bool isInt, bool commit){
   //Update the volatile array and the real persistent storage for posterity
   //Eiither a byte or a signed int
   //Serial.print(F("Set ")); Serial.print(loc); Serial.print(F("=")); Serial.print(val,DEC);
+  if(!storageInRange(loc,isInt)) return false; //out of range - leave everything alone
   if(readEEPROM(loc,isInt)==val){
     //Serial.println(F(": nothing doing"));
     return false;
@@ -66,9 +80,10 @@ bool writeEEPROM(int loc, int val, bool isInt, bool commit){
     storageBytes[loc] = val;
     EEPROM.update(loc,val);
   }
+  storageChanges++;
   #ifdef FLASH_AS_EEPROM
     if(commit && COMMIT_TO_EEPROM){
-      EEPROM.commit(); //bad!! See TODO in storage.h
+      EEPROM.commit(); commitCount++; //bad!! See TODO in storage.h
       //Serial.println(F("WARNING: FLASH EEPROM COMMIT per write"));
     }
   #endif
@@ -77,8 +92,27 @@ bool writeEEPROM(int loc, int val, bool isInt, bool commit){
 void commitEEPROM(){
   #ifdef FLASH_AS_EEPROM
   if(COMMIT_TO_EEPROM){
-    EEPROM.commit(); //bad!! See TODO in storage.h
+    EEPROM.commit(); commitCount++; //bad!! See TODO in storage.h
     //Serial.println(F("WARNING: FLASH EEPROM COMMIT by request"));
   }
   #endif
+}
+unsigned long getCommitCount(){ return commitCount; }
+word getStorageChanges(){ return storageChanges; }
+unsigned long getStorageRejects(){ return storageRejects; }
+
+//Bulk data (e.g. custom signal tunes, see pattern.cpp) lives past STORAGE_SPACE, and isn't worth holding in RAM,
+//so it's read from and written to EEPROM/flash directly. (On SAMD, FlashAsEEPROM keeps its own copy in RAM anyway.)
+byte readEEPROMDirect(int loc){
+  if(loc<STORAGE_SPACE || loc>=EEPROM.length()) return 255; //not bulk data, or out of range - reads like erased EEPROM
+  return EEPROM.read(loc);
+}
+bool writeEEPROMDirect(int loc, byte val, bool commit){
+  if(loc<STORAGE_SPACE || loc>=EEPROM.length()) return false;
+  if(EEPROM.read(loc)==val) return false;
+  EEPROM.update(loc,val);
+  #ifdef FLASH_AS_EEPROM
+    if(commit && COMMIT_TO_EEPROM){ EEPROM.commit(); commitCount++; } //bad!! See TODO in storage.h
+  #endif
+  return true;
 }
\ No newline at end of file
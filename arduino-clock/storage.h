@@ -5,5 +5,10 @@ void initStorage(); //Read from real persistent storage into storageBytes
 int readEEPROM(int loc, bool isInt); //Read from the volatile array
 bool writeEEPROM(int loc, int val, bool isInt, bool commit=1); //Update the volatile array and the real persistent storage for posterity
 void commitEEPROM();
+unsigned long getCommitCount(); //flash commits since boot
+word getStorageChanges(); //values changed since boot - compare to tell when settings have changed
+unsigned long getStorageRejects(); //out-of-range reads/writes refused since boot
+byte readEEPROMDirect(int loc); //Read bulk data past the volatile array
+bool writeEEPROMDirect(int loc, byte val, bool commit=1);
 
 #endif //STORAGE_H
\ No newline at end of file
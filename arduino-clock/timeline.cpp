@@ -0,0 +1,76 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#include "timeline.h"
+
+// Timeline of timed events. Rather than checkRTC() testing every event's time conditions each second, each event type
+// has one entry here with the absolute time it's next due (seconds since 2000), kept in a small min-heap, so a tick
+// only has to compare the time against the earliest. The main code works out when each type is due next (see
+// scheduleEvent()) - when one is handled, and for all of them when the settings or the clock change. This has no
+// dependency on the RTC or settings, so it can be exercised on its own.
+
+struct TimelineEntry {
+  unsigned long at;
+  byte type;
+};
+TimelineEntry timeline[TL_TYPES];
+byte timelineCount = 0;
+
+bool timelineBefore(byte i, byte j){ //"private"
+  //Ties go by type, so same-second events are handled in a fixed order
+  return timeline[i].at<timeline[j].at || (timeline[i].at==timeline[j].at && timeline[i].type<timeline[j].type);
+}
+void timelineSwap(byte i, byte j){ //"private"
+  TimelineEntry t = timeline[i]; timeline[i] = timeline[j]; timeline[j] = t;
+}
+
+void timelineClear(){
+  timelineCount = 0;
+}
+
+void timelineAdd(byte type, unsigned long at){
+  //Adds an event, unless it's never due. Each type should only be added once (after it's cleared or popped).
+  if(at==TL_NEVER || timelineCount>=TL_TYPES) return;
+  byte i = timelineCount++;
+  timeline[i].at = at; timeline[i].type = type;
+  while(i && timelineBefore(i,(i-1)/2)){ timelineSwap(i,(i-1)/2); i = (i-1)/2; } //sift up
+}
+
+unsigned long timelineNext(){
+  //When the earliest event is due
+  return (timelineCount? timeline[0].at: TL_NEVER);
+}
+
+byte timelinePop(){
+  //Removes the earliest event, and returns its type
+  byte type = timeline[0].type;
+  timeline[0] = timeline[--timelineCount];
+  byte i = 0;
+  while(true){ //sift down
+    byte c = i*2+1;
+    if(c>=timelineCount) break;
+    if(c+1<timelineCount && timelineBefore(c+1,c)) c++;
+    if(!timelineBefore(c,i)) break;
+    timelineSwap(i,c); i = c;
+  }
+  return type;
+}
+
+unsigned long timelineAfter(unsigned long after, unsigned long period, unsigned long offset){
+  //The first time later than after, that falls offset seconds into a period (e.g. 86400 and 7200 for 2am daily).
+  //Periods divide evenly into a day, so periods start at midnight.
+  unsigned long t = after-(after%period)+offset;
+  return (t>after? t: t+period);
+}
+
+unsigned long timelineSeconds(word y, byte m, byte d, byte h, byte mi, byte s){
+  //Seconds since 2000-01-01 00:00:00 (good until 2136)
+  unsigned long days = 365UL*(y-2000) + (y-1997)/4 - (y-1901)/100 + (y-1601)/400; //with the leap days before y
+  days += dateToDayCount(y,m,d);
+  return days*86400 + h*3600UL + mi*60 + s;
+}
+
+byte timelineWeekday(unsigned long t){
+  //Day of the week of a time per timelineSeconds(), 0=Sunday, as dayOfWeek() (2000-01-01 was a Saturday)
+  return (t/86400+6)%7;
+}
@@ -0,0 +1,28 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+//Timed events - when each is next due, so checkRTC() only has to look at the earliest. See timeline.cpp.
+
+//Event types, in the order they're handled when due at the same second
+#define TL_DRIFT 0 //millis drift check, every millisCorrectionInterval seconds
+#define TL_DST 1 //auto DST check, at 2am
+#define TL_ALARM 2 //alarms, or the starts of their fibonacci sequences - one type per alarm, through TL_ALARM+ALARMS-1
+#define TL_DATE (TL_ALARM+ALARMS) //date display at :30
+#define TL_CLEAN (TL_DATE+1) //sun calculation, at the start of night shutoff or midnight
+#define TL_NTP (TL_DATE+2) //NTP sync cue at :59:00, and retry at :59:30
+#define TL_PIPS (TL_DATE+3) //the six pips, at :59:55
+#define TL_STRIKE (TL_DATE+4) //hour strike, or ship's bell
+#define TL_TYPES (TL_DATE+5)
+
+#define TL_NEVER 0xFFFFFFFF
+#define TL_JUMP 60 //if the clock moves by more than this many seconds (e.g. it was set), start afresh rather than catching up
+
+void timelineClear();
+void timelineAdd(byte type, unsigned long at);
+unsigned long timelineNext();
+byte timelinePop();
+unsigned long timelineAfter(unsigned long after, unsigned long period, unsigned long offset);
+unsigned long timelineSeconds(word y, byte m, byte d, byte h, byte mi, byte s);
+byte timelineWeekday(unsigned long t);
+
+#endif //TIMELINE_H
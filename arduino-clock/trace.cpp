@@ -0,0 +1,94 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#ifdef INPUT_TRACE //see config
+#if INPUT_TRACE>100
+#error "INPUT_TRACE can be at most 100"
+#endif
+
+#include "trace.h"
+//Needs RTC time of day for the records, and the display
+#include "rtcDS3231.h"
+#include "rtcMillis.h"
+#include "dispNixie.h"
+#include "dispMAX7219.h"
+
+// Control event recorder, for reproducing input bugs. Each event passed to ctrlEvt() - by input.cpp, or by a replay - is
+// recorded with when it happened (millis and RTC time), the fn/fnSetPg it left the clock in, how long until the
+// display was next updated, and what it showed then. The latest INPUT_TRACE events are kept in a ring buffer, and
+// traceDump() writes them out as a header followed by records, oldest first (GET /trace on Wi-Fi clocks).
+// Record layout, little-endian:
+//   0-3 millis, 4-5 RTC time of day (mins), 6 RTC second, 7 ctrl, 8 evt, 9 evtLast,
+//   10 flags (TRACE_REPLAYED), 11 fn, 12 fnSetPg, 13-14 event to display update (µs), 15 velocity,
+//   16-18 display digits 0-5 after that update, a nibble each, high nibble first (0-9, or 15 for blank),
+//   19-20 ms into the RTC second (since the loop saw it start) - so a replay can tick the seconds when the clock did
+// A dumped trace can be replayed on a computer, by the sketch built against stand-ins for the hardware, under virtual
+// time - see extras/tests/replay - which records the replayed events too (flagged TRACE_REPLAYED), to compare the
+// states, displays, and latencies of the two runs. There's no replay on the clock itself, which would have to set its
+// RTC and settings to the recorded ones.
+
+byte traceBuf[INPUT_TRACE*TRACE_RECORD];
+byte traceHead = 0; //next record to write
+byte traceCount = 0;
+unsigned long traceStartUs = 0; //when the current event was passed to ctrlEvt(), micros()
+bool traceWaiting = false; //for a display update after that
+word traceLatency = TRACE_NO_LATENCY;
+int traceLast = -1; //record still waiting for its latency, if traceEnd() came first
+
+void tracePut(byte *p, unsigned long val, byte len){ //"private"
+  for(byte i=0; i<len; i++){ p[i] = val&0xFF; val >>= 8; }
+}
+
+void traceBegin(){
+  //Called just before ctrlEvt(), to start timing the display update
+  traceStartUs = micros(); traceWaiting = true;
+  traceLatency = TRACE_NO_LATENCY; traceLast = -1; //the last event's latency, if it had none, stays that way
+}
+
+void tracePutDisplay(byte *p){ //"private"
+  for(byte i=0; i<3; i++) p[i] = (getDisplayDigit(i*2)<<4) | (getDisplayDigit(i*2+1)&0x0F);
+}
+
+void traceEnd(byte ctrl, byte evt, byte evtLast, byte velocity, byte flags){
+  //Called just after ctrlEvt() - records the event and the state it left
+  byte *p = traceBuf+(traceHead*TRACE_RECORD);
+  tracePut(p,millis(),4);
+  tracePut(p+4,rtcGetTOD(),2);
+  p[6] = rtcGetSecond();
+  p[7] = ctrl; p[8] = evt; p[9] = evtLast;
+  p[10] = flags;
+  p[11] = getFn(); p[12] = getFnSetPg();
+  tracePut(p+13,traceLatency,2);
+  p[15] = velocity;
+  tracePutDisplay(p+16); //as it stands - if the display hasn't been updated yet, traceDisplayed() will replace it
+  unsigned long ms = millis()-getRtcSecAt();
+  tracePut(p+19,(ms<65535? ms: 65535),2);
+  if(traceWaiting) traceLast = traceHead; //no display update yet - traceDisplayed() will fill it in
+  traceHead = (traceHead+1)%INPUT_TRACE;
+  if(traceCount<INPUT_TRACE) traceCount++;
+}
+
+void traceDisplayed(){
+  //Called by updateDisplay()
+  if(!traceWaiting) return;
+  traceWaiting = false;
+  unsigned long us = micros()-traceStartUs;
+  traceLatency = (us<TRACE_NO_LATENCY? us: TRACE_NO_LATENCY-1);
+  if(traceLast>=0){
+    tracePut(traceBuf+(traceLast*TRACE_RECORD)+13,traceLatency,2);
+    tracePutDisplay(traceBuf+(traceLast*TRACE_RECORD)+16);
+    traceLast = -1;
+  }
+}
+
+word traceLength(){
+  return TRACE_HEADER+(traceCount*TRACE_RECORD);
+}
+
+void traceDump(Print &out){
+  out.write('C'); out.write('T'); out.write(TRACE_VERSION); out.write(TRACE_RECORD);
+  byte first = (traceCount<INPUT_TRACE? 0: traceHead);
+  for(byte i=0; i<traceCount; i++) out.write(traceBuf+(((first+i)%INPUT_TRACE)*TRACE_RECORD),TRACE_RECORD);
+}
+
+#endif //INPUT_TRACE
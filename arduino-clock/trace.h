@@ -0,0 +1,18 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+//Control event recorder, for debugging input handling - if INPUT_TRACE is defined in config. See trace.cpp.
+
+#define TRACE_VERSION 4
+#define TRACE_HEADER 4 //'C', 'T', TRACE_VERSION, TRACE_RECORD
+#define TRACE_RECORD 21 //bytes per event - see traceEnd()
+#define TRACE_REPLAYED 1 //flags bit: event was replayed (see extras/tests/replay), not a real input
+#define TRACE_NO_LATENCY 65535 //display wasn't updated before the next event
+
+void traceBegin();
+void traceEnd(byte ctrl, byte evt, byte evtLast, byte velocity, byte flags);
+void traceDisplayed();
+word traceLength();
+void traceDump(Print &out);
+
+#endif //TRACE_H
@@ -0,0 +1,52 @@
+#ifndef TRAITS_H
+#define TRAITS_H
+
+//Feature traits - what this clock has, per its config, as compile-time constants, so the code can ask e.g. if(hasPiezo)
+//rather than repeating pin comparisons. Since they're constexpr, the compiler drops any code they rule out, the same
+//as #if would - but unlike #if, they work with pins like A7, which are constants rather than macros on some boards.
+//Included by arduino-clock.h, after the config.
+
+//Inputs
+#ifdef INPUT_IMU
+constexpr bool hasAlt = true; //tilt - see input.h
+#elif defined(CTRL_ALT)
+constexpr bool hasAlt = (CTRL_ALT>0);
+#else
+constexpr bool hasAlt = false;
+#endif
+
+//Displays
+#ifdef DISP_NIXIE
+constexpr bool hasNixie = true; //digit fade and anti-poisoning apply
+#else
+constexpr bool hasNixie = false;
+#endif
+
+//Signal outputs
+constexpr bool hasPiezo = (PIEZO_PIN>=0);
+constexpr bool hasSwitch = (SWITCH_PIN>=0);
+constexpr bool hasPulse = (PULSE_PIN>=0);
+constexpr bool hasBacklight = (BACKLIGHT_PIN>=0);
+constexpr byte signalTypes = hasPiezo+hasSwitch+hasPulse; //how many the alarm/timer can choose from
+constexpr bool hasBeeps = (hasPiezo || hasPulse); //fibonacci and chimes need one of these
+
+//Network - Wi-Fi, NTP, and the admin page, on any non-AVR board (see network.cpp)
+#ifdef __AVR__
+constexpr bool hasNetwork = false;
+#else
+constexpr bool hasNetwork = true;
+#endif
+
+//Functions, and features of them, that are both enabled and possible with the hardware
+constexpr bool hasAlarm = (ENABLE_ALARM_FN && signalTypes>0);
+constexpr bool hasFibonacci = (hasAlarm && hasBeeps && ENABLE_ALARM_FIBONACCI);
+constexpr bool hasChime = (hasBeeps && ENABLE_TIME_CHIME);
+constexpr bool hasGeography = (ENABLE_DATE_FN && (ENABLE_DATE_RISESET || ENABLE_DATE_WEATHER)); //lat/long settings
+
+//Signal types (per settings 42-44) this clock can do: 0=piezo, 1=switch, 2=pulse
+constexpr bool signalOK(byte type){ return (type==0? hasPiezo: (type==1? hasSwitch: (type==2? hasPulse: false))); }
+
+static_assert(!ENABLE_SHUTOFF_AWAY || ENABLE_SHUTOFF_NIGHT, "ENABLE_SHUTOFF_AWAY requires ENABLE_SHUTOFF_NIGHT");
+static_assert(!ENABLE_DATE_WEATHER || ENABLE_DATE_FN, "ENABLE_DATE_WEATHER requires ENABLE_DATE_FN");
+
+#endif //TRAITS_H
@@ -0,0 +1,227 @@
+#include <arduino.h>
+#include "arduino-clock.h"
+
+#if ENABLE_DATE_WEATHER //see config
+#ifdef __AVR__
+#error "ENABLE_DATE_WEATHER requires Wi-Fi (Nano 33 IoT)"
+#endif
+#ifndef WEATHER_HOST
+#error "ENABLE_DATE_WEATHER requires WEATHER_HOST, WEATHER_PORT, and WEATHER_PATH - see ~sample.h"
+#endif
+
+#include "weather.h"
+#include <WiFiNINA.h>
+//Needs to know where we are
+#include "storage.h"
+//Needs to know whether Wi-Fi is up
+#include "network.h"
+//To build the request
+#include "http.h"
+
+// Forecast for the weather pages of the date function. cycleWeather() fetches it from WEATHER_HOST when due, reading
+// the response a slice per cycle through a small streaming parser (no String, no heap, and no need to hold the whole
+// response), and only replaces the cached forecast once a complete one has arrived. The display reads the cache via
+// getWeather() and never waits on the network. The response should look like this - see extras/weather/standin.py:
+// {"ttl":3600,"periods":[{"date":"2026-10-19","night":false,"high":18,"low":9,"precip":20},...]}
+// where each period is a day (sunrise to sunset) or a night (sunset to sunrise), dated by the day it starts on;
+// temperatures are °C; precip is percent chance; and ttl is how many seconds to keep it. Unknown keys are ignored.
+
+#define WEATHER_TIMEOUT 10000 //how long to give a fetch, from connecting to the end of the response
+#define WEATHER_SLICE 256 //most bytes to take from the response per cycle, so the display keeps going
+#define WEATHER_TTL_DEFAULT 3600 //seconds to keep a forecast, if the response doesn't say...
+#define WEATHER_TTL_MIN 600 //...or if it does, at least this long...
+#define WEATHER_TTL_MAX 21600 //...and at most this long (6 hours)
+#define WEATHER_RETRY_MIN 60000 //after a failed fetch, wait this long before trying again...
+#define WEATHER_RETRY_MAX 3600000 //...doubling the wait with each failure, up to this (1 hour)
+#define WEATHER_STALE 86400000 //stop showing a forecast this old, if it hasn't been refreshed (24 hours)
+#define WEATHER_DEPTH_MAX 8 //deepest JSON nesting we'll follow (objMask has a bit per level)
+
+WiFiClient weatherClient;
+WeatherParse weatherParse;
+bool weatherGoing = false;
+unsigned long weatherStartLast = 0; //when the last fetch started - zero is a special value meaning never
+unsigned long weatherWait = 0; //how long after that to start the next one
+unsigned long weatherRetryDelay = WEATHER_RETRY_MIN;
+int weatherLat = 0; //location of the last fetch, per EEPROM 10 and 12
+int weatherLong = 0;
+
+//The forecast itself, and where and when it was fetched
+WeatherPeriod weatherCache[WEATHER_PERIODS];
+byte weatherCount = 0;
+int weatherCacheLat = 0;
+int weatherCacheLong = 0;
+unsigned long weatherCachedLast = 0; //zero is a special value meaning never
+
+void weatherParseReset(WeatherParse *p){ //"private"
+  memset(p,0,sizeof(WeatherParse)); //WEATHER_ST_STATUS, nothing read
+}
+
+int8_t weatherTemp(const char *s){ //"private"
+  //Rounds a temperature to a whole degree that will fit
+  float t = atof(s);
+  if(t<-127) return -127;
+  if(t>127) return 127;
+  return (t<0? t-0.5: t+0.5);
+}
+
+void weatherValue(WeatherParse *p){ //"private"
+  //Handles a complete value (in p->val) per its key and where it is. We only want ttl, and the keys of each period.
+  if(p->depth==1 && !strcmp(p->key,"ttl")){ long t = atol(p->val); p->ttl = (t>0? t: 0); return; }
+  if(p->depth!=3 || !p->inPeriods || p->val[0]=='n') return; //not in a period, or null
+  if(!strcmp(p->key,"date")){ //YYYY-MM-DD - anything else leaves the period undated, so it's dropped
+    const char *v = p->val;
+    bool ok = (strlen(v)==10 && v[4]=='-' && v[7]=='-');
+    for(byte i=0; i<10 && ok; i++) if(i!=4 && i!=7 && (v[i]<'0' || v[i]>'9')) ok = false;
+    byte m = (ok? atoi(v+5): 0); byte d = (ok? atoi(v+8): 0);
+    if(m>=1 && m<=12 && d>=1 && d<=daysInMonth(atoi(v),m)){ p->cur.month = m; p->cur.date = d; p->curDated = true; }
+  }
+  else if(!strcmp(p->key,"night")) p->cur.night = (p->val[0]=='t');
+  else if(!strcmp(p->key,"high")) p->cur.high = weatherTemp(p->val);
+  else if(!strcmp(p->key,"low")) p->cur.low = weatherTemp(p->val);
+  else if(!strcmp(p->key,"precip")){ int n = atoi(p->val); p->cur.precip = (n<0? 0: (n>100? 100: n)); }
+}
+
+void weatherFeedJSON(WeatherParse *p, char c){ //"private"
+  //Takes the response body one char at a time. Keys and values are truncated to fit their buffers (ours all fit).
+  if(p->inStr){
+    if(p->esc) p->esc = false; //take escaped chars literally - none of the values we want have any
+    else if(c=='\\'){ p->esc = true; return; }
+    else if(c=='"'){ p->inStr = false; if(!p->isKey) weatherValue(p); p->len = 0; return; }
+    char *buf = (p->isKey? p->key: p->val);
+    byte size = (p->isKey? sizeof(p->key): sizeof(p->val));
+    if(p->len<size-1){ buf[p->len++] = c; buf[p->len] = '\0'; }
+    return;
+  }
+  if(p->len && (c==',' || c=='}' || c==']' || c==' ' || c=='\t' || c=='\r' || c=='\n')){ weatherValue(p); p->len = 0; } //end of a number, true, false, or null
+  bool inObj = p->depth && ((p->objMask>>(p->depth-1))&1);
+  switch(c){
+    case '"':
+      p->inStr = true; p->len = 0;
+      if(p->isKey) p->key[0] = '\0'; else p->val[0] = '\0';
+      break;
+    case '{': case '[':
+      if(p->depth>=WEATHER_DEPTH_MAX || (inObj && p->isKey)){ p->state = WEATHER_ST_ERROR; break; }
+      if(c=='{') p->objMask |= (1<<p->depth); else p->objMask &= ~(1<<p->depth);
+      p->depth++;
+      if(p->depth==2 && c=='[' && !strcmp(p->key,"periods")) p->inPeriods = true;
+      if(p->depth==3 && c=='{' && p->inPeriods){ //a new period
+        p->cur.month = 0; p->cur.date = 0; p->cur.night = false;
+        p->cur.high = WEATHER_NONE; p->cur.low = WEATHER_NONE; p->cur.precip = 255;
+        p->curDated = false;
+      }
+      p->isKey = (c=='{');
+      break;
+    case '}': case ']':
+      if(!p->depth || inObj!=(c=='}')){ p->state = WEATHER_ST_ERROR; break; } //mismatched
+      if(p->depth==3 && p->inPeriods && p->curDated && p->count<WEATHER_PERIODS) p->periods[p->count++] = p->cur; //extras are ignored
+      if(p->depth==2) p->inPeriods = false;
+      p->depth--;
+      if(!p->depth) p->state = WEATHER_ST_DONE;
+      break;
+    case ',':
+      if(!p->depth){ p->state = WEATHER_ST_ERROR; break; }
+      p->isKey = inObj; break;
+    case ':':
+      if(!inObj){ p->state = WEATHER_ST_ERROR; break; }
+      p->isKey = false; break;
+    case ' ': case '\t': case '\r': case '\n': break;
+    default: //part of a number, true, false, or null
+      if(!p->depth || p->isKey){ p->state = WEATHER_ST_ERROR; break; }
+      if(p->len<sizeof(p->val)-1){ p->val[p->len++] = c; p->val[p->len] = '\0'; }
+      break;
+  }
+}
+
+void weatherFeed(WeatherParse *p, char c){ //"private"
+  //Takes the response one char at a time, as it arrives
+  switch(p->state){
+    case WEATHER_ST_STATUS: //e.g. HTTP/1.0 200 OK - we only want the code
+      if(c=='\n'){ p->state = (p->status==200? WEATHER_ST_HEAD: WEATHER_ST_ERROR); p->lineStart = true; }
+      else if(c==' ') p->len++; //count spaces to find the code
+      else if(p->len==1 && c>='0' && c<='9' && p->status<1000) p->status = p->status*10+(c-'0');
+      break;
+    case WEATHER_ST_HEAD: //skip headers, to the blank line that ends them
+      if(c=='\n'){ if(p->lineStart){ p->state = WEATHER_ST_BODY; p->len = 0; } p->lineStart = true; }
+      else if(c!='\r') p->lineStart = false;
+      break;
+    case WEATHER_ST_BODY: weatherFeedJSON(p,c); break;
+    default: break; //done, or error - ignore the rest
+  }
+}
+
+void printTenths(Print &out, int n){ //"private"
+  //e.g. latitude 419 as 41.9
+  if(n<0){ out.print('-'); n = -n; }
+  out.print(n/10); out.print('.'); out.print(n%10);
+}
+
+void weatherStart(){ //"private"
+  //Connects and sends the request. Note WiFiNINA's connect() blocks until the connection is made (or fails),
+  //which is quick on a local network, but can take a moment further afield.
+  weatherStartLast = millis(); if(!weatherStartLast) weatherStartLast = 1; //can't be zero
+  weatherLat = readEEPROM(10,true); weatherLong = readEEPROM(12,true);
+  weatherParseReset(&weatherParse);
+  weatherGoing = true;
+  if(!weatherClient.connect(WEATHER_HOST,WEATHER_PORT)){ weatherDone(false); return; }
+  //HTTP/1.0, so the response won't be chunked, and the server will hang up when it's done
+  byte buf[192];
+  HttpOut out(buf,sizeof(buf));
+  out.print(F("GET " WEATHER_PATH "?lat=")); printTenths(out,weatherLat);
+  out.print(F("&lon=")); printTenths(out,weatherLong);
+  out.print(F("&utc=")); out.print((readEEPROM(14,false)-100)*15); //standard time offset in minutes
+  out.print(F(" HTTP/1.0\r\nHost: " WEATHER_HOST "\r\nAccept: application/json\r\n\r\n"));
+  if(out.overflowed() || weatherClient.write(buf,out.length())!=out.length()) weatherDone(false);
+}
+
+void weatherDone(bool ok){ //"private"
+  //Ends a fetch. If it got a forecast, cache it until the response's ttl is up - otherwise try again with backoff.
+  weatherClient.stop();
+  weatherGoing = false;
+  if(ok){
+    memcpy(weatherCache,weatherParse.periods,sizeof(weatherCache));
+    weatherCount = weatherParse.count;
+    weatherCacheLat = weatherLat; weatherCacheLong = weatherLong;
+    weatherCachedLast = millis(); if(!weatherCachedLast) weatherCachedLast = 1; //can't be zero
+    unsigned long ttl = (weatherParse.ttl? weatherParse.ttl: WEATHER_TTL_DEFAULT);
+    if(ttl<WEATHER_TTL_MIN) ttl = WEATHER_TTL_MIN;
+    if(ttl>WEATHER_TTL_MAX) ttl = WEATHER_TTL_MAX;
+    weatherWait = ttl*1000;
+    weatherRetryDelay = WEATHER_RETRY_MIN;
+  } else {
+    weatherWait = weatherRetryDelay;
+    weatherRetryDelay = (weatherRetryDelay*2>WEATHER_RETRY_MAX? WEATHER_RETRY_MAX: weatherRetryDelay*2);
+  }
+}
+
+void cycleWeather(){
+  //Called by cycleNetwork() on every cycle: advances a fetch in progress, or starts one when due
+  if(weatherGoing){
+    byte buf[WEATHER_SLICE];
+    int len = weatherClient.read(buf,sizeof(buf));
+    for(int i=0; i<len && weatherParse.state<WEATHER_ST_DONE; i++) weatherFeed(&weatherParse,buf[i]);
+    if(weatherParse.state==WEATHER_ST_DONE) weatherDone(weatherParse.count>0);
+    else if(weatherParse.state==WEATHER_ST_ERROR) weatherDone(false);
+    else if((len<=0 && !weatherClient.connected()) || (unsigned long)(millis()-weatherStartLast)>=WEATHER_TIMEOUT) weatherDone(false); //cut off
+    return;
+  }
+  if(!wifiConnected()) return;
+  int lat = readEEPROM(10,true); int lon = readEEPROM(12,true);
+  if(!lat && !lon) return; //no location to ask about - see also the date page skip in checkRTC()
+  if(weatherStartLast && (unsigned long)(millis()-weatherStartLast)<weatherWait
+    && lat==weatherLat && lon==weatherLong) return; //not due, and haven't moved since
+  weatherStart();
+}
+
+bool weatherBusy(){ return weatherGoing; } //a fetch is under way
+
+const WeatherPeriod* getWeather(byte month, byte date, bool night){
+  //Returns the cached forecast for the sun period starting on the given date, or NULL if we don't have it
+  if(!weatherCachedLast || (unsigned long)(millis()-weatherCachedLast)>=WEATHER_STALE) return NULL;
+  if(weatherCacheLat!=readEEPROM(10,true) || weatherCacheLong!=readEEPROM(12,true)) return NULL; //for somewhere else
+  for(byte i=0; i<weatherCount; i++){
+    if(weatherCache[i].month==month && weatherCache[i].date==date && weatherCache[i].night==night) return &weatherCache[i];
+  }
+  return NULL;
+}
+
+#endif //ENABLE_DATE_WEATHER
@@ -0,0 +1,56 @@
+#ifndef WEATHER_H
+#define WEATHER_H
+
+//Forecast fetched in the background from WEATHER_HOST, for the weather pages of the date function. See weather.cpp.
+
+#define WEATHER_PERIODS 6 //sun periods to cache - enough for last night through the day after tomorrow
+#define WEATHER_NONE -128 //high/low not given
+
+//One sun period: a day (sunrise to sunset) or a night (sunset to the next sunrise), per the date it starts on
+struct WeatherPeriod {
+  byte month;
+  byte date;
+  bool night;
+  int8_t high; //°C - or WEATHER_NONE if not given
+  int8_t low;
+  byte precip; //chance of precipitation, percent - or 255 if not given
+};
+
+//Response parser states, in the order they normally occur
+#define WEATHER_ST_STATUS 0 //status line
+#define WEATHER_ST_HEAD 1 //headers
+#define WEATHER_ST_BODY 2 //JSON
+#define WEATHER_ST_DONE 3 //JSON complete - ignore the rest
+#define WEATHER_ST_ERROR 4 //not a 200, or malformed - ignore the rest
+
+//Tracks a forecast response as it arrives - see weatherFeed()
+struct WeatherParse {
+  byte state;
+  int status; //HTTP status code
+  bool lineStart; //at the start of a header line - a blank one ends the headers
+  byte depth; //nesting level in the JSON...
+  byte objMask; //...and which of those levels are objects rather than arrays (bit per level)
+  bool inStr, esc, isKey, inPeriods;
+  char key[12]; //name of the current value
+  char val[16]; //the value itself, as text
+  byte len; //of key or val, whichever is being read
+  WeatherPeriod cur; //period being read...
+  bool curDated; //...and whether it's had a date
+  WeatherPeriod periods[WEATHER_PERIODS]; //periods read so far
+  byte count;
+  unsigned long ttl; //seconds, if given
+};
+
+void weatherParseReset(WeatherParse *p);
+int8_t weatherTemp(const char *s);
+void weatherValue(WeatherParse *p);
+void weatherFeedJSON(WeatherParse *p, char c);
+void weatherFeed(WeatherParse *p, char c);
+void printTenths(Print &out, int n);
+void weatherStart();
+void weatherDone(bool ok);
+void cycleWeather();
+bool weatherBusy();
+const WeatherPeriod* getWeather(byte month, byte date, bool night);
+
+#endif //WEATHER_H
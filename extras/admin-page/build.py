@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# Regenerates arduino-clock/adminPage.h from admin.html: the settings page, gzipped, as a byte array in flash,
+# plus an ETag derived from its contents so browsers can cache it across visits (see checkClients() in network.cpp).
+# Usage: python3 build.py
+
+import gzip, hashlib, os, re
+
+here = os.path.dirname(os.path.abspath(__file__))
+src = os.path.join(here, 'admin.html')
+dst = os.path.join(here, '..', '..', 'arduino-clock', 'adminPage.h')
+
+with open(src, 'rb') as f:
+    html = f.read()
+html = re.sub(rb'<!--.*?-->\s*', b'', html, flags=re.S)  # drop dev comments
+gz = gzip.compress(html, compresslevel=9, mtime=0)  # mtime=0 so the output (and ETag) only change with the source
+etag = hashlib.sha1(gz).hexdigest()[:8]
+
+lines = []
+for i in range(0, len(gz), 16):
+    lines.append('  ' + ','.join('0x%02x' % b for b in gz[i:i+16]) + ',')
+
+with open(dst, 'w') as f:
+    f.write('#ifndef ADMIN_PAGE_H\n#define ADMIN_PAGE_H\n\n')
+    f.write('//Generated by extras/admin-page/build.py from admin.html - edit that and rerun, rather than editing this.\n')
+    f.write('//%d bytes of html, gzipped to %d\n\n' % (len(html), len(gz)))
+    f.write('#define ADMIN_PAGE_ETAG "\\"%s\\""\n' % etag)
+    f.write('#define ADMIN_PAGE_LEN %d\n\n' % len(gz))
+    f.write('const byte adminPage[ADMIN_PAGE_LEN] PROGMEM = {\n')
+    f.write('\n'.join(lines))
+    f.write('\n};\n\n#endif //ADMIN_PAGE_H\n')
+
+print('adminPage.h: %d bytes -> %d gzipped, etag %s' % (len(html), len(gz), etag))
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+# Reads output pin traces recorded by clocks with PIN_TRACE enabled (see arduino-clock/pintrace.cpp) - either the binary
+# trace from GET /pintrace, or the VCD the clock writes over serial - and converts them to VCD, or works out the
+# display and signal timing from them.
+# Usage: python3 pintrace.py vcd <trace.bin>      (VCD to stdout, for GTKWave etc.)
+#        python3 pintrace.py stats [--measure MS] <trace.bin|trace.vcd>
+# Beep onset jitter is measured against the signal's measure, which the trace gives (that of the latest pattern to play -
+# see PAT_MEASURE), or 1000ms for traces without it. --measure overrides it, e.g. if other patterns played before it.
+# To capture: curl -o trace.bin http://<clock IP>/pintrace - or send 't' over serial at 115200 and save what comes back
+
+import statistics, struct, sys
+
+VERSION = 2
+RECORD = 6
+ROLES = ['anode1', 'anode2', 'anode3', 'cathA1', 'cathA2', 'cathA3', 'cathA4', 'cathB1', 'cathB2', 'cathB3', 'cathB4',
+         'piezo', 'switch', 'pulse', 'backlight']
+WIDE = 'backlight'  # recorded as 0-255 - the rest are 0/1
+# Which tubes each anode channel lights, via cathode drivers A and B (see cycleDisplay() in dispNixie.cpp)
+TUBES = {'anode1': (2, 5), 'anode2': (4, 1), 'anode3': (0, 3)}
+MEASURE = 1000  # ms - unless the trace or --measure says otherwise
+
+def load_bin(data, path):
+    head = 6 + len(ROLES)
+    if len(data) < head or data[:2] != b'PT' or data[2] != VERSION or data[3] != RECORD or (len(data) - head) % RECORD:
+        sys.exit('%s: not a version %d pin trace' % (path, VERSION))
+    names = {}
+    for i, pin in enumerate(data[4:4 + len(ROLES)]):
+        if pin != 255:  # none, or not recorded (per PIN_TRACE_ROLES)
+            names[pin] = ROLES[i]
+    measure = struct.unpack('<H', data[head-2:head])[0] or MEASURE
+    events = []
+    t = last = None
+    for pos in range(head, len(data), RECORD):
+        us, pin, val = struct.unpack('<IBB', data[pos:pos+RECORD])
+        t = 0 if t is None else t + ((us - last) & 0xFFFFFFFF)  # micros() wraps every 71 minutes
+        last = us
+        if pin in names:
+            events.append((t, names[pin], val))
+    return [r for r in ROLES if r in names.values()], events, measure
+
+def load_vcd(text):
+    ids = {}
+    roles = []
+    events = []
+    measure = MEASURE
+    t = 0
+    for line in text.splitlines():
+        tok = line.split()
+        if not tok:
+            continue
+        if tok[:2] == ['$comment', 'measure']:
+            measure = int(tok[2])
+        elif tok[0] == '$var':
+            ids[tok[3]] = tok[4]
+            roles.append(tok[4])
+        elif tok[0].startswith('#'):
+            t = int(tok[0][1:])
+        elif tok[0][0] in '01' and tok[0][1:] in ids:
+            events.append((t, ids[tok[0][1:]], int(tok[0][0])))
+        elif tok[0][0] == 'b' and len(tok) > 1 and tok[1] in ids:
+            events.append((t, ids[tok[1]], int(tok[0][1:], 2)))
+    return roles, events, measure
+
+def load(path):
+    data = open(path, 'rb').read()
+    if data[:2] == b'PT':
+        return load_bin(data, path)
+    return load_vcd(data.decode('ascii', 'replace'))
+
+def vcd(path):
+    roles, events, measure = load(path)
+    ids = {r: chr(ord('!') + i) for i, r in enumerate(roles)}
+    out = ['$comment measure %d ms $end' % measure, '$timescale 1us $end', '$scope module clock $end']
+    out += ['$var wire %d %s %s $end' % (8 if r == WIDE else 1, ids[r], r) for r in roles]
+    out += ['$upscope $end', '$enddefinitions $end']
+    t = None
+    for et, name, val in events:
+        if et != t:
+            out.append('#%d' % et)
+            t = et
+        out.append('b{:b} {}'.format(val, ids[name]) if name == WIDE else '%d%s' % (val, ids[name]))
+    print('\n'.join(out))
+
+def spread(vals, unit='us'):
+    if not vals:
+        return 'none'
+    vals = sorted(vals)
+    return 'min %d%s, median %d%s, max %d%s (%d)' % (vals[0], unit, vals[len(vals) // 2], unit, vals[-1], unit, len(vals))
+
+def display_stats(events):
+    # Per-tube duty cycle, frame rate, and dead time - once every anode and cathode line has been seen, since the
+    # trace may have wrapped partway through a frame
+    lines = ['anode1', 'anode2', 'anode3'] + ['cath%s%d' % (b, i) for b in 'AB' for i in range(1, 5)]
+    state = {}
+    start = None
+    lit = [0] * 6
+    anode_on = {a: 0 for a in TUBES}
+    rises = []
+    dead = []
+    overlaps = 0
+    last_fall = None
+    t_prev = None
+
+    def digit(bus):
+        return sum(state['cath%s%d' % (bus, i)] << (i - 1) for i in range(1, 5))
+
+    for t, name, val in events:
+        if start is not None and t > t_prev:
+            for a, (ta, tb) in TUBES.items():
+                if state[a]:
+                    anode_on[a] += t - t_prev
+                    if digit('A') < 10:
+                        lit[ta] += t - t_prev
+                    if digit('B') < 10:
+                        lit[tb] += t - t_prev
+        t_prev = t
+        if name not in lines:
+            continue
+        was = state.get(name)
+        state[name] = val
+        if start is None and all(l in state for l in lines):
+            start = t
+            continue
+        if start is None or name not in TUBES or was == val:
+            continue
+        if val:
+            if name == 'anode1':
+                rises.append(t)
+            if any(state[a] for a in TUBES if a != name):
+                overlaps += 1
+            elif last_fall is not None:
+                dead.append(t - last_fall)
+        else:
+            last_fall = t
+    if start is None or t_prev <= start:
+        return ['No nixie multiplexing in trace']
+    span = t_prev - start
+    out = ['Display, over %.1fms:' % (span / 1000)]
+    for a in TUBES:
+        out.append('  %s on %.1f%%' % (a, 100 * anode_on[a] / span))
+    out.append('  tube duty: ' + '  '.join('%d: %.1f%%' % (i, 100 * lit[i] / span) for i in range(6)))
+    if len(rises) > 1:
+        out.append('  frame rate %.1fHz (%d frames)' % ((len(rises) - 1) * 1e6 / (rises[-1] - rises[0]), len(rises) - 1))
+    out.append('  dead time between channels: ' + spread(dead))
+    if overlaps:
+        out.append('  channels overlapped %d time(s)' % overlaps)
+    return out
+
+def beep_stats(events, measure):
+    # Beep lengths, and onset jitter: how far each onset is from a measure (µs) after the last measure's matching onset
+    onsets = []
+    lengths = []
+    on = None
+    for t, name, val in events:
+        if name != 'piezo':
+            continue
+        if val and on is None:
+            on = t
+            onsets.append(t)
+        elif not val and on is not None:
+            lengths.append(t - on)
+            on = None
+    if not onsets:
+        return ['No beeps in trace']
+    devs = []
+    for t in onsets:
+        nxt = min(onsets, key=lambda u: abs(u - t - measure))
+        if abs(nxt - t - measure) < measure // 20:
+            devs.append(nxt - t - measure)
+    out = ['Beeps: %d, measure %dms' % (len(onsets), measure // 1000), '  length: ' + spread(lengths)]
+    if devs:
+        out.append('  onset jitter, measure to measure: mean %+.1fus, stdev %.1fus, worst %+dus (%d pairs)' % (
+            statistics.mean(devs), statistics.pstdev(devs), max(devs, key=abs), len(devs)))
+    else:
+        out.append('  onset jitter: need at least two measures')
+    return out
+
+def stats(path, measure=None):
+    roles, events, traced = load(path)
+    if not events:
+        sys.exit('%s: empty trace' % path)
+    print('%d changes over %.1fms' % (len(events), (events[-1][0] - events[0][0]) / 1000))
+    if 'anode1' in roles:
+        print('\n'.join(display_stats(events)))
+    if 'piezo' in roles:
+        print('\n'.join(beep_stats(events, (measure or traced) * 1000)))
+    elif 'anode1' in roles:
+        print('(Only the display was recorded - see PIN_TRACE_ROLES)')
+
+args = sys.argv[1:]
+if len(args) == 2 and args[0] == 'vcd':
+    vcd(args[1])
+elif len(args) == 2 and args[0] == 'stats':
+    stats(args[1])
+elif len(args) == 4 and args[0] == 'stats' and args[1] == '--measure' and args[2].isdigit() and int(args[2]):
+    stats(args[3], int(args[2]))
+else:
+    sys.exit('Usage: pintrace.py vcd <trace.bin> | pintrace.py stats [--measure MS] <trace.bin|trace.vcd>')
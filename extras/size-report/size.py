@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+# Compiles the sketch for each config, and reports flash and RAM use - for comparing two versions, e.g. to check that
+# a feature a config disables really compiles out (see traits.h). Requires arduino-cli, with the board cores and the
+# libraries the configs use installed.
+# Usage: python3 size.py [before [after]] - git revisions, default HEAD and the working tree, e.g. python3 size.py HEAD~1
+
+import os, re, shutil, subprocess, sys, tempfile
+
+here = os.path.dirname(os.path.abspath(__file__))
+root = os.path.abspath(os.path.join(here, '..', '..'))
+sketch = 'arduino-clock'
+
+# Configs for Nano 33 IoT (network, IMU) - the rest are for the classic Nano
+IOT = ('led-iot.h',)
+FQBN = {True: 'arduino:samd:nano_33_iot', False: 'arduino:avr:nano'}
+
+def checkout(rev, dest):
+    # Copies the sketch as of rev (or the working tree, if None) into dest
+    if rev is None:
+        shutil.copytree(os.path.join(root, sketch), dest)
+        return
+    os.makedirs(dest)
+    tar = subprocess.run(['git', '-C', root, 'archive', rev, sketch], check=True, stdout=subprocess.PIPE).stdout
+    subprocess.run(['tar', '-x', '-C', os.path.dirname(dest)], input=tar, check=True)
+
+def compile(src, config):
+    # Returns (flash, ram) bytes for src built with config, or None if it doesn't build
+    hdr = os.path.join(src, 'arduino-clock.h')
+    with open(hdr) as f:
+        h = f.read()
+    with open(hdr, 'w') as f:
+        f.write(re.sub(r'#include "configs/[^"]+"', '#include "configs/%s"' % config, h, count=1))
+    out = subprocess.run(['arduino-cli', 'compile', '--fqbn', FQBN[config in IOT], src],
+                         stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True).stdout
+    flash = re.search(r'Sketch uses (\d+) bytes', out)
+    ram = re.search(r'Global variables use (\d+) bytes', out)
+    if not flash or not ram:
+        return None
+    return int(flash.group(1)), int(ram.group(1))
+
+def sizes(rev, tmp):
+    dest = os.path.join(tmp, rev or 'worktree', sketch)
+    checkout(rev, dest)
+    configs = sorted(c for c in os.listdir(os.path.join(dest, 'configs')) if c.endswith('.h') and not c.startswith('~'))
+    return {c: compile(dest, c) for c in configs}
+
+def cell(a, b, i):
+    if a is None or b is None:
+        return '%8s %8s %7s' % ((a and a[i]) or '-', (b and b[i]) or '-', '')
+    return '%8d %8d %+7d' % (a[i], b[i], b[i]-a[i])
+
+revs = sys.argv[1:3]
+before = revs[0] if len(revs) > 0 else 'HEAD'
+after = revs[1] if len(revs) > 1 else None
+with tempfile.TemporaryDirectory() as tmp:
+    a = sizes(before, tmp)
+    b = sizes(after, tmp)
+print('%-24s %26s   %26s' % ('', 'flash', 'RAM'))
+print('%-24s %8s %8s %7s   %8s %8s %7s' % ('config', before, after or 'worktree', '', before, after or 'worktree', ''))
+for c in sorted(set(a) | set(b)):
+    print('%-24s %s   %s' % (c, cell(a.get(c), b.get(c), 0), cell(a.get(c), b.get(c), 1)))
@@ -0,0 +1,215 @@
+//Tests for the admin page and API (arduino-clock/network.cpp, with http.cpp parsing and storage.cpp behind it), as on a
+//Wi-Fi clock: each request is sent by a client of stub/WiFiNINA.h and served by the network cycle, as on the clock.
+//Whatever comes in, each request must be answered (or timed out) and closed, a request that's refused must change no
+//settings, a request that's accepted must leave them within the schema (opts.h), and no storage read or write may be
+//out of range (see storageInRange()). The corpus is real requests from the page and the API, and seeds the fuzzer.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "network.h"
+#include "storage.h"
+#include "pattern.h"
+#include "opts.h"
+#include <WiFiNINA.h>
+#define TEST_FUZZ
+#include "harness.h"
+
+//What network.cpp needs from the rest of the sketch - the clock, display and signals, as far as it can tell
+static byte fn = FN_TOD, timerState = 0, alarmState = 0;
+unsigned long getUptime(){ return millis()/1000; }
+word getLoopRate(){ return 1000; }
+word getLoopStallMax(){ return 5; }
+void goToFn(byte thefn, byte thefnPg){ fn = thefn; }
+void setAlarmState(byte state){ alarmState = state; }
+byte getAlarmState(){ return alarmState; }
+void findFnAndPageNumbers(){}
+void millisReset(){}
+byte getTimerState(){ return timerState; }
+void setTimerState(char pos, bool val){ bitWrite(timerState,pos,val); }
+byte getDisplayDim(){ return 2; }
+byte getDisplayDigit(byte pos){ return pos; }
+byte getFn(){ return fn; }
+byte getFnPg(){ return 0; }
+byte getFnSetPg(){ return 0; }
+int getSignalActive(){ return -1; }
+void tempDisplay(int i0, int i1, int i2, int i3){}
+void updateDisplay(){}
+void calcSun(){}
+unsigned long getSignalCount(byte sigFn){ return 0; }
+void quickBeep(int pitch){}
+void quickBeepPattern(int source, int pattern, byte alarm){}
+byte getVersionPart(byte part){ return part; }
+bool piezoQueue(word hz, word dur, word gap, bool mark){ return true; }
+byte piezoRoom(){ return 255; }
+unsigned long getPowerSleepSecs(){ return 0; }
+unsigned long getPowerAwakeSecs(){ return 0; }
+word getPowerDuty(){ return 1000; }
+unsigned long getPowerWakes(){ return 0; }
+unsigned long getPowerWakeRate(){ return 0; }
+unsigned long getPowerInputWakes(){ return 0; }
+extern "C" { char __end__; } //start of the heap, per the linker script - for heapPeak()
+
+#include "extracted.inc"
+
+extern unsigned long adminInputLast; //network.cpp - so a test can tell whether admin is active
+#define SETTINGS_SPACE (ALARM_LOC+(ALARMS-1)*ALARM_SIZE) //storage through the alarm records
+
+static void startAdmin(){
+  //As if from the clock's menu - once it's up, and again if it's timed out
+  static bool up = false;
+  if(!up){ stubMillis = 1000; initStorage(); initNetwork(); up = true; }
+  if(!adminInputLast) networkStartAdmin();
+}
+
+static std::string serve(const std::string &request, bool *ended){
+  //Sends the request from a new client, and runs the network cycle until the clock is done with it - the client hangs
+  //up once the clock has stopped sending. Returns what the clock sent.
+  StubConn conn; conn.in = request;
+  stubConns.assign(1,&conn);
+  size_t sentLast = 0;
+  for(word i=0; i<400 && !conn.closed; i++){
+    cycleNetwork();
+    stubMillis += 50;
+    if(conn.out.size() && conn.out.size()==sentLast) conn.open = false;
+    sentLast = conn.out.size();
+  }
+  stubConns.clear();
+  *ended = conn.closed || request.empty(); //a client that sends nothing is never taken on - see WiFiServer::available()
+  return conn.out;
+}
+
+static int status(const std::string &response){
+  //e.g. 200 from HTTP/1.1 200 OK - or 0 if there wasn't one
+  if(response.compare(0,9,"HTTP/1.1 ") || response.size()<12) return 0;
+  return atoi(response.substr(9,3).c_str());
+}
+
+static std::string body(const std::string &response){
+  size_t p = response.find("\r\n\r\n");
+  return (p==std::string::npos? "": response.substr(p+4));
+}
+
+static void snapshot(byte *s){ for(int loc=0; loc<SETTINGS_SPACE; loc++) s[loc] = readEEPROM(loc,false); }
+
+static bool changed(const byte *before, int loc, byte size){
+  for(byte i=0; i<size; i++) if(before[loc+i]!=readEEPROM(loc+i,false)) return true;
+  return false;
+}
+
+static int checkSettings(const byte *before){
+  //Any setting that was changed must be within its schema
+  int fails = 0;
+  for(byte opt=0; opt<getOptCount(); opt++){
+    OptDef o = getOpt(opt);
+    bool isInt = (o.size==2);
+    if(!changed(before,o.loc,o.size)) continue;
+    int v = readEEPROM(o.loc,isInt);
+    CHECK(o.applies && v>=o.min && v<=o.max,"setting at %d changed to %d, outside %d-%d",o.loc,v,o.min,o.max);
+  }
+  for(byte a=1; a<ALARMS; a++) for(byte field=0; field<ALARM_SIZE; field++){
+    OptDef o = getAlarmOpt(field);
+    if(!o.applies) continue;
+    int loc = alarmLoc(a,field);
+    if(!changed(before,loc,o.size)) continue;
+    int v = readEEPROM(loc,o.size==2);
+    CHECK(v>=o.min && v<=o.max,"alarm %d field %d changed to %d, outside %d-%d",a,field,v,o.min,o.max);
+  }
+  return fails;
+}
+
+static int checkRequest(const std::string &request, std::string *response){
+  //Serves the request and checks what it did
+  int fails = 0;
+  startAdmin();
+  byte before[SETTINGS_SPACE];
+  snapshot(before);
+  unsigned long rejects = getStorageRejects();
+  bool ended;
+  *response = serve(request,&ended);
+  CHECK(ended,"client never let go");
+  CHECK(response->empty() || status(*response),"not an HTTP response: %.40s",response->c_str());
+  CHECK(getStorageRejects()==rejects,"out-of-range storage read/write");
+  int st = status(*response);
+  if(st!=200 || !body(*response).compare(0,6,"Error:")){
+    byte after[SETTINGS_SPACE];
+    snapshot(after);
+    CHECK(!memcmp(before,after,SETTINGS_SPACE),"request refused (%d), but settings changed",st);
+  }
+  else fails += checkSettings(before);
+  return fails;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+  std::string response;
+  if(checkRequest(std::string((const char*)data,size),&response)) abort(); //so libFuzzer keeps the input
+  return 0;
+}
+
+static std::string request(const char *method, const char *path, const std::string &body){
+  std::string r = std::string(method)+" "+path+" HTTP/1.1\r\nHost: 7.7.7.7\r\n";
+  if(body.size()) r += "Content-Length: "+std::to_string(body.size())+"\r\n";
+  return r+"\r\n"+body;
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  std::string r;
+  //Settings, as the page and API set them: all or nothing
+  fails += checkRequest(request("PATCH","/settings","{\"b16\":2,\"b19\":1,\"i28\":1320}"),&r);
+  CHECK(status(r)==200 && readEEPROM(16,false)==2 && readEEPROM(19,false)==1 && readEEPROM(28,true)==1320,"PATCH: %s",body(r).c_str());
+  fails += checkRequest(request("PATCH","/settings","{\"b16\":1,\"b19\":9}"),&r);
+  CHECK(status(r)==400 && body(r).find("b19: out of range")!=std::string::npos && readEEPROM(16,false)==2,"PATCH out of range: %s",body(r).c_str());
+  fails += checkRequest(request("PATCH","/settings","{\"b250\":1}"),&r);
+  CHECK(status(r)==400 && body(r).find("unknown setting")!=std::string::npos,"PATCH past storage: %s",body(r).c_str());
+  fails += checkRequest(request("PATCH","/settings","{\"i16\":1}"),&r);
+  CHECK(status(r)==400,"PATCH byte setting as int: %s",body(r).c_str());
+  char key[8]; snprintf(key,sizeof(key),"b%d",alarmLoc(1,AL_DAYS));
+  fails += checkRequest(request("PATCH","/settings",std::string("{\"")+key+"\":0}"),&r);
+  CHECK(status(r)==400,"PATCH alarm days 0: %s",body(r).c_str());
+  fails += checkRequest(request("POST","/","b16=1&b17=3"),&r);
+  CHECK(body(r)=="ok" && readEEPROM(16,false)==1,"POST: %s",body(r).c_str());
+  fails += checkRequest(request("POST","/","wssid="+std::string(33,'x')),&r);
+  CHECK(!body(r).compare(0,6,"Error:"),"POST long SSID: %s",body(r).c_str());
+  fails += checkRequest(request("POST","/","ntpip=1.2.3.400"),&r);
+  CHECK(!body(r).compare(0,6,"Error:"),"POST bad IP: %s",body(r).c_str());
+  //Reading them back
+  fails += checkRequest(request("GET","/settings",""),&r);
+  CHECK(status(r)==200 && body(r).find("\"b16\":1")!=std::string::npos && body(r).find("\"i28\":1320")!=std::string::npos,"GET /settings: %.200s",body(r).c_str());
+  fails += checkRequest(request("GET","/metrics",""),&r);
+  CHECK(status(r)==200 && body(r).find("clock_storage_rejected_total 0")!=std::string::npos,"GET /metrics: %.200s",body(r).c_str());
+  //The event stream, for a client that stays on it: the mirror of the display, then let go once it hangs up
+  StubConn stream; stream.in = request("GET","/events","");
+  stubConns.assign(1,&stream);
+  for(byte i=0; i<10; i++){ cycleNetwork(); stubMillis += 50; }
+  std::string event = "data: {\"n\":6,\"d\":\"012345\",\"dim\":2,\"fn\":"+std::to_string(getFn())+",\"pg\":0,\"set\":0,\"sig\":-1}";
+  CHECK(stream.out.find(event)!=std::string::npos,"GET /events: %.300s",stream.out.c_str());
+  stream.open = false;
+  for(byte i=0; i<10 && !stream.closed; i++){ cycleNetwork(); stubMillis += 50; }
+  CHECK(stream.closed,"event stream never let go");
+  stubConns.clear();
+  //Malformed, or incomplete - answered, or timed out, either way let go
+  fails += checkRequest("PATCH /settings HTTP/1.1\r\nContent-Length: 9\r\n\r\n{\"b16\":",&r);
+  CHECK(r.empty(),"incomplete request answered: %.40s",r.c_str());
+  fails += checkRequest(request("PATCH","/settings","{\"b16\":2,"),&r);
+  CHECK(status(r)==400 && body(r).find("malformed")!=std::string::npos,"malformed JSON: %s",body(r).c_str());
+  //The corpus, as the fuzzer would have it
+  for(auto &c : corpus){
+    fails += checkRequest(c.second,&r);
+    CHECK(status(r),"%s: no response",c.first.c_str());
+  }
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //A whole request, from the client connecting to it letting go - mostly cycles waiting on the client, as on the clock
+  std::string patch = request("PATCH","/settings","{\"b16\":2,\"b17\":3,\"i28\":1320}"), get = request("GET","/settings","");
+  bool ended;
+  startAdmin();
+  unsigned long n = 20000;
+  double t0 = testNow();
+  for(unsigned long i=0; i<n; i++) serve(patch,&ended);
+  printf("PATCH /settings: %.2f us/request\n",(testNow()-t0)*1e6/n);
+  t0 = testNow();
+  for(unsigned long i=0; i<n; i++) serve(get,&ended);
+  printf("GET /settings: %.2f us/request\n",(testNow()-t0)*1e6/n);
+}
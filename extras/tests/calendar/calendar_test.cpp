@@ -0,0 +1,151 @@
+//Tests for the calendar math in arduino-clock.ino (lifted out by run.py - see extracted.inc), against a reference
+//calendar: every date from 1900 to 2200, the DST rulesets, and the time/day ranges, plus the fake RTC's rollover
+//(rtcMillis.cpp). Fuzzing draws dates from the clock's whole settable range (to 9999). The corpus only seeds that.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "rtcMillis.h"
+#include "storage.h"
+#define TEST_FUZZ
+#include "harness.h"
+
+//What the extracted functions need from the rest of the sketch
+static int dstRuleset = 0;
+int readEEPROM(int loc, bool isInt){ return (loc==22? dstRuleset: 0); }
+bool writeEEPROM(int loc, int val, bool isInt, bool commit){ return false; }
+void millisReset(){}
+
+#include "extracted.inc"
+
+//Reference calendar: days since 1970-01-01 (proleptic Gregorian), per Howard Hinnant's days_from_civil
+static long civil(long y, int m, int d){
+  y -= m<=2;
+  long era = (y>=0? y: y-399)/400;
+  long yoe = y-era*400;
+  long doy = (153*(m+(m>2? -3: 9))+2)/5+d-1;
+  long doe = yoe*365+yoe/4-yoe/100+doy;
+  return era*146097+doe-719468;
+}
+static int refDaysInMonth(long y, int m){ return civil(y+(m==12),m%12+1,1)-civil(y,m,1); }
+static int refWeekday(long days){ return (int)((days%7+11)%7); } //0=Sunday - 1970-01-01 was a Thursday
+static long occurrence(long y, int m, int d){ //2/29 falls on 3/1 in common years, as dateComp() has it
+  return (d>refDaysInMonth(y,m)? civil(y,m+1,1): civil(y,m,d));
+}
+static int refDateComp(long y, int m, int d, int mt, int dt, bool countUp){
+  //Days since the target date last came (on or before today - but before, for 12/31), or until it next comes
+  long today = civil(y,m,d);
+  if(countUp){
+    long t = occurrence(y,mt,dt);
+    if(t>today || (t==today && mt==12 && dt==31)) t = occurrence(y-1,mt,dt);
+    return today-t;
+  }
+  long t = occurrence(y,mt,dt);
+  if(t<today) t = occurrence(y+1,mt,dt);
+  return t-today;
+}
+static int refNthSunday(long y, int m, int nth){
+  int first = 1+(7-refWeekday(civil(y,m,1)))%7;
+  int last = first; while(last+7<=refDaysInMonth(y,m)) last += 7;
+  return (nth>0? first+(nth-1)*7: last+(nth+1)*7);
+}
+//DST rulesets, as in isDST(): start and end month/nth Sunday - the change is at 2am on those days
+struct Rule { int sm, sn, em, en; };
+static const Rule rules[] = {{0,0,0,0}, {3,2,11,1}, {3,-1,10,-1}, {4,1,10,-1}, {9,-1,4,1}, {10,1,4,1}, {10,3,2,3}};
+static bool refIsDST(int rule, long y, int m, int d){
+  const Rule &r = rules[rule];
+  if(!rule) return false;
+  long today = civil(y,m,d), start = civil(y,r.sm,refNthSunday(y,r.sm,r.sn)), end = civil(y,r.em,refNthSunday(y,r.em,r.en));
+  return (start<end? today>=start && today<end: today>=start || today<end);
+}
+
+static int checkDate(long y, int m, int d){
+  //Everything about one date, against the reference
+  int fails = 0;
+  long days = civil(y,m,d);
+  CHECK(daysInMonth(y,m)==refDaysInMonth(y,m),"daysInMonth(%ld,%d) %d",y,m,daysInMonth(y,m));
+  CHECK(dayOfWeek(y,m,d)==refWeekday(days),"dayOfWeek(%ld,%d,%d) %d, not %d",y,m,d,dayOfWeek(y,m,d),refWeekday(days));
+  CHECK(dateToDayCount(y,m,d)==days-civil(y,1,1),"dateToDayCount(%ld,%d,%d) %d",y,m,d,dateToDayCount(y,m,d));
+  //Targets: the year's edges, the leap day, and the days around this one
+  int targets[][2] = {{1,1}, {2,28}, {2,29}, {3,1}, {12,31}, {m,d}, {m,d==1? 1: d-1}, {m,d<28? d+1: 28}};
+  for(auto &t : targets) for(byte up=0; up<2; up++){
+    int got = dateComp(y,m,d,t[0],t[1],up), want = refDateComp(y,m,d,t[0],t[1],up);
+    CHECK(got==want,"dateComp(%ld,%d,%d, %d/%d, %s) %d, not %d",y,m,d,t[0],t[1],up?"up":"down",got,want);
+  }
+  return fails;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+  //A date 1900-9999 and a target, then a time and a day range - all against the reference
+  if(size<11) return 0;
+  int fails = 0;
+  long y = 1900+(data[0]|(data[1]<<8))%8100; int m = 1+data[2]%12; int d = 1+data[3]%refDaysInMonth(y,m);
+  int mt = 1+data[4]%12, dt = 1+data[5]%(mt==2? 29: refDaysInMonth(2000,mt));
+  fails += checkDate(y,m,d);
+  CHECK(dateComp(y,m,d,mt,dt,data[6]&1)==refDateComp(y,m,d,mt,dt,data[6]&1),"dateComp(%ld,%d,%d, %d/%d)",y,m,d,mt,dt);
+  word t0 = (data[7]|(data[8]<<8))%1440, t1 = (data[9]|(data[10]<<8))%1440, t = (t0*7+t1)%1440;
+  bool in = false; for(word i=t0; i!=t1; i=(i+1)%1440) if(i==t){ in = true; break; }
+  CHECK(isTimeInRange(t0,t1,t)==in,"isTimeInRange(%u,%u,%u)",t0,t1,t);
+  if(fails) abort(); //so libFuzzer keeps the input
+  return 0;
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  //Every date 1900-2200
+  for(long y=1900; y<=2200; y++){
+    CHECK(daysInYear(y)==civil(y+1,1,1)-civil(y,1,1),"daysInYear(%ld) %d",y,daysInYear(y));
+    for(int m=1; m<=12; m++){
+      for(int d=1; d<=refDaysInMonth(y,m); d++) fails += checkDate(y,m,d);
+      for(int nth : {1, 2, 3, 4, -1, -2})
+        CHECK(nthSunday(y,m,nth)==refNthSunday(y,m,nth),"nthSunday(%ld,%d,%d) %d, not %d",y,m,nth,nthSunday(y,m,nth),refNthSunday(y,m,nth));
+    }
+  }
+  //DST, per each ruleset - and switching at 2am on the day of each change
+  for(dstRuleset=0; dstRuleset<7; dstRuleset++) for(long y=2000; y<=2100; y++) for(int m=1; m<=12; m++)
+    for(int d=1; d<=refDaysInMonth(y,m); d++){
+      bool dst = refIsDST(dstRuleset,y,m,d);
+      CHECK(isDST(y,m,d)==dst,"ruleset %d: isDST(%ld,%d,%d)",dstRuleset,y,m,d);
+      long py = y; int pm = m, pd = d-1; //the day before
+      if(!pd){ pm = m-1; if(!pm){ pm = 12; py--; } pd = refDaysInMonth(py,pm); }
+      bool was = refIsDST(dstRuleset,py,pm,pd);
+      CHECK(isDSTByHour(y,m,d,1,false)==was && isDSTByHour(y,m,d,2,false)==dst,"ruleset %d: isDSTByHour(%ld,%d,%d)",dstRuleset,y,m,d);
+    }
+  dstRuleset = 0;
+  //Day ranges, every one; time ranges, every start/end with a few test times
+  for(byte s=0; s<7; s++) for(byte e=0; e<7; e++) for(byte t=0; t<7; t++){
+    bool in = false; for(byte i=s; ; i=(i+1)%7){ if(i==t) in = true; if(i==e) break; } //inclusive
+    CHECK(isDayInRange(s,e,t)==in,"isDayInRange(%d,%d,%d)",s,e,t);
+  }
+  for(word s=0; s<1440; s+=7) for(word e=0; e<1440; e+=11) for(word t : {(word)0, s, e, (word)((s+1)%1440), (word)((e+1439)%1440), (word)1439}){
+    bool in = (s<e? t>=s && t<e: s>e && (t>=s || t<e));
+    CHECK(isTimeInRange(s,e,t)==in,"isTimeInRange(%u,%u,%u)",s,e,t);
+  }
+  //The fake RTC rolls over the year
+  rtcSetDate(2023,12,31,0); rtcSetTime(23,59,59);
+  stubMillis += 1500; rtcTakeSnap();
+  CHECK(rtcGetYear()==2024 && rtcGetMonth()==1 && rtcGetDate()==1 && rtcGetWeekday()==1,"rtcMillis after 2023-12-31: %d-%d-%d",rtcGetYear(),rtcGetMonth(),rtcGetDate());
+  rtcSetDate(2024,2,28,3); rtcSetTime(23,59,59);
+  stubMillis += 1000; rtcTakeSnap();
+  CHECK(rtcGetMonth()==2 && rtcGetDate()==29,"rtcMillis after 2024-02-28: %d-%d",rtcGetMonth(),rtcGetDate());
+  //The corpus, as the fuzzer would have it
+  for(auto &c : corpus) LLVMFuzzerTestOneInput((const uint8_t*)c.second.data(),c.second.size());
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //The date math runs on every display update that shows a date or day count, so: ns per call
+  volatile long sink = 0;
+  unsigned long n = 0;
+  double t0 = testNow();
+  for(long y=1900; y<=2200; y++) for(byte m=1; m<=12; m++) for(byte d=1; d<=28; d++, n++) sink += dayOfWeek(y,m,d);
+  printf("dayOfWeek: %.1f ns/call\n",(testNow()-t0)*1e9/n);
+  t0 = testNow();
+  for(long y=1900; y<=2200; y++) for(byte m=1; m<=12; m++) for(byte d=1; d<=28; d++) sink += dateToDayCount(y,m,d);
+  printf("dateToDayCount: %.1f ns/call\n",(testNow()-t0)*1e9/n);
+  t0 = testNow();
+  for(long y=1900; y<=2200; y++) for(byte m=1; m<=12; m++) for(byte d=1; d<=28; d++) sink += dateComp(y,m,d,(m*5)%12+1,d,d&1);
+  printf("dateComp: %.1f ns/call\n",(testNow()-t0)*1e9/n);
+  t0 = testNow();
+  for(long y=1900; y<=2200; y++) for(byte m=1; m<=12; m++) for(byte d=1; d<=28; d++) sink += nthSunday(y,m,(d&1)? 2: -1);
+  printf("nthSunday: %.1f ns/call\n",(testNow()-t0)*1e9/n);
+}
@@ -0,0 +1,124 @@
+//Tests for the admin page's HTTP request parser (arduino-clock/http.cpp), fed a byte at a time as checkClients() can.
+//The corpus is real requests, named for how the parser should finish with them: ok-* (complete), stream-* (body left
+//for the caller, as with POST /update), or <status>-* (rejected with that status). It also seeds the fuzzer.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "http.h"
+#define TEST_FUZZ
+#include "harness.h"
+
+static HttpRequest req;
+
+static byte feedBytes(HttpRequest *r, const std::string &s){
+  //Byte by byte, stopping where checkClients() would
+  httpReset(r);
+  for(size_t i=0; i<s.size(); i++) if(httpFeed(r,s[i])>=HTTP_ST_DONE) break;
+  return r->state;
+}
+
+static byte feedChunks(HttpRequest *r, const std::string &s){
+  //In random chunks, as they'd come from the client
+  httpReset(r);
+  size_t pos = 0;
+  while(pos<s.size() && r->state<HTTP_ST_DONE){
+    int n = 1+testRand()%64;
+    if(n>(int)(s.size()-pos)) n = s.size()-pos;
+    pos += httpFeedBuf(r,(const byte*)s.data()+pos,n);
+  }
+  return r->state;
+}
+
+static bool terminated(const char *buf, size_t size){
+  return memchr(buf,'\0',size)!=NULL;
+}
+
+static int checkInvariants(HttpRequest *r){
+  int fails = 0;
+  CHECK(terminated(r->methodBuf,HTTP_METHOD_MAX),"method not terminated");
+  CHECK(terminated(r->path,HTTP_PATH_MAX),"path not terminated");
+  CHECK(terminated(r->hdrName,HTTP_HDR_NAME_MAX),"header name not terminated");
+  CHECK(terminated(r->hdrVal,HTTP_HDR_VAL_MAX),"header value not terminated");
+  CHECK(terminated(r->ifNoneMatch,HTTP_ETAG_MAX),"If-None-Match not terminated");
+  CHECK(terminated(r->auth,sizeof(r->auth)),"Authorization not terminated");
+  CHECK(r->bodyLen<=HTTP_BODY_MAX && r->body[r->bodyLen]=='\0',"body length %u",r->bodyLen);
+  CHECK(r->headLen<=HTTP_HEAD_MAX+1,"head length %u",r->headLen);
+  CHECK(r->state!=HTTP_ST_ERROR || httpReason(r->error)!=httpReason(500),"error %d has no reason",r->error);
+  return fails;
+}
+
+static int walkBody(HttpRequest *r){
+  //What network.cpp does with a complete request's body: form or JSON members, IPs, and JSON back out
+  int fails = 0, guard = 0;
+  static byte outBuf[512];
+  HttpOut out(outBuf,sizeof(outBuf));
+  out.begin(200,F("application/json"));
+  char *key, *val; byte ip[4];
+  if(r->body[0]=='{' || r->method==HTTP_PATCH){
+    char more;
+    while((more = httpJSONNext(r,&key,&val))==1 && ++guard<HTTP_BODY_MAX){
+      CHECK(key>=r->body && key<r->body+r->bodyLen+1 && val>=r->body && val<=r->body+r->bodyLen,"JSON member outside body");
+      httpParseIP(val,ip); httpPrintJSON(out,key); httpPrintJSON(out,val);
+    }
+  } else {
+    while(httpFormNext(r,&key,&val) && ++guard<HTTP_BODY_MAX){
+      CHECK(key>=r->body && key<=r->body+r->bodyLen && val>=r->body && val<=r->body+r->bodyLen,"form member outside body");
+      httpParseIP(val,ip); httpPrintJSON(out,key); httpPrintJSON(out,val);
+    }
+  }
+  CHECK(guard<HTTP_BODY_MAX,"body walk didn't finish");
+  out.end();
+  CHECK(out.overflowed() || out.length()>0,"no response");
+  return fails;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+  std::string s((const char*)data,size);
+  int fails = 0;
+  if(feedBytes(&req,s)==HTTP_ST_DONE) fails += walkBody(&req);
+  fails += checkInvariants(&req);
+  if(fails) abort(); //so libFuzzer keeps the input
+  return 0;
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  CHECK(!corpus.empty(),"no corpus");
+  for(auto &c : corpus){
+    const char *name = c.first.c_str();
+    byte expect = HTTP_ST_ERROR; int expectError = atoi(name);
+    if(!strncmp(name,"ok-",3)) expect = HTTP_ST_DONE;
+    else if(!strncmp(name,"stream-",7)) expect = HTTP_ST_STREAM;
+    byte state = feedBytes(&req,c.second);
+    CHECK(state==expect && (expect!=HTTP_ST_ERROR || req.error==expectError),"%s: state %d, error %d",name,state,req.error);
+    fails += checkInvariants(&req);
+    HttpRequest whole = req;
+    for(byte i=0; i<20; i++){ //chunking mustn't matter
+      feedChunks(&req,c.second);
+      CHECK(req.state==whole.state && req.error==whole.error && !strcmp(req.path,whole.path) && req.bodyLen==whole.bodyLen
+        && !memcmp(req.body,whole.body,req.bodyLen) && !strcmp(req.auth,whole.auth) && req.crc==whole.crc,"%s: differs in chunks",name);
+    }
+    if(state==HTTP_ST_DONE) fails += walkBody(&req);
+  }
+  //Header values we keep must not be cut short...
+  std::string big = "POST /settings HTTP/1.1\r\nContent-Length: "+std::string(HTTP_HDR_VAL_MAX,'0')+"5\r\n\r\nb16=2";
+  CHECK(feedBytes(&req,big)==HTTP_ST_ERROR && req.error==431,"long Content-Length: state %d, error %d",req.state,req.error);
+  //...and an Authorization too long to be ours is left out, rather than cut down to something that might be
+  std::string key(HTTP_HDR_VAL_MAX,'k');
+  CHECK(feedBytes(&req,"POST /update HTTP/1.1\r\nAuthorization: Bearer "+key+"\r\n\r\n")==HTTP_ST_DONE && !req.auth[0],"long Authorization");
+  //...but others can be
+  CHECK(feedBytes(&req,"GET / HTTP/1.1\r\nUser-Agent: "+std::string(500,'u')+"\r\n\r\n")==HTTP_ST_DONE,"long User-Agent");
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //Time to parse each corpus request, a byte at a time
+  for(auto &c : corpus){
+    const std::string &s = c.second;
+    unsigned long reps = 2000000/(s.size()+1)+1;
+    double t0 = testNow();
+    for(unsigned long i=0; i<reps; i++) feedBytes(&req,s);
+    double ns = (testNow()-t0)*1e9/reps;
+    printf("%-32s %5zu bytes %9.0f ns/request %6.1f ns/byte\n",c.first.c_str(),s.size(),ns,ns/(s.size()? s.size(): 1));
+  }
+}
@@ -0,0 +1,110 @@
+//Tests for over-the-air update staging (arduino-clock/ota.cpp), as on SAMD: the key check, the CRC, and the staging
+//area erased a row per cycle before the image is written - see stub/samd.h and stub/InternalStorage.h.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "ota.h"
+#include <InternalStorage.h>
+#include "harness.h"
+
+#define ROW 256
+#define PAGE 64
+
+static unsigned long crcOf(const std::string &s){
+  unsigned long crc = 0xFFFFFFFF;
+  for(char c : s) crc = crc32Update(crc,(byte)c);
+  return crc^0xFFFFFFFF;
+}
+
+static std::string randomImage(size_t len){
+  std::string s(len,'\0');
+  for(auto &c : s) c = (char)testRand();
+  return s;
+}
+
+static int upload(const std::string &image, unsigned long crc, bool *staged){
+  //As checkAdminSession() does it: the start of the image comes with the headers, then the rest in chunks
+  int fails = 0;
+  memset(stubStage,0x5A,sizeof(stubStage)); //not erased
+  CHECK(otaBegin(image.size()),"otaBegin(%zu)",image.size());
+  size_t pos = min(image.size(),(size_t)100);
+  otaWrite((const byte*)image.data(),pos);
+  unsigned long erases = stubNVM.CTRLA.reg.erases, passes = 0;
+  while(!otaReady()){
+    passes++;
+    CHECK(stubNVM.CTRLA.reg.erases-erases==passes,"erased more than a row per pass");
+  }
+  unsigned long rows = (image.size()+ROW-1)/ROW;
+  CHECK(stubNVM.CTRLA.reg.erases-erases==rows,"%lu rows erased for %zu bytes",stubNVM.CTRLA.reg.erases-erases,image.size());
+  CHECK(rows*ROW>=sizeof(stubStage) || stubStage[rows*ROW]==0x5A,"erased past the image");
+  CHECK(otaReceived()==pos,"held %lu bytes from the headers, not %zu",otaReceived(),pos);
+  while(pos<image.size()){
+    size_t n = min(image.size()-pos,(size_t)(1+testRand()%512));
+    otaWrite((const byte*)image.data()+pos,n);
+    pos += n;
+    CHECK(otaReady(),"not ready after erasing");
+  }
+  otaWrite((const byte*)"extra",5); //past the expected size - ignored
+  CHECK(otaReceived()==image.size(),"received %lu",otaReceived());
+  *staged = otaEnd(crc);
+  CHECK(*staged==otaStaged(),"otaStaged() disagrees");
+  if(*staged){
+    CHECK(!memcmp(stubStage,image.data(),image.size()),"staged image differs");
+    for(size_t i=image.size(); i%PAGE; i++) CHECK(stubStage[i]==0xFF,"last page not filled out at %zu",i);
+  }
+  return fails;
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  //Key
+  CHECK(otaKeyOk("Bearer " OTA_KEY),"right key");
+  CHECK(!otaKeyOk("Bearer " OTA_KEY "x"),"longer key");
+  CHECK(!otaKeyOk("Bearer test ke"),"shorter key");
+  CHECK(!otaKeyOk("Bearer test kez"),"wrong key");
+  CHECK(!otaKeyOk(OTA_KEY),"no Bearer");
+  CHECK(!otaKeyOk("Bearer "),"empty key");
+  CHECK(!otaKeyOk(""),"no Authorization");
+  //CRC-32, as the crc32 command has it
+  CHECK(crcOf("123456789")==0xCBF43926,"crc32 check value %08lX",crcOf("123456789"));
+  //Uploads
+  bool staged;
+  size_t sizes[] = {1, 3, PAGE, ROW, ROW+1, 5003, sizeof(stubStage)-7, sizeof(stubStage)};
+  for(size_t len : sizes){
+    std::string image = randomImage(len);
+    fails += upload(image,crcOf(image),&staged);
+    CHECK(staged,"%zu-byte image not staged",len);
+    otaApply();
+    CHECK(InternalStorage.applied,"not applied"); InternalStorage.applied = false;
+  }
+  std::string image = randomImage(3000);
+  fails += upload(image,crcOf(image)^1,&staged);
+  CHECK(!staged && !otaStaged(),"bad CRC staged");
+  otaApply();
+  CHECK(!InternalStorage.applied,"bad image applied");
+  //Too short: otaEnd() before it's all there
+  CHECK(otaBegin(1000),"otaBegin");
+  while(!otaReady());
+  otaWrite((const byte*)image.data(),999);
+  CHECK(!otaEnd(crcOf(image.substr(0,1000))) && !otaStaged(),"short image staged");
+  //Too big, or nothing
+  CHECK(!otaBegin(sizeof(stubStage)+1),"image bigger than staging area");
+  CHECK(!otaBegin(0),"empty image");
+  //Aborted partway through erasing: nothing written, and a new upload starts clean
+  CHECK(otaBegin(5000),"otaBegin");
+  otaReady();
+  otaAbort();
+  CHECK(!otaReady() && !otaStaged(),"still going after abort");
+  fails += upload(image,crcOf(image),&staged);
+  CHECK(staged,"not staged after abort");
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //The CRC is bitwise, to save memory - it's most of the work per byte of an upload
+  std::string image = randomImage(1<<20);
+  double t0 = testNow();
+  unsigned long crc = crcOf(image);
+  double ns = (testNow()-t0)*1e9/image.size();
+  printf("crc32Update: %.1f ns/byte (%08lX)\n",ns,crc);
+}
@@ -0,0 +1,118 @@
+//Tests for the output pin recorder (arduino-clock/pintrace.cpp) and what extras/pintrace/pintrace.py makes of it: a
+//known sequence is recorded - a few beeps a measure apart, with set onset jitter, then a few frames of the nixie
+//multiplex with set on and dead times - dumped both as the binary trace and as VCD, and each run through
+//pintrace.py stats, which must give the duty cycles, frame rate, dead time and jitter the sequence was built with.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "pintrace.h"
+#include <unistd.h>
+#include "harness.h"
+
+//The sequence
+#define MEASURE 500 //ms
+#define BEEP 50000 //µs
+static const long beepJitter[] = {0,+100,-50,0}; //µs off the measure, each beep - deviations +100, -150, +50
+#define FRAMES 5
+#define ON 2500 //µs each anode channel is on
+#define DEAD 500 //µs between one going off and the next on
+static const byte digits[6] = {1,2,3,4,5,15}; //tube 5 blank
+static const byte tubes[3][2] = {{2,5},{4,1},{0,3}}; //lit by anodes 1-3, via cathode drivers A and B (see cycleDisplay())
+static const byte anodes[3] = {ANODE_1,ANODE_2,ANODE_3};
+static const byte cathA[4] = {OUT_A1,OUT_A2,OUT_A3,OUT_A4}, cathB[4] = {OUT_B1,OUT_B2,OUT_B3,OUT_B4};
+
+static void at(unsigned long us){ stubMillis = us/1000; stubMicros = us%1000; }
+
+static void setCathodes(byte a, byte b){
+  for(byte i=0; i<4; i++){ pinWrite(cathA[i],bitRead(a,i)); pinWrite(cathB[i],bitRead(b,i)); }
+}
+
+static void record(){
+  pinTraceInit();
+  pinTraceMeasure(MEASURE); //as pattern.cpp does
+  unsigned long t = 1000000;
+  for(byte i=0; i<sizeof(beepJitter)/sizeof(beepJitter[0]); i++){
+    at(t+i*MEASURE*1000UL+beepJitter[i]); pinTrace(PIEZO_PIN,1); //as piezo.cpp does
+    at(t+i*MEASURE*1000UL+beepJitter[i]+BEEP); pinTrace(PIEZO_PIN,0);
+  }
+  t += 4*MEASURE*1000UL;
+  at(t);
+  for(byte i=0; i<3; i++) pinWrite(anodes[i],LOW);
+  setCathodes(15,15);
+  pinAnalogWrite(BACKLIGHT_PIN,128);
+  for(byte f=0; f<FRAMES; f++) for(byte c=0; c<3; c++){
+    t += DEAD; at(t);
+    setCathodes(digits[tubes[c][0]],digits[tubes[c][1]]); pinWrite(anodes[c],HIGH);
+    t += ON; at(t);
+    pinWrite(anodes[c],LOW);
+  }
+}
+
+static std::string stats(const std::string &path){
+  //What pintrace.py stats says about the trace at path
+  std::string script = __FILE__;
+  script = script.substr(0,script.rfind('/'))+"/../../pintrace/pintrace.py";
+  std::string out;
+  FILE *p = popen(("python3 "+script+" stats "+path+" 2>&1").c_str(),"r");
+  if(!p) return out;
+  char buf[256]; size_t n;
+  while((n = fread(buf,1,sizeof(buf),p))>0) out.append(buf,n);
+  pclose(p);
+  return out;
+}
+
+static bool save(const std::string &path, const std::string &data){
+  FILE *f = fopen(path.c_str(),"wb");
+  if(!f) return false;
+  bool ok = fwrite(data.data(),1,data.size(),f)==data.size();
+  return fclose(f)==0 && ok;
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  record();
+  StubPrint bin, vcd;
+  pinTraceDump(bin);
+  pinTraceVCD(vcd);
+  //Each pin only recorded when it changes - 8 beep edges, the 12 lines set up, then per channel, its anode on and
+  //off and whichever cathode lines differ from the last channel's
+  CHECK(bin.out.size()==pinTraceLength() && !bin.out.compare(0,2,"PT") && bin.out[2]==PINTRACE_VERSION,"header");
+  CHECK((byte)bin.out[4+11]==PIEZO_PIN && (byte)bin.out[4+12]==255,"roles: piezo %d, switch %d",(byte)bin.out[4+11],(byte)bin.out[4+12]);
+  word records = (bin.out.size()-PINTRACE_HEADER)/PINTRACE_RECORD;
+  CHECK(records>8+12+FRAMES*3*2 && records<PIN_TRACE,"%u records - wrapped, or changes missing",records);
+  CHECK(vcd.out.find("$comment measure 500 ms $end")==0 && vcd.out.find("$var wire 8 / backlight $end")!=std::string::npos,"VCD header: %.200s",vcd.out.c_str());
+
+  char dir[] = "/tmp/pintrace-test-XXXXXX";
+  if(!mkdtemp(dir)){ CHECK(false,"no temp dir"); return fails; }
+  std::string binPath = std::string(dir)+"/trace.bin", vcdPath = std::string(dir)+"/trace.vcd";
+  CHECK(save(binPath,bin.out) && save(vcdPath,vcd.out),"couldn't write the traces to %s",dir);
+  std::string fromBin = stats(binPath), fromVcd = stats(vcdPath);
+  unlink(binPath.c_str()); unlink(vcdPath.c_str()); rmdir(dir);
+  printf("%s",fromBin.c_str());
+  //Each channel is on ON of every 3*(ON+DEAD), lighting its two tubes but the blank one
+  const char *expect[] = {
+    "anode1 on 27.8%", "anode2 on 27.8%", "anode3 on 27.8%",
+    "tube duty: 0: 27.8%  1: 27.8%  2: 27.8%  3: 27.8%  4: 27.8%  5: 0.0%",
+    "frame rate 111.1Hz (4 frames)",
+    "dead time between channels: min 500us, median 500us, max 500us (14)",
+    "Beeps: 4, measure 500ms",
+    "length: min 50000us, median 50000us, max 50000us (4)",
+    "onset jitter, measure to measure: mean +0.0us, stdev 108.0us, worst -150us (3 pairs)",
+  };
+  for(const char *e : expect){
+    CHECK(fromBin.find(e)!=std::string::npos,"binary trace: no \"%s\"",e);
+    CHECK(fromVcd.find(e)!=std::string::npos,"VCD: no \"%s\"",e);
+  }
+  CHECK(fromBin.find("overlapped")==std::string::npos,"channels overlapped");
+  CHECK(fromBin==fromVcd,"stats differ between the binary trace and the VCD:\n%s",fromVcd.c_str());
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //What recording costs each pin change, the anodes toggling as in the multiplex
+  pinTraceInit();
+  unsigned long n = 10000000;
+  double t0 = testNow();
+  for(unsigned long i=0; i<n; i++) pinWrite(ANODE_1,i&1);
+  printf("pinWrite, recorded: %.1f ns/change\n",(testNow()-t0)*1e9/n);
+}
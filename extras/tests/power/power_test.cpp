@@ -0,0 +1,161 @@
+//Tests for low-power idle (arduino-clock/power.cpp, with getIdleNap() lifted out of arduino-clock.ino by run.py), as on
+//SAMD: a simulated night with the display off, from 22:00 to 07:00, with the loop driven around a stand-in clock - the
+//hourly timeline events, a stray interrupt every ten minutes, a couple of button presses, and an alarm that's snoozed
+//once and then stopped. The MCU "sleeps" in stub/samd.h's __WFI() until the next interrupt: the SysTick (at whatever
+//period power.cpp has set), a button edge, or a stray one. Reports the estimated duty cycle and wakeups per hour, and
+//checks them against what the night should come to, along with millis() staying exact and events handled on time.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "power.h"
+#include "timeline.h"
+#include "harness.h"
+
+//What getIdleNap() looks at, in the sketch - the display is off for the night
+byte displayDim = 0, fn = FN_TOD, fnSetPg = 0, signalMeasureStep = 0, timerState = 0, timersRunning = 0;
+byte backlightNow = 0, backlightTarget = 0;
+unsigned int tempValDispLast = 0;
+word snoozeRemain = 0;
+unsigned long timelineLast = 0, rtcSecAt = 0;
+static unsigned long stubReal = 0; //real time, ms since 22:00 - millis() only catches up on the SysTick
+static unsigned long signalUntil = 0;
+bool piezoPlaying(){ return stubReal<signalUntil; }
+bool networkSupported(){ return false; }
+bool networkBusy(){ return false; }
+
+#include "extracted.inc"
+
+//Interrupts, in time order: button edges (queued for checkInputs(), as inputSample() would), and stray ones that only
+//wake the MCU - serial, say
+enum { PRESS, RELEASE, STRAY };
+struct Interrupt { unsigned long at; byte kind; };
+static std::vector<Interrupt> interrupts;
+static size_t interruptNext = 0;
+static unsigned long napWakes[3]; //interrupts that came during a nap, by kind
+static std::vector<byte> inputQueue;
+bool inputPending(){ return !inputQueue.empty(); }
+bool inputPolled(){ return false; } //all by interrupt
+
+extern "C" void SysTick_DefaultHandler(void){ stubMillis++; } //the core's millis() tick
+extern "C" int sysTickHook(void); //power.cpp
+
+static void interrupt(){
+  Interrupt &i = interrupts[interruptNext++];
+  if(i.kind!=STRAY) inputQueue.push_back(i.kind);
+}
+static void sleepUntilInterrupt(){
+  //__WFI(): until the SysTick period ends, or another interrupt comes first
+  unsigned long cycles = SystemCoreClock/1000, tick = stubReal+(SysTick->VAL+1)/cycles;
+  if(interruptNext<interrupts.size() && interrupts[interruptNext].at<tick){
+    SysTick->VAL -= (interrupts[interruptNext].at-stubReal)*cycles;
+    stubReal = interrupts[interruptNext].at;
+    napWakes[interrupts[interruptNext].kind]++;
+    interrupt();
+    return;
+  }
+  stubReal = tick;
+  sysTickHook(); SysTick_DefaultHandler();
+  SysTick->VAL = 0; //next period
+}
+
+#define HMS(h,m,s,ms) ((((h)+2)%24*3600UL+(m)*60UL+(s))*1000+(ms)) //real time, at h:m:s.ms - from 22:00
+#define NIGHT_END HMS(7,0,0,0)
+#define ALARM_AT (6*3600UL+30*60) //06:30, seconds into the day
+#define SNOOZE 540 //seconds
+static unsigned long timelineBase; //22:00, per timelineSeconds()
+static unsigned long displayOnUntil = 0;
+static bool snoozed = false;
+static unsigned long events = 0, eventLateMax = 0, signals = 0, driftMax = 0;
+
+static void signalStart(){ signalUntil = stubReal+60000; signals++; }
+
+static void checkClock(){
+  //checkRTC(), as far as power goes: the second ticking, snooze, and timed events
+  unsigned long now = timelineBase+stubReal/1000;
+  if(now==timelineLast) return;
+  rtcSecAt = millis();
+  if(snoozeRemain && !--snoozeRemain) signalStart();
+  while(timelineNext()<=now){
+    unsigned long at = timelineNext();
+    byte type = timelinePop();
+    events++;
+    if(stubReal%1000>eventLateMax) eventLateMax = stubReal%1000; //how far into its second it was handled
+    if(type==TL_ALARM){ signalStart(); timelineAdd(type,timelineAfter(at,86400,ALARM_AT)); }
+    else timelineAdd(type,timelineAfter(at,3600,0)); //hourly, like the strike
+  }
+  timelineLast = now;
+}
+
+static void checkButtons(){
+  //checkInputs(), as far as power goes: a press snoozes or stops the alarm, or else shows the display for a while
+  for(byte kind : inputQueue){
+    if(kind!=PRESS) continue;
+    if(piezoPlaying()){ signalUntil = 0; if(!snoozed){ snoozeRemain = SNOOZE; snoozed = true; } }
+    else { displayDim = 2; displayOnUntil = stubReal+10000; }
+  }
+  inputQueue.clear();
+  if(displayOnUntil && stubReal>=displayOnUntil){ displayDim = 0; displayOnUntil = 0; }
+}
+
+static void loopCycle(){
+  //One loop(), as far as power goes
+  while(interruptNext<interrupts.size() && interrupts[interruptNext].at<=stubReal) interrupt(); //came while awake
+  checkClock();
+  checkButtons();
+  stubMillis++; stubReal++; //the rest of the loop - a generous 1ms, so the duty cycle is an upper estimate
+  cyclePower();
+  unsigned long drift = stubReal-stubMillis;
+  if(drift>driftMax) driftMax = drift;
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  stubWFI = sleepUntilInterrupt;
+  timelineBase = timelineSeconds(2024,1,1,22,0,0);
+  timelineLast = timelineBase-1;
+  timelineAdd(TL_STRIKE,timelineAfter(timelineLast,3600,0));
+  timelineAdd(TL_ALARM,timelineAfter(timelineLast,86400,ALARM_AT));
+  //The night's interrupts: a stray one at 5.321s past every tenth minute, and presses (each released 150ms later) -
+  //two at night, one to snooze the alarm, and one to stop it when it comes back
+  unsigned long strays = 0;
+  for(unsigned long t=HMS(22,5,5,321); t<NIGHT_END; t+=600000, strays++) interrupts.push_back({t,STRAY});
+  for(unsigned long t : {HMS(1,23,45,678), HMS(3,0,0,500), HMS(6,30,20,250), HMS(6,39,45,0)}){
+    interrupts.push_back({t,PRESS}); interrupts.push_back({t+150,RELEASE});
+  }
+  std::sort(interrupts.begin(),interrupts.end(),[](const Interrupt &a, const Interrupt &b){ return a.at<b.at; });
+  while(stubReal<NIGHT_END) loopCycle();
+
+  unsigned long secs = getPowerSleepSecs()+getPowerAwakeSecs();
+  printf("night: %lus napping, %lus awake between naps - duty %u/1000, %lu wakes (%lu by a button), %lu wakes/hour\n",
+    getPowerSleepSecs(),getPowerAwakeSecs(),getPowerDuty(),getPowerWakes(),getPowerInputWakes(),getPowerWakeRate());
+  //millis() is kept exact while the tick is slowed, and the naps end in time for what's due
+  CHECK(driftMax==0,"millis() fell %lums behind",driftMax);
+  CHECK(events==10,"%lu timed events, not 9 strikes and the alarm",events);
+  CHECK(eventLateMax<=2,"a timed event was handled %lums into its second",eventLateMax);
+  CHECK(signals==2 && snoozed && !snoozeRemain,"alarm: %lu signals",signals);
+  //The display was off all night but for two 10s presses and two minutes of alarm
+  CHECK(secs>=9*3600-200 && secs<=9*3600,"%lus with the display off",secs);
+  //Each nap is POWER_NAP, and the loop 1ms between them - 1/101 awake, give or take the naps cut short
+  CHECK(getPowerDuty()>=9 && getPowerDuty()<=11,"duty %u/1000",getPowerDuty());
+  //The MCU wakes for each interrupt that came during a nap, and only those: the stray ones (but any that came just as
+  //a nap ended), the two presses at night, and the releases after the alarm presses, as it naps again straight away
+  unsigned long buttonWakes = napWakes[PRESS]+napWakes[RELEASE];
+  CHECK(getPowerWakes()==napWakes[STRAY]+buttonWakes && getPowerInputWakes()==buttonWakes,"%lu wakes, %lu by a button - not %lu and %lu",getPowerWakes(),getPowerInputWakes(),napWakes[STRAY]+buttonWakes,buttonWakes);
+  CHECK(napWakes[STRAY]>=strays-2 && napWakes[PRESS]==2 && napWakes[RELEASE]==2,"woken by %lu of %lu stray interrupts, %lu presses, %lu releases",napWakes[STRAY],strays,napWakes[PRESS],napWakes[RELEASE]);
+  CHECK(getPowerWakeRate()>=6 && getPowerWakeRate()<=7,"%lu wakes/hour",getPowerWakeRate());
+  //While anything's going on, no nap at all
+  displayDim = 2;
+  unsigned long before = stubMillis;
+  cyclePower();
+  CHECK(stubMillis==before && !getPowerNap(),"napped with the display on");
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //What cyclePower() adds to every loop while the display is on: ns per call
+  displayDim = 2;
+  unsigned long n = 10000000;
+  double t0 = testNow();
+  for(unsigned long i=0; i<n; i++) cyclePower();
+  printf("cyclePower, display on: %.1f ns/call\n",(testNow()-t0)*1e9/n);
+}
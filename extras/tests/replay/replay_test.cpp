@@ -0,0 +1,180 @@
+//Replays control event traces (arduino-clock/trace.cpp) through ctrlEvt() on a computer, under virtual time: the whole
+//sketch is built against the stubs, with the fake RTC (rtcMillis.cpp), and its loop run a ms at a time. Each trace is
+//replayed on a fresh clock (in a child process) - default settings, the time of day function, the RTC at the first
+//event's recorded time - by passing its real (not replayed) events to ctrlEvt() at their recorded times, as input.cpp
+//would, with the RTC ticking each second as it did then. The replayed events are recorded in turn, and each must leave the
+//same fn, setting page, and display as it did originally. Latencies, event to display update, are reported for both.
+//The sessions scripted here are recorded through the real input code, with buttons pressed via stub pins, then
+//replayed. The corpus (none committed) is traces to replay as well - e.g. from GET /trace, to reproduce an input bug on
+//a clock with default settings. Nothing here touches a real clock, so a replay can't set its RTC or settings.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "rtcMillis.h"
+#include "input.h"
+#include "trace.h"
+#include <sys/wait.h>
+#include <unistd.h>
+#include "harness.h"
+
+void setup();
+void loop();
+
+//The piezo sequencer only runs on AVR and SAMD - these boards have no sound
+void piezoInit(){}
+bool piezoQueue(word hz, word dur, word gap, bool mark){ return true; }
+byte piezoRoom(){ return 255; }
+bool piezoPlaying(){ return false; }
+byte piezoMeasuresDone(){ return 0; }
+void piezoStop(){}
+extern "C" { char __end__; } //start of the heap, per the linker script - for heapPeak() in network.cpp
+
+#define REPLAY_DATE 2024,1,1,1 //a Monday - traces only have the time of day
+#define REPLAY_SETTLE 2000 //ms - loop after the last event, for its display update
+
+static void run(unsigned long ms){
+  //Runs the loop, a ms per cycle
+  for(unsigned long end=stubMillis+ms; stubMillis<end; stubMillis++) loop();
+}
+
+static void startClock(byte h, byte m, byte s){
+  //A fresh clock, as after startup with default settings
+  setup();
+  rtcSetDate(REPLAY_DATE); rtcSetTime(h,m,s);
+  run(100);
+}
+
+static std::string dump(){
+  StubPrint out;
+  traceDump(out);
+  return out.out;
+}
+
+static unsigned long get(const byte *p, byte len){
+  unsigned long val = 0;
+  for(byte i=len; i>0; i--) val = (val<<8)|p[i-1];
+  return val;
+}
+
+static std::string digits(const byte *p){
+  std::string s;
+  for(byte i=0; i<6; i++){ byte d = (i%2? p[i/2]&0x0F: p[i/2]>>4); s += (d>9? ' ': '0'+d); }
+  return s;
+}
+
+static std::string latencies(const std::vector<const byte*> &records){
+  std::vector<word> l;
+  for(const byte *p : records) if(get(p+13,2)!=TRACE_NO_LATENCY) l.push_back(get(p+13,2));
+  if(l.empty()) return "no display updates";
+  std::sort(l.begin(),l.end());
+  char buf[96];
+  snprintf(buf,sizeof(buf),"display update after %zu of %zu events: min %uus, median %uus, max %uus",l.size(),records.size(),l[0],l[l.size()/2],l.back());
+  return buf;
+}
+
+static int replayHere(const std::string &name, const std::string &trace){
+  //Replays the trace on this process's clock, and compares
+  int fails = 0;
+  const byte *buf = (const byte*)trace.data();
+  if(trace.size()<TRACE_HEADER || buf[0]!='C' || buf[1]!='T' || buf[2]!=TRACE_VERSION || buf[3]!=TRACE_RECORD || (trace.size()-TRACE_HEADER)%TRACE_RECORD){
+    CHECK(false,"%s: not a version %d trace",name.c_str(),TRACE_VERSION);
+    return fails;
+  }
+  std::vector<const byte*> orig;
+  for(size_t pos=TRACE_HEADER; pos<trace.size(); pos+=TRACE_RECORD) if(!(buf[pos+10]&TRACE_REPLAYED)) orig.push_back(buf+pos);
+  if(orig.empty()) return fails;
+  CHECK(orig.size()<=INPUT_TRACE,"%s: %zu events - more than a replay can record",name.c_str(),orig.size());
+  if(orig.size()>INPUT_TRACE) return fails;
+  //Started the second before the first event's, so the loop sees that one start
+  word tod = get(orig[0]+4,2);
+  unsigned long sec = (tod*60UL+orig[0][6]+86399)%86400;
+  startClock(sec/3600,sec/60%60,sec%60);
+  unsigned long start = stubMillis+1000, first = get(orig[0],4);
+  for(const byte *p : orig){
+    //The loop carries on until the event is due, with the RTC second started when it did on the clock (so the display
+    //ticks as it did) - or if that's not known, or was before the last event, set on the event if it's off
+    unsigned long at = start+(get(p,4)-first), secMs = get(p+19,2);
+    tod = get(p+4,2);
+    if(secMs<1000 && at-secMs>=stubMillis){ run(at-secMs-stubMillis); rtcSetTime(tod/60,tod%60,p[6]); }
+    run(at-stubMillis);
+    if(rtcGetTOD()!=tod || rtcGetSecond()!=p[6]) rtcSetTime(tod/60,tod%60,p[6]);
+    if(p[8]==1 && !p[9]) setInputLast(); //a fresh press - input.cpp notes when, for holds and timeouts
+    traceBegin();
+    ctrlEvt(p[7],p[8],p[9],p[15]);
+    traceEnd(p[7],p[8],p[9],p[15],TRACE_REPLAYED);
+  }
+  run(REPLAY_SETTLE);
+  std::string after = dump();
+  std::vector<const byte*> replayed;
+  for(size_t pos=after.size()-orig.size()*TRACE_RECORD; pos<after.size(); pos+=TRACE_RECORD) replayed.push_back((const byte*)after.data()+pos);
+  for(size_t i=0; i<orig.size(); i++){
+    const byte *a = orig[i], *b = replayed[i];
+    CHECK(a[11]==b[11] && a[12]==b[12] && !memcmp(a+16,b+16,3),"%s: event %zu (ctrl %d evt %d at %.3fs): fn %d setpg %d [%s] originally, fn %d setpg %d [%s] on replay",
+      name.c_str(),i,a[7],a[8],(get(a,4)-first)/1000.0,a[11],a[12],digits(a+16).c_str(),b[11],b[12],digits(b+16).c_str());
+  }
+  printf("%s: %zu events\n  original: %s\n  replay:   %s\n",name.c_str(),orig.size(),latencies(orig).c_str(),latencies(replayed).c_str());
+  return fails;
+}
+
+template<typename F> static int inChild(F f, std::string *out=NULL){
+  //Runs f on a fresh clock, in a child process, so nothing carries over - returns its fails, and what it writes to the
+  //pipe it's given
+  int fd[2];
+  if(pipe(fd)) return 1;
+  fflush(stdout);
+  pid_t pid = fork();
+  if(!pid){ close(fd[0]); int fails = f(fd[1]); close(fd[1]); fflush(stdout); _exit(fails>255? 255: fails); }
+  close(fd[1]);
+  char buf[4096]; ssize_t n;
+  while((n = read(fd[0],buf,sizeof(buf)))>0) if(out) out->append(buf,n);
+  close(fd[0]);
+  int status;
+  waitpid(pid,&status,0);
+  return (WIFEXITED(status)? WEXITSTATUS(status): 1);
+}
+
+//Scripted sessions: each a button, how long it's held, and how long until the next press (ms)
+struct Press { byte ctrl; word hold, gap; };
+struct Session { const char *name; std::vector<Press> presses; };
+static const Session sessions[] = {
+  {"functions", {{CTRL_UP,80,600}, {CTRL_UP,80,600}, {CTRL_UP,80,600}, {CTRL_DN,80,600}, {CTRL_SEL,80,600},
+    {CTRL_SEL,80,600}, {CTRL_DN,80,5000}}},
+  {"set-time", {{CTRL_SEL,1500,500}, {CTRL_UP,80,200}, {CTRL_UP,80,200}, {CTRL_UP,2500,400}, {CTRL_DN,80,400},
+    {CTRL_SEL,80,400}, {CTRL_DN,80,400}, {CTRL_SEL,80,3000}}},
+  {"settings", {{CTRL_SEL,3500,500}, {CTRL_UP,80,400}, {CTRL_UP,80,400}, {CTRL_SEL,80,400}, {CTRL_UP,80,400},
+    {CTRL_SEL,80,400}, {CTRL_DN,80,400}, {CTRL_SEL,1500,3000}}},
+  {"alt", {{CTRL_ALT,80,600}, {CTRL_ALT,80,600}, {CTRL_UP,80,400}, {CTRL_ALT,1500,3000}}},
+};
+
+static int record(const Session &s, int fd){
+  //Presses the buttons through input.cpp, as on the clock, and writes out the trace
+  startClock(10,0,0);
+  for(const Press &p : s.presses){
+    stubPinLow[p.ctrl] = true; run(p.hold);
+    stubPinLow[p.ctrl] = false; run(p.gap);
+  }
+  std::string trace = dump();
+  return write(fd,trace.data(),trace.size())!=(ssize_t)trace.size();
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  for(const Session &s : sessions){
+    std::string trace;
+    fails += inChild([&](int fd){ return record(s,fd); },&trace);
+    word n = (trace.size()-TRACE_HEADER)/TRACE_RECORD;
+    CHECK(trace.size()>TRACE_HEADER && n>=s.presses.size()*2,"%s: %u events recorded for %zu presses",s.name,n,s.presses.size());
+    fails += inChild([&](int){ return replayHere(s.name,trace); });
+  }
+  for(auto &c : corpus) fails += inChild([&](int){ return replayHere(c.first,c.second); });
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //A loop cycle of the whole sketch, at the time of day - so the cost of replaying a trace is about this per ms of it
+  startClock(10,0,0);
+  unsigned long n = 200000;
+  double t0 = testNow();
+  run(n);
+  printf("loop: %.2f us/cycle\n",(testNow()-t0)*1e6/n);
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+# Builds and runs the host tests for the parts of the sketch that don't need the hardware - see README.md.
+# Usage: python3 run.py [test ...]              (checks, with AddressSanitizer/UBSan - default all tests)
+#        python3 run.py --bench [test ...]      (optimized build, timings only)
+#        python3 run.py --fuzz N [test ...]     (N mutated inputs per fuzzable test, with the sanitizers)
+#        python3 run.py --libfuzzer [test ...]  (clang libFuzzer build, run until stopped - for fuzzable tests)
+# Requires g++ (or clang++ for --libfuzzer).
+
+import os, re, shutil, subprocess, sys, tempfile
+
+here = os.path.dirname(os.path.abspath(__file__))
+sketch = os.path.abspath(os.path.join(here, '..', '..', 'arduino-clock'))
+
+# Per test: sketch sources to compile alongside it (arduino-clock.ino for the whole sketch, compiled as C++), functions
+# to lift out of arduino-clock.ino instead (into extracted.inc, for tests that stand in for the rest), and extra defines
+TESTS = {
+    'admin': dict(sources=['network.cpp', 'http.cpp', 'storage.cpp', 'pattern.cpp', 'rtcMillis.cpp'],
+                  defines=['RTC_MILLIS', 'ANTI_DRIFT=0'], fuzz=True,
+                  extract=['alarmLoc', 'getOpt', 'getOptCount', 'findOpt', 'getAlarmOpt', 'isDST', 'isDSTByHour',
+                           'nthSunday', 'daysInMonth', 'daysInYear', 'dateToDayCount', 'dayOfWeek', 'dateComp']),
+    'calendar': dict(sources=['rtcMillis.cpp'], defines=['RTC_MILLIS', 'ANTI_DRIFT=0'], fuzz=True,
+                     extract=['isDST', 'isDSTByHour', 'nthSunday', 'daysInMonth', 'daysInYear', 'dateToDayCount',
+                              'dayOfWeek', 'dateComp', 'isTimeInRange', 'isDayInRange']),
+    'http': dict(sources=['http.cpp'], fuzz=True),
+    'ota': dict(sources=['ota.cpp'], defines=['ARDUINO_ARCH_SAMD', 'OTA_KEY="test key"']),
+    'pintrace': dict(sources=['pintrace.cpp'], defines=['PIN_TRACE=250']),
+    'power': dict(sources=['power.cpp', 'timeline.cpp'], defines=['ARDUINO_ARCH_SAMD'], extract=['daysInMonth', 'daysInYear', 'dateToDayCount', 'getIdleNap']),
+    'replay': dict(sources=['arduino-clock.ino', 'dispNixie.cpp', 'dispMAX7219.cpp', 'expiry.cpp', 'http.cpp',
+                            'input.cpp', 'network.cpp', 'ota.cpp', 'pattern.cpp', 'pintrace.cpp', 'power.cpp',
+                            'rtcMillis.cpp', 'storage.cpp', 'timeline.cpp', 'trace.cpp', 'weather.cpp'],
+                   defines=['RTC_MILLIS', 'ANTI_DRIFT=0', 'INPUT_TRACE=100', 'POWER_NAP=0']),
+    'trace': dict(sources=['trace.cpp'], defines=['INPUT_TRACE=40']),
+    'weather': dict(sources=['http.cpp'], fuzz=True, extract=['daysInMonth']),
+}
+
+def extract(names):
+    # The named functions from arduino-clock.ino, in the order given - one-liners, or through the next closing brace
+    # at the start of a line
+    with open(os.path.join(sketch, 'arduino-clock.ino')) as f:
+        ino = f.read()
+    out = []
+    for name in names:
+        m = re.search(r'^[\w ]+\b%s\([^)]*\)\s*\{(?:[^\n]*\}[ \t]*(?://[^\n]*)?$|.*?^\})' % name, ino, re.M | re.S)
+        if not m:
+            sys.exit('%s not found in arduino-clock.ino' % name)
+        out.append(m.group(0))
+    return '\n'.join(out) + '\n'
+
+def build(name, build_dir, mode):
+    test = TESTS[name]
+    inc = os.path.join(build_dir, name)
+    os.makedirs(inc, exist_ok=True)
+    if test.get('extract'):
+        with open(os.path.join(inc, 'extracted.inc'), 'w') as f:
+            f.write(extract(test['extract']))
+    exe = os.path.join(inc, name + '_test')
+    srcs = [os.path.join(here, name, name + '_test.cpp')]
+    for s in test.get('sources', []):
+        srcs += ['-x', 'c++', os.path.join(sketch, s), '-x', 'none'] if s.endswith('.ino') else [os.path.join(sketch, s)]
+    cxx = 'clang++' if mode == 'libfuzzer' else 'g++'
+    flags = ['-std=gnu++17', '-g', '-Wall', '-Wno-unused-function', '-Wno-sign-compare', '-Wno-comment',
+             '-Wno-unused-variable', '-I' + os.path.join(here, 'stub'), '-I' + inc, '-I' + sketch]
+    flags += ['-D' + d for d in test.get('defines', [])]
+    if mode == 'bench':
+        flags += ['-O2']
+    elif mode == 'libfuzzer':
+        flags += ['-O1', '-fsanitize=fuzzer,address,undefined', '-DLIBFUZZER']
+    else:
+        flags += ['-O1', '-fsanitize=address,undefined', '-fno-sanitize-recover=undefined']
+    cmd = [cxx] + flags + srcs + ['-o', exe]
+    if subprocess.run(cmd).returncode:
+        sys.exit('%s: build failed' % name)
+    return exe
+
+def main(args):
+    mode, iterations = 'run', None
+    if args and args[0] in ('--bench', '--libfuzzer'):
+        mode = args.pop(0)[2:]
+    elif args and args[0] == '--fuzz':
+        mode = 'fuzz'
+        args.pop(0)
+        iterations = args.pop(0)
+    names = args or sorted(TESTS)
+    for name in names:
+        if name not in TESTS:
+            sys.exit('No test %s - there are: %s' % (name, ' '.join(sorted(TESTS))))
+    if mode in ('fuzz', 'libfuzzer'):
+        names = [n for n in names if TESTS[n].get('fuzz')]
+    build_dir = tempfile.mkdtemp(prefix='clock-tests-')
+    failed = []
+    try:
+        for name in names:
+            print('== %s' % name, flush=True)
+            exe = build(name, build_dir, mode)
+            corpus = os.path.join(here, name, 'corpus')
+            if mode == 'libfuzzer':
+                work = os.path.join(build_dir, name, 'corpus')
+                shutil.copytree(corpus, work)  # libFuzzer adds what it finds - keep the committed corpus short
+                cmd = [exe, work]
+            else:
+                cmd = [exe, corpus, mode] + ([iterations] if iterations else [])
+            if subprocess.run(cmd, cwd=os.path.join(here, name)).returncode:
+                failed.append(name)
+    finally:
+        shutil.rmtree(build_dir)
+    if failed:
+        sys.exit('Failed: ' + ' '.join(failed))
+
+main(sys.argv[1:])
@@ -0,0 +1,14 @@
+#ifndef DUSK2DAWN_STUB_H
+#define DUSK2DAWN_STUB_H
+
+//Stands in for the Dusk2Dawn library, for the tests in extras/tests - the sun rises at 6:00 and sets at 18:00, an
+//hour later in DST, as minutes past midnight
+
+class Dusk2Dawn {
+  public:
+    Dusk2Dawn(float latitude, float longitude, float timezone){}
+    int sunrise(int y, int m, int d, bool dst){ return 360+(dst? 60: 0); }
+    int sunset(int y, int m, int d, bool dst){ return 1080+(dst? 60: 0); }
+};
+
+#endif //DUSK2DAWN_STUB_H
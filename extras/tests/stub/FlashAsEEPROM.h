@@ -0,0 +1,22 @@
+#ifndef FLASH_AS_EEPROM_STUB_H
+#define FLASH_AS_EEPROM_STUB_H
+
+//Stands in for the FlashStorage library's EEPROM mode, with a RAM array, for the tests in extras/tests
+
+#define STUB_EEPROM_SIZE 1024
+
+class EEPROMClass {
+  public:
+    byte data[STUB_EEPROM_SIZE];
+    bool valid = false;
+    unsigned long commits = 0;
+    byte read(int i){ return data[i]; }
+    void update(int i, byte v){ data[i] = v; }
+    void write(int i, byte v){ data[i] = v; }
+    bool isValid(){ return valid; }
+    void commit(){ valid = true; commits++; }
+    int length(){ return STUB_EEPROM_SIZE; }
+};
+inline EEPROMClass EEPROM;
+
+#endif //FLASH_AS_EEPROM_STUB_H
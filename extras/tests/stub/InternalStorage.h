@@ -0,0 +1,24 @@
+#ifndef INTERNAL_STORAGE_STUB_H
+#define INTERNAL_STORAGE_STUB_H
+
+//Stands in for the ArduinoOTA library's InternalStorage, with a RAM array as the staging area, for the tests in
+//extras/tests. With ARDUINO_ARCH_SAMD, ota.cpp writes the staging area itself, via NVMCTRL - see samd.h.
+
+#define STUB_STAGE_SIZE 65536
+alignas(256) inline byte stubStage[STUB_STAGE_SIZE];
+#define OTA_STAGE_ADDR ((unsigned long)stubStage) //for ota.cpp
+
+class InternalStorageClass {
+  public:
+    long pos = -1; //write position, or -1 if not open
+    bool applied = false;
+    long maxSize(){ return STUB_STAGE_SIZE; }
+    int open(int length){ memset(stubStage,0xFF,sizeof(stubStage)); pos = 0; return 1; }
+    size_t write(uint8_t b){ if(pos<0 || pos>=STUB_STAGE_SIZE) return 0; stubStage[pos++] = b; return 1; }
+    void close(){ pos = -1; }
+    void clear(){ memset(stubStage,0xFF,sizeof(stubStage)); }
+    void apply(){ applied = true; }
+};
+inline InternalStorageClass InternalStorage;
+
+#endif //INTERNAL_STORAGE_STUB_H
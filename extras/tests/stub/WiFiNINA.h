@@ -0,0 +1,98 @@
+#ifndef WIFININA_STUB_H
+#define WIFININA_STUB_H
+
+//Stands in for the WiFiNINA library, for the tests in extras/tests: the module is always up, and the server's clients
+//are StubConns a test queues up - it reads what they send from in, and they collect what the clock writes in out. A
+//client the clock connects out with gets stubRemote, likewise.
+
+#define WL_NO_MODULE 255
+#define WL_IDLE_STATUS 0
+#define WL_NO_SSID_AVAIL 1
+#define WL_SCAN_COMPLETED 2
+#define WL_CONNECTED 3
+#define WL_CONNECT_FAILED 4
+#define WL_CONNECTION_LOST 5
+#define WL_DISCONNECTED 6
+#define WL_AP_LISTENING 7
+#define WL_AP_CONNECTED 8
+#define WL_AP_FAILED 9
+#define WIFI_FIRMWARE_LATEST_VERSION "1.0.0"
+
+class IPAddress {
+  public:
+    byte b[4];
+    IPAddress(byte b0=0, byte b1=0, byte b2=0, byte b3=0){ b[0] = b0; b[1] = b1; b[2] = b2; b[3] = b3; }
+    byte operator[](int i) const { return b[i]; }
+    byte& operator[](int i){ return b[i]; }
+};
+
+class WiFiClass {
+  public:
+    byte state = WL_IDLE_STATUS;
+    void setTimeout(unsigned long){}
+    int begin(const char*){ return state = WL_CONNECTED; }
+    int begin(const char*, const char*){ return state = WL_CONNECTED; }
+    int begin(const char*, byte, const char*){ return state = WL_CONNECTED; }
+    int beginAP(const char*){ return state = WL_AP_LISTENING; }
+    void config(IPAddress){}
+    void end(){ state = WL_IDLE_STATUS; }
+    void disconnect(){ state = WL_DISCONNECTED; }
+    byte status(){ return state; }
+    IPAddress localIP(){ return IPAddress(192,168,1,2); }
+    long RSSI(){ return -60; }
+    const char* SSID(){ return "stub"; }
+    const char* firmwareVersion(){ return WIFI_FIRMWARE_LATEST_VERSION; }
+};
+inline WiFiClass WiFi;
+
+struct StubConn {
+  std::string in; //what the client sends
+  size_t pos = 0;
+  std::string out; //what the clock has sent it
+  bool open = true; //until the client hangs up - or the clock does (closed)
+  bool closed = false;
+  size_t writeMax = 4096; //most the clock can write at once
+};
+
+inline StubConn *stubRemote = NULL; //the server a client connects out to - NULL if none answers
+
+class WiFiClient : public Print {
+  public:
+    StubConn *c = NULL;
+    WiFiClient(StubConn *conn=NULL): c(conn){}
+    int connect(const char*, uint16_t){ c = stubRemote; return c!=NULL; }
+    int read(byte *buf, size_t size){
+      if(!c || c->pos>=c->in.size()) return -1;
+      size_t n = min(size,c->in.size()-c->pos);
+      memcpy(buf,c->in.data()+c->pos,n); c->pos += n;
+      return n;
+    }
+    int available(){ return (c? c->in.size()-c->pos: 0); }
+    size_t write(uint8_t b){ return write(&b,1); }
+    size_t write(const uint8_t *buf, size_t n){
+      if(!c || c->closed || !c->open) return 0;
+      n = min(n,c->writeMax);
+      c->out.append((const char*)buf,n);
+      return n;
+    }
+    using Print::write;
+    bool connected(){ return c && c->open && !c->closed; }
+    void stop(){ if(c) c->closed = true; }
+    operator bool(){ return c!=NULL; }
+    bool operator==(const WiFiClient &o) const { return c==o.c; }
+};
+
+inline std::vector<StubConn*> stubConns; //clients, for the server to hand over
+
+class WiFiServer {
+  public:
+    WiFiServer(int port){}
+    void begin(){}
+    WiFiClient available(){
+      //Like WiFiNINA, any client with something to read
+      for(StubConn *c : stubConns) if(!c->closed && c->pos<c->in.size()) return WiFiClient(c);
+      return WiFiClient();
+    }
+};
+
+#endif //WIFININA_STUB_H
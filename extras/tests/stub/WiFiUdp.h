@@ -0,0 +1,18 @@
+#ifndef WIFIUDP_STUB_H
+#define WIFIUDP_STUB_H
+
+//Stands in for WiFiNINA's WiFiUdp, for the tests in extras/tests - no NTP server ever answers
+
+class WiFiUDP {
+  public:
+    byte begin(unsigned int){ return 1; }
+    void stop(){}
+    int beginPacket(IPAddress, unsigned int){ return 1; }
+    int endPacket(){ return 1; }
+    size_t write(const byte*, size_t n){ return n; }
+    int parsePacket(){ return 0; }
+    int read(byte*, size_t){ return -1; }
+    void flush(){}
+};
+
+#endif //WIFIUDP_STUB_H
@@ -0,0 +1,132 @@
+#ifndef ARDUINO_STUB_H
+#define ARDUINO_STUB_H
+
+//Just enough of the Arduino core to compile parts of the sketch on a computer, for the tests in extras/tests.
+//Time only moves when a test moves it (stubMillis), so runs are repeatable. See run.py.
+
+//Standard headers first - the min/max macros below would break them
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <dirent.h>
+#include <string>
+#include <vector>
+
+typedef uint8_t byte;
+typedef uint16_t word;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define NOT_AN_INTERRUPT -1
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) ((const __FlashStringHelper*)(s))
+class __FlashStringHelper;
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(x,a,b) ((x)<(a)?(a):((x)>(b)?(b):(x)))
+#define bitRead(v,b) (((v)>>(b))&1)
+#define bitWrite(v,b,x) ((x)?((v)|=(1UL<<(b))):((v)&=~(1UL<<(b))))
+#define highByte(w) ((uint8_t)((w)>>8))
+#define lowByte(w) ((uint8_t)((w)&0xFF))
+#define interrupts()
+#define noInterrupts()
+
+inline unsigned long stubMillis = 0; //the clock, as far as the sketch can tell
+inline unsigned long millis(){ return stubMillis; }
+inline unsigned long stubMicros = 0; //µs past stubMillis, for tests that need finer time
+inline unsigned long micros(){ return stubMillis*1000+stubMicros; }
+inline void delay(unsigned long ms){ stubMillis += ms; }
+inline void pinMode(uint8_t, uint8_t){}
+inline void digitalWrite(uint8_t, uint8_t){}
+inline bool stubPinLow[64]; //inputs a test is holding low - e.g. a button pressed
+inline int digitalRead(uint8_t pin){ return (stubPinLow[pin]? LOW: HIGH); }
+inline int analogRead(uint8_t pin){ return (stubPinLow[pin]? 0: 1023); }
+inline void analogWrite(uint8_t, int){}
+inline int digitalPinToInterrupt(uint8_t){ return NOT_AN_INTERRUPT; } //buttons are polled
+inline void attachInterrupt(int, void (*)(), int){}
+
+class Print {
+  public:
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *b, size_t n){ size_t i = 0; while(i<n && write(b[i])) i++; return i; }
+    size_t write(const char *s){ return write((const uint8_t*)s,strlen(s)); }
+    size_t print(const char *s){ return write(s); }
+    size_t print(const __FlashStringHelper *s){ return write((const char*)s); }
+    size_t print(char c){ return write((uint8_t)c); }
+    size_t print(unsigned char n, int base=DEC){ return print((unsigned long)n,base); }
+    size_t print(int n, int base=DEC){ return print((long)n,base); }
+    size_t print(unsigned int n, int base=DEC){ return print((unsigned long)n,base); }
+    size_t print(long n, int base=DEC){
+      if(base==DEC && n<0) return print('-')+print((unsigned long)(-n),DEC);
+      return print((unsigned long)n,base);
+    }
+    size_t print(unsigned long n, int base=DEC){
+      char buf[8*sizeof(long)+1]; char *p = buf+sizeof(buf)-1; *p = '\0';
+      do { byte d = n%base; *--p = (d<10? '0'+d: 'A'+d-10); n /= base; } while(n);
+      return write(p);
+    }
+    size_t print(double n, int digits=2){ char buf[32]; snprintf(buf,sizeof(buf),"%.*f",digits,n); return write(buf); }
+    size_t println(){ return write("\r\n"); }
+    template<typename T> size_t println(T v){ return print(v)+println(); }
+    template<typename T> size_t println(T v, int f){ return print(v,f)+println(); }
+};
+
+//Collects whatever is printed to it, for a test to look at
+class StubPrint : public Print {
+  public:
+    std::string out;
+    size_t write(uint8_t c){ out += (char)c; return 1; }
+    using Print::write;
+};
+
+class Stream : public Print {
+  public:
+    virtual int available(){ return 0; }
+    virtual int read(){ return -1; }
+    virtual int peek(){ return -1; }
+};
+class StubSerial : public Stream {
+  public:
+    void begin(unsigned long){}
+    size_t write(uint8_t c){ return fputc(c,stdout)==EOF? 0: 1; }
+    using Print::write;
+    operator bool(){ return true; }
+};
+inline StubSerial Serial;
+
+#ifdef ARDUINO_ARCH_SAMD
+#include "samd.h"
+#endif
+
+#endif //ARDUINO_STUB_H
@@ -0,0 +1,97 @@
+#ifndef HARNESS_H
+#define HARNESS_H
+
+//Common main() for the tests in extras/tests - see run.py. Each test defines:
+//  int testRun(const Corpus &corpus) - checks everything, returns how many failed
+//  void testBench(const Corpus &corpus) - times the code under test (run with an optimized build)
+//and, if it #defines TEST_FUZZ before including this, the usual libFuzzer entry point:
+//  extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+//which is also driven by a simple mutator here, for machines without libFuzzer.
+//Usage: <test> [corpus dir] [run | bench | fuzz <iterations>]
+
+//(standard headers it needs are included by arduino.h, ahead of the min/max macros)
+
+typedef std::vector<std::pair<std::string,std::string>> Corpus; //file name, contents
+
+#define CHECK(cond, ...) do { if(!(cond)){ printf("FAIL %s:%d: ",__FILE__,__LINE__); printf(__VA_ARGS__); printf("\n"); fflush(stdout); fails++; } } while(0)
+
+inline unsigned long testRand(){ //xorshift, so runs are repeatable
+  static unsigned long long s = 88172645463325252ULL;
+  s ^= s<<13; s ^= s>>7; s ^= s<<17;
+  return (unsigned long)s;
+}
+
+inline double testNow(){ //seconds
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline Corpus testLoadCorpus(const char *dir){
+  Corpus corpus;
+  DIR *d = opendir(dir);
+  if(!d) return corpus;
+  while(struct dirent *e = readdir(d)){
+    if(e->d_name[0]=='.') continue;
+    std::string path = std::string(dir)+"/"+e->d_name, data;
+    FILE *f = fopen(path.c_str(),"rb");
+    if(!f) continue;
+    char buf[4096]; size_t n;
+    while((n = fread(buf,1,sizeof(buf),f))>0) data.append(buf,n);
+    fclose(f);
+    corpus.push_back(std::make_pair(std::string(e->d_name),data));
+  }
+  closedir(d);
+  std::sort(corpus.begin(),corpus.end());
+  return corpus;
+}
+
+int testRun(const Corpus &corpus);
+void testBench(const Corpus &corpus);
+
+#ifdef TEST_FUZZ
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+inline void testMutate(std::string &s){
+  //A few random edits, biased towards the bytes that matter to the parsers
+  static const char interesting[] = "{}[]\":,\\%u0\r\n =&+-.";
+  byte edits = testRand()%8;
+  for(byte i=0; i<edits; i++){
+    size_t p = (s.empty()? 0: testRand()%s.size());
+    switch(testRand()%6){
+      case 0: if(!s.empty()) s[p] = (char)testRand(); break;
+      case 1: s.insert(p,1,interesting[testRand()%(sizeof(interesting)-1)]); break;
+      case 2: if(!s.empty()) s.erase(p,1); break;
+      case 3: s.insert(p,std::string(testRand()%2000,interesting[testRand()%(sizeof(interesting)-1)])); break; //long runs
+      case 4: s.resize(testRand()%(s.size()+1)); break; //cut short
+      case 5: if(!s.empty()){ size_t q = testRand()%s.size(); s.insert(p,s.substr(q,testRand()%64)); } break; //repeat a piece
+    }
+  }
+}
+
+inline int testFuzz(const Corpus &corpus, unsigned long iterations){
+  if(corpus.empty()){ printf("fuzz: no corpus\n"); return 1; }
+  double t0 = testNow();
+  for(unsigned long i=0; i<iterations; i++){
+    std::string s = corpus[testRand()%corpus.size()].second;
+    testMutate(s);
+    LLVMFuzzerTestOneInput((const uint8_t*)s.data(),s.size());
+  }
+  printf("fuzz: %lu inputs, %.0f/s\n",iterations,iterations/(testNow()-t0));
+  return 0;
+}
+#endif //TEST_FUZZ
+
+#ifndef LIBFUZZER //libFuzzer has its own main()
+int main(int argc, char **argv){
+  Corpus corpus = testLoadCorpus(argc>1? argv[1]: "corpus");
+  const char *mode = (argc>2? argv[2]: "run");
+  if(!strcmp(mode,"bench")){ testBench(corpus); return 0; }
+  #ifdef TEST_FUZZ
+  if(!strcmp(mode,"fuzz")) return testFuzz(corpus,argc>3? strtoul(argv[3],NULL,10): 1000000);
+  #endif
+  int fails = testRun(corpus);
+  printf(fails? "%d FAILED\n": "ok\n",fails);
+  return fails? 1: 0;
+}
+#endif //LIBFUZZER
+
+#endif //HARNESS_H
@@ -0,0 +1,55 @@
+#ifndef SAMD_STUB_H
+#define SAMD_STUB_H
+
+//The SAMD21, as far as the sketch uses it, for the tests in extras/tests. Included by arduino.h if ARDUINO_ARCH_SAMD.
+
+//The flash controller, for ota.cpp: row erase commands fill the 256-byte row at ADDR (in 16-bit words) with 0xFF, and
+//are counted.
+
+#define NVMCTRL_CTRLA_CMDEX_KEY 0xA500
+#define NVMCTRL_CTRLA_CMD_ER 0x02
+
+struct StubNVMCommand {
+  unsigned long *addr;
+  unsigned long erases = 0;
+  void operator=(uint32_t cmd){
+    if(cmd==(NVMCTRL_CTRLA_CMDEX_KEY|NVMCTRL_CTRLA_CMD_ER)){ memset((void*)((*addr*2)&~255UL),0xFF,256); erases++; }
+  }
+};
+struct StubNVM {
+  struct { unsigned long reg; } ADDR;
+  struct { StubNVMCommand reg; } CTRLA;
+  struct { struct { bool MANW; } bit; } CTRLB;
+  struct { struct { bool READY; } bit; } INTFLAG;
+  StubNVM(){ CTRLA.reg.addr = &ADDR.reg; CTRLB.bit.MANW = true; INTFLAG.bit.READY = true; }
+};
+inline StubNVM stubNVM;
+#define NVMCTRL (&stubNVM)
+
+//SysTick and sleep, for power.cpp: __WFI() calls stubWFI, for a test to move time on to the next interrupt - it keeps
+//SysTick->VAL counting down, and calls the tick handlers, as the hardware would. Writing VAL reloads it from LOAD.
+inline uint32_t SystemCoreClock = 48000000;
+#define SCB_ICSR_PENDSTSET_Msk (1UL<<26)
+#define SCB_ICSR_PENDSTCLR_Msk (1UL<<25)
+#define SCB_SCR_SLEEPDEEP_Msk (1UL<<2)
+struct StubSCB { uint32_t ICSR = 0, SCR = 0; };
+inline StubSCB stubSCB;
+#define SCB (&stubSCB)
+struct StubSysTickVal {
+  uint32_t v, *load;
+  void operator=(uint32_t){ v = *load; }
+  void operator-=(uint32_t n){ v -= n; }
+  operator uint32_t() const { return v; }
+};
+struct StubSysTick {
+  uint32_t LOAD = 48000-1; //1ms, as the core sets it
+  StubSysTickVal VAL;
+  StubSysTick(){ VAL.load = &LOAD; VAL.v = LOAD; }
+};
+inline StubSysTick stubSysTick;
+#define SysTick (&stubSysTick)
+#define __DSB()
+inline void (*stubWFI)() = NULL;
+inline void __WFI(){ if(stubWFI) stubWFI(); }
+
+#endif //SAMD_STUB_H
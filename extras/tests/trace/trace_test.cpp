@@ -0,0 +1,84 @@
+//Tests for the control event recorder (arduino-clock/trace.cpp), against a stand-in for the clock whose display shows
+//the RTC time of day. Replaying traces through the whole sketch is tested in extras/tests/replay.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#include "trace.h"
+#include "harness.h"
+
+//The clock, as far as trace.cpp can tell
+static unsigned long rtcSecs = 10*3600UL; //time of day, at stubMillis==rtcMillisAt
+static unsigned long rtcMillisAt = 0;
+static byte fn = FN_TOD, fnSetPg = 0, display[6];
+
+static unsigned long rtcNow(){ return (rtcSecs+(stubMillis-rtcMillisAt)/1000)%86400; }
+int rtcGetTOD(){ return rtcNow()/60; }
+byte rtcGetSecond(){ return rtcNow()%60; }
+unsigned long getRtcSecAt(){ return rtcMillisAt+(stubMillis-rtcMillisAt)/1000*1000; } //as the loop would see it
+byte getDisplayDigit(byte pos){ return display[pos]; }
+byte getFn(){ return fn; }
+byte getFnSetPg(){ return fnSetPg; }
+void updateDisplay(){
+  //Shows the time, or in FN_CAL, the seconds only
+  unsigned long t = rtcNow();
+  byte v[6] = {(byte)(t/36000), (byte)(t/3600%10), (byte)(t/600%6), (byte)(t/60%10), (byte)(t%60/10), (byte)(t%10)};
+  for(byte i=0; i<6; i++) display[i] = (fn==FN_CAL && i<4? 15: v[i]);
+  traceDisplayed();
+}
+void ctrlEvt(byte ctrl, byte evt, byte evtLast, byte velocity){
+  if(evt==1) fn = (fn==FN_TOD? FN_CAL: FN_TOD); //press toggles
+  if(evt!=0 || ctrl!=CTRL_SEL) updateDisplay(); //releases of Sel don't update it, to check latency is left for later
+}
+
+static void event(byte ctrl, byte evt){
+  traceBegin();
+  ctrlEvt(ctrl,evt,0,0);
+  traceEnd(ctrl,evt,0,0,0);
+}
+
+static std::string dump(){
+  StubPrint out;
+  traceDump(out);
+  return out.out;
+}
+
+static const byte *record(const std::string &d, word i){ return (const byte*)d.data()+TRACE_HEADER+i*TRACE_RECORD; }
+static word recordCount(const std::string &d){ return (d.size()-TRACE_HEADER)/TRACE_RECORD; }
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  //Record a few presses and releases, seconds apart, and one event that doesn't update the display
+  for(byte i=0; i<6; i++){
+    stubMillis += 1700;
+    event(CTRL_SEL,1);
+    stubMillis += 120;
+    event(CTRL_SEL,0); //no display update...
+    stubMillis += 30;
+    updateDisplay(); //...until the next cycle
+  }
+  std::string orig = dump();
+  CHECK(orig.size()==traceLength() && recordCount(orig)==12,"%zu bytes for %u records",orig.size(),recordCount(orig));
+  CHECK(!memcmp(orig.data(),"CT",2) && orig[2]==TRACE_VERSION && orig[3]==TRACE_RECORD,"header");
+  const byte *p = record(orig,11);
+  CHECK(p[7]==CTRL_SEL && p[8]==0 && p[11]==getFn(),"last record: ctrl %d evt %d fn %d",p[7],p[8],p[11]);
+  CHECK((p[16]>>4)==display[0] && (p[18]&0x0F)==display[5],"display recorded as %02X%02X%02X",p[16],p[17],p[18]);
+  CHECK((p[13]|(p[14]<<8))==30000,"latency filled in by the next update: %d",p[13]|(p[14]<<8));
+  CHECK(p[4]+(p[5]<<8)==rtcGetTOD() && p[6]==rtcGetSecond(),"RTC time");
+  CHECK(p[19]+(p[20]<<8)==(6*1850-30)%1000,"%dms into the RTC second",p[19]+(p[20]<<8)); //the release, 30ms before the update
+
+  //Wraps, keeping the latest
+  for(word i=0; i<INPUT_TRACE+5; i++){ stubMillis += 100; event(CTRL_UP,i%2); }
+  std::string wrapped = dump();
+  CHECK(recordCount(wrapped)==INPUT_TRACE,"%u records after wrapping",recordCount(wrapped));
+  CHECK(record(wrapped,INPUT_TRACE-1)[8]==(INPUT_TRACE+4)%2 && record(wrapped,0)[7]==CTRL_UP,"oldest first");
+
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //What recording costs each input event
+  unsigned long n = 1000000;
+  double t0 = testNow();
+  for(unsigned long i=0; i<n; i++){ traceBegin(); traceEnd(CTRL_UP,1,0,0,0); }
+  printf("traceBegin+traceEnd: %.1f ns/event\n",(testNow()-t0)*1e9/n);
+}
@@ -0,0 +1,149 @@
+//Tests for the forecast response parser (arduino-clock/weather.cpp), fed a byte at a time as cycleWeather() can, and
+//for a fetch through cycleWeather() against a stand-in server (stubRemote in stub/WiFiNINA.h). The config leaves
+//ENABLE_DATE_WEATHER off, so weather.cpp is included here with it on. The corpus is responses from
+//extras/weather/standin.py, as-is and edited, named for how the parser should finish with them: ok-<n>-* (complete,
+//with n periods kept), cut-* (cut off before the end), error-* (malformed), or <status>-* (not a 200). It also seeds
+//the fuzzer.
+
+#include <arduino.h>
+#include "arduino-clock.h"
+#undef ENABLE_DATE_WEATHER
+#define ENABLE_DATE_WEATHER true
+#define WEATHER_HOST "192.168.1.10"
+#define WEATHER_PORT 8080
+#define WEATHER_PATH "/forecast"
+#include "weather.cpp"
+#define TEST_FUZZ
+#include "harness.h"
+
+//What weather.cpp needs from the rest of the sketch: Wi-Fi, and the location and UTC offset (Chicago)
+static int eeprom[256];
+int readEEPROM(int loc, bool isInt){ return eeprom[loc]; }
+bool wifiConnected(){ return true; }
+
+#include "extracted.inc"
+
+static WeatherParse parse;
+
+static byte feed(WeatherParse *p, const std::string &s){
+  //Byte by byte, stopping where cycleWeather() would
+  weatherParseReset(p);
+  for(size_t i=0; i<s.size() && p->state<WEATHER_ST_DONE; i++) weatherFeed(p,s[i]);
+  return p->state;
+}
+
+static std::string response(const std::string &body, const char *status="200 OK"){
+  return std::string("HTTP/1.0 ")+status+"\r\nContent-Type: application/json\r\n\r\n"+body;
+}
+
+static bool terminated(const char *buf, size_t size){
+  return memchr(buf,'\0',size)!=NULL;
+}
+
+static int checkInvariants(WeatherParse *p){
+  int fails = 0;
+  CHECK(p->state<=WEATHER_ST_ERROR,"state %d",p->state);
+  CHECK(p->depth<=WEATHER_DEPTH_MAX,"depth %d",p->depth);
+  CHECK(p->state!=WEATHER_ST_DONE || (!p->depth && p->status==200),"done at depth %d, status %d",p->depth,p->status);
+  CHECK(terminated(p->key,sizeof(p->key)) && terminated(p->val,sizeof(p->val)),"key or value not terminated");
+  CHECK(p->count<=WEATHER_PERIODS,"%d periods",p->count);
+  for(byte i=0; i<p->count && i<WEATHER_PERIODS; i++){
+    WeatherPeriod &w = p->periods[i];
+    CHECK(w.month>=1 && w.month<=12 && w.date>=1 && w.date<=31,"period %d dated %d/%d",i,w.month,w.date);
+    CHECK(w.precip<=100 || w.precip==255,"period %d precip %d",i,w.precip);
+  }
+  return fails;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+  feed(&parse,std::string((const char*)data,size));
+  if(checkInvariants(&parse)) abort(); //so libFuzzer keeps the input
+  return 0;
+}
+
+static const std::string *find(const Corpus &corpus, const char *name){
+  for(auto &c : corpus) if(c.first==name) return &c.second;
+  return NULL;
+}
+
+int testRun(const Corpus &corpus){
+  int fails = 0;
+  //Values, rounded and clamped, with nulls and unknown keys - nested, too - left out
+  feed(&parse,response("{\"ttl\":7200,\"source\":{\"name\":\"x\",\"ttl\":5},\"periods\":["
+    "{\"date\":\"2026-10-19\",\"night\":false,\"high\":18.6,\"low\":-3.5,\"precip\":120,\"wind\":[1,{\"high\":99}]},"
+    "{\"date\":\"2024-02-29\",\"night\":true,\"high\":null,\"low\":300,\"precip\":null}]}"));
+  CHECK(parse.state==WEATHER_ST_DONE && parse.count==2 && parse.ttl==7200,"state %d, %d periods, ttl %lu",parse.state,parse.count,parse.ttl);
+  WeatherPeriod &a = parse.periods[0], &b = parse.periods[1];
+  CHECK(a.month==10 && a.date==19 && !a.night && a.high==19 && a.low==-4 && a.precip==100,"first period %d/%d %d %d/%d %d",a.month,a.date,a.night,a.high,a.low,a.precip);
+  CHECK(b.month==2 && b.date==29 && b.night && b.high==WEATHER_NONE && b.low==127 && b.precip==255,"second period %d/%d %d %d/%d %d",b.month,b.date,b.night,b.high,b.low,b.precip);
+  //More periods than we keep
+  std::string many = "{\"periods\":[";
+  for(byte i=0; i<WEATHER_PERIODS+3; i++) many += std::string(i? ",": "")+"{\"date\":\"2026-10-"+std::to_string(10+i)+"\",\"high\":1}";
+  feed(&parse,response(many+"]}"));
+  CHECK(parse.state==WEATHER_ST_DONE && parse.count==WEATHER_PERIODS && parse.periods[WEATHER_PERIODS-1].date==10+WEATHER_PERIODS-1,"%d periods",parse.count);
+  //Malformed dates: the period is dropped
+  for(const char *date : {"2026-1x-19","2026/10/19","2026-02-30","2025-02-29","2026-13-01","2026-10-00","2026-10-2","20261019","","2026-10-19T00:00"}){
+    feed(&parse,response(std::string("{\"periods\":[{\"date\":\"")+date+"\",\"high\":1}]}"));
+    CHECK(parse.state==WEATHER_ST_DONE && !parse.count,"date %s taken as %d/%d",date,parse.periods[0].month,parse.periods[0].date);
+  }
+  //Nesting: as deep as WEATHER_DEPTH_MAX, but no deeper
+  std::string open(WEATHER_DEPTH_MAX-1,'['), close(WEATHER_DEPTH_MAX-1,']');
+  CHECK(feed(&parse,response("{\"x\":"+open+"1"+close+"}"))==WEATHER_ST_DONE,"nesting to the limit: state %d",parse.state);
+  CHECK(feed(&parse,response("{\"x\":["+open+"1"+close+"]}"))==WEATHER_ST_ERROR,"nesting past the limit: state %d",parse.state);
+  //Not a 200: nothing read from the body, however good it is
+  for(const char *status : {"404 Not Found","500 Internal Server Error","301 Moved Permanently","2000 OK","20 OK"}){
+    feed(&parse,response("{\"periods\":[{\"date\":\"2026-10-19\"}]}",status));
+    CHECK(parse.state==WEATHER_ST_ERROR && !parse.count,"status %s: state %d, %d periods",status,parse.state,parse.count);
+  }
+
+  //The corpus, by name
+  for(auto &c : corpus){
+    const char *name = c.first.c_str();
+    byte state = feed(&parse,c.second);
+    fails += checkInvariants(&parse);
+    if(!strncmp(name,"ok-",3)) CHECK(state==WEATHER_ST_DONE && parse.count==atoi(name+3),"%s: state %d, %d periods",name,state,parse.count);
+    else if(!strncmp(name,"cut-",4)) CHECK(state<WEATHER_ST_DONE,"%s: state %d",name,state);
+    else if(!strncmp(name,"error-",6)) CHECK(state==WEATHER_ST_ERROR && parse.status==200,"%s: state %d, status %d",name,state,parse.status);
+    else CHECK(state==WEATHER_ST_ERROR && parse.status==atoi(name),"%s: state %d, status %d",name,state,parse.status);
+    //Cut off anywhere short of the end of the JSON, it never finishes
+    if(!strncmp(name,"ok-",3)){
+      size_t end = c.second.rfind('}');
+      for(size_t len=0; len<=end; len++){
+        byte s = feed(&parse,c.second.substr(0,len));
+        CHECK(s<WEATHER_ST_DONE,"%s cut to %zu bytes: state %d",name,len,s);
+        if(s>=WEATHER_ST_DONE) break;
+      }
+    }
+  }
+
+  //A fetch, as on the clock: the request, then the response a slice per cycle, cached once it's all there
+  const std::string *standin = find(corpus,"ok-6-standin-chicago.http");
+  CHECK(standin,"no standin response in the corpus");
+  if(!standin) return fails;
+  eeprom[10] = 419; eeprom[12] = -876; eeprom[14] = 100-24; //41.9, -87.6, UTC-6
+  StubConn server; server.in = *standin;
+  stubRemote = &server;
+  stubMillis = 1000;
+  for(word i=0; i<100 && (i==0 || weatherBusy()); i++){ cycleWeather(); stubMillis += 50; }
+  CHECK(!server.out.compare(0,55,"GET /forecast?lat=41.9&lon=-87.6&utc=-360 HTTP/1.0\r\nHos"),"request: %.80s",server.out.c_str());
+  const WeatherPeriod *w = getWeather(10,18,true);
+  CHECK(!weatherBusy() && server.closed && w && w->high==12 && w->low==3 && !w->precip,"not cached from %s",standin->c_str());
+  //Another, cut off by the server: the forecast we had stays
+  StubConn cut; cut.in = standin->substr(0,standin->size()-20); cut.open = false;
+  stubRemote = &cut;
+  stubMillis += WEATHER_TTL_MAX*1000UL;
+  for(word i=0; i<100 && (i==0 || weatherBusy()); i++){ cycleWeather(); stubMillis += 50; }
+  CHECK(!weatherBusy() && cut.closed && getWeather(10,18,true)==w && w->high==12,"forecast lost to a cut-off response");
+  stubRemote = NULL;
+  return fails;
+}
+
+void testBench(const Corpus &corpus){
+  //Parsing a standin response, per byte
+  const std::string *standin = find(corpus,"ok-6-standin-chicago.http");
+  if(!standin) return;
+  unsigned long n = 100000;
+  double t0 = testNow();
+  for(unsigned long i=0; i<n; i++) feed(&parse,*standin);
+  printf("standin response (%zu bytes): %.1f ns/byte\n",standin->size(),(testNow()-t0)*1e9/n/standin->size());
+}
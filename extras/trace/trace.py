@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+# Reads control event traces recorded by clocks with INPUT_TRACE enabled (see arduino-clock/trace.cpp), as fetched
+# from GET /trace.
+# Usage: python3 trace.py show <trace.bin>
+# To replay one: curl --create-dirs -o extras/tests/replay/corpus/mine.bin http://<clock IP>/trace;
+# python3 extras/tests/run.py replay - which replays it on the sketch built for the computer, and compares
+
+import struct, sys
+
+VERSION = 4
+RECORD = 21
+REPLAYED = 1
+NO_LATENCY = 65535
+FNS = {0: 'tod', 1: 'cal', 2: 'alarm', 3: 'timer', 4: 'therm', 5: 'tubetest'}
+EVTS = {0: 'release', 1: 'press', 2: 'hold-short', 3: 'hold-long', 4: 'hold-verylong', 5: 'hold-superlong',
+        6: 'double', 7: 'chord'}
+
+def load(path):
+    data = open(path, 'rb').read()
+    if len(data) < 4 or data[:2] != b'CT' or data[2] != VERSION or data[3] != RECORD or (len(data) - 4) % RECORD:
+        sys.exit('%s: not a version %d trace' % (path, VERSION))
+    events = []
+    for pos in range(4, len(data), RECORD):
+        ms, tod, sec, ctrl, evt, last, flags, fn, setpg, lat, vel, disp, secms = struct.unpack('<IHBBBBBBBHB3sH',
+                                                                                      data[pos:pos+RECORD])
+        events.append(dict(ms=ms, tod=tod, sec=sec, secms=secms, ctrl=ctrl, evt=evt, last=last, vel=vel,
+                           replayed=bool(flags & REPLAYED), fn=fn, setpg=setpg, lat=None if lat == NO_LATENCY else lat,
+                           disp=digits(disp)))
+    return events
+
+def digits(packed):
+    # Display digits 0-5, a nibble each - 15 is blank
+    return ''.join(' ' if d > 9 else str(d) for b in packed for d in (b >> 4, b & 0x0F))
+
+def fnname(fn):
+    return FNS.get(fn, 'opt%d' % (fn - 200) if fn > 200 else str(fn))
+
+def line(e, t0):
+    return '%9.3fs  %02d:%02d:%02d.%03d  ctrl %3d %-14s last %2d%s  -> fn %-8s setpg %3d  [%s] after %s%s' % (
+        (e['ms'] - t0) / 1000, e['tod'] // 60, e['tod'] % 60, e['sec'], min(e['secms'], 999), e['ctrl'], EVTS.get(e['evt'], str(e['evt'])),
+        e['last'], ' vel %3d' % e['vel'] if e['vel'] else '        ', fnname(e['fn']), e['setpg'], e['disp'],
+        '-' if e['lat'] is None else '%dus' % e['lat'], '  (replayed)' if e['replayed'] else '')
+
+def latencies(events):
+    lats = sorted(e['lat'] for e in events if e['lat'] is not None)
+    if not lats:
+        return 'no display updates'
+    return 'display update after %d of %d events: min %dus, median %dus, max %dus' % (
+        len(lats), len(events), lats[0], lats[len(lats) // 2], lats[-1])
+
+def show(path):
+    events = load(path)
+    t0 = events[0]['ms'] if events else 0
+    for e in events:
+        print(line(e, t0))
+    print('%d events (%d replayed)' % (len(events), sum(e['replayed'] for e in events)))
+    print(latencies(events))
+
+if len(sys.argv) == 3 and sys.argv[1] == 'show':
+    show(sys.argv[2])
+else:
+    sys.exit('Usage: trace.py show <trace.bin>')
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+# Stand-in forecast server for the clock's weather pages (ENABLE_DATE_WEATHER - see weather.cpp), for testing without
+# a real weather service. Answers GET <any path>?lat=&lon=&utc= with made-up periods in the format the clock expects:
+#   {"ttl":3600,"periods":[{"date":"YYYY-MM-DD","night":false,"high":18,"low":9,"precip":20},...]}
+# Each period is a day (sunrise to sunset) or a night (sunset to sunrise), dated by the day it starts on - from last
+# night through the day after tomorrow, local to the clock per its utc offset (minutes). Temperatures are °C, precip
+# is percent chance, and ttl is how many seconds the clock should keep it. To use real data, replace forecast().
+# Usage: python3 standin.py [port] [ttl]   (defaults 8080, 3600)
+
+import datetime, json, random, sys
+from http.server import BaseHTTPRequestHandler, HTTPServer
+from urllib.parse import urlparse, parse_qs
+
+port = int(sys.argv[1]) if len(sys.argv) > 1 else 8080
+ttl = int(sys.argv[2]) if len(sys.argv) > 2 else 3600
+
+def forecast(lat, lon, utc):
+    today = (datetime.datetime.utcnow() + datetime.timedelta(minutes=utc)).date()
+    periods = []
+    for days in range(-1, 3):
+        date = today + datetime.timedelta(days=days)
+        rnd = random.Random('%s %.1f %.1f' % (date, lat, lon))  # same date and place, same numbers
+        high = round(25 - abs(lat) / 3 + rnd.uniform(-6, 6))
+        low = high - rnd.randint(5, 12)
+        for night in (False, True):
+            if (days == -1 and not night) or (days == 2 and night):
+                continue  # yesterday is over, and the clock doesn't look that far ahead
+            periods.append({'date': date.isoformat(), 'night': night, 'high': high, 'low': low,
+                            'precip': rnd.choice([0, 0, 10, 20, 40, 70, 90])})
+    return {'ttl': ttl, 'periods': periods}
+
+class Handler(BaseHTTPRequestHandler):
+    def do_GET(self):
+        q = parse_qs(urlparse(self.path).query)
+        try:
+            lat = float(q['lat'][0]); lon = float(q['lon'][0]); utc = int(q.get('utc', ['0'])[0])
+        except (KeyError, ValueError):
+            self.send_error(400, 'Needs lat, lon, and utc')
+            return
+        body = json.dumps(forecast(lat, lon, utc)).encode()
+        self.send_response(200)
+        self.send_header('Content-Type', 'application/json')
+        self.send_header('Content-Length', str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+print('Serving stand-in forecasts on port %d (ttl %d)' % (port, ttl))
+HTTPServer(('', port), Handler).serve_forever()